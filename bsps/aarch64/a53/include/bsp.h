@@ -51,6 +51,7 @@
 #include <bsp/start.h>
 
 #include <rtems.h>
+#include <rtems/clockdrv.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -63,6 +64,10 @@ extern "C" {
 #define BSP_A53_QEMU_VPL011_BASE 0x9000000
 #define BSP_A53_QEMU_VPL011_LENGTH 0x1000
 
+#if CLOCK_DRIVER_USE_DYNAMIC_TICK
+#define BSP_IDLE_TASK_BODY Clock_driver_dynamic_tick_idle_body
+#endif
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
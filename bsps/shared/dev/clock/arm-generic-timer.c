@@ -31,12 +31,22 @@
  *
  * The BSP may optionally define ARM_GENERIC_TIMER_USE_VIRTUAL in <bsp.h> to
  * use the virtual timer instead of the physical timer.
+ *
+ * With CLOCK_DRIVER_USE_DYNAMIC_TICK the compare value of each processor is
+ * programmed relative to the tick base of the processor.  The BSP must use
+ * Clock_driver_dynamic_tick_idle_body() as the idle thread body.  With
+ * CLOCK_DRIVER_USE_HIGH_RESOLUTION the compare value is also used for the
+ * one-shot events of the high resolution timer.
  */
 
 typedef struct {
   struct timecounter tc;
   uint32_t interval;
   rtems_vector_number irq;
+#if CLOCK_DRIVER_USE_DYNAMIC_TICK
+  uint32_t max_ticks;
+  uint64_t base[CPU_MAXIMUM_PROCESSORS];
+#endif
 } arm_gt_clock_context;
 
 static arm_gt_clock_context arm_gt_clock_instance;
@@ -44,6 +54,7 @@ static arm_gt_clock_context arm_gt_clock_instance;
 /* This is defined in dev/clock/clockimpl.h */
 void Clock_isr(rtems_irq_hdl_param arg);
 
+#if !CLOCK_DRIVER_USE_DYNAMIC_TICK
 static void arm_gt_clock_at_tick(void)
 {
   uint64_t cval;
@@ -57,6 +68,89 @@ static void arm_gt_clock_at_tick(void)
   arm_gt_clock_set_control(0x1);
 #endif /* ARM_GENERIC_TIMER_UNMASK_AT_TICK */
 }
+#else
+static uint64_t *arm_gt_clock_base(void)
+{
+  return &arm_gt_clock_instance.base[_SMP_Get_current_processor()];
+}
+
+static void arm_gt_clock_set_compare(uint64_t cval)
+{
+  arm_gt_clock_set_compare_value(cval);
+#ifdef ARM_GENERIC_TIMER_UNMASK_AT_TICK
+  arm_gt_clock_set_control(0x1);
+#endif /* ARM_GENERIC_TIMER_UNMASK_AT_TICK */
+}
+
+static void arm_gt_clock_set_ticks(uint64_t base, uint32_t ticks)
+{
+  arm_gt_clock_set_compare(
+    base + (uint64_t) ticks * arm_gt_clock_instance.interval
+  );
+}
+
+static uint32_t arm_gt_clock_elapsed_ticks(void)
+{
+  uint64_t *base;
+  uint64_t now;
+  uint64_t ticks;
+  uint32_t interval;
+
+  base = arm_gt_clock_base();
+  interval = arm_gt_clock_instance.interval;
+  now = arm_gt_clock_get_count();
+  ticks = (now - *base) / interval;
+
+  if (ticks > UINT32_MAX) {
+    ticks = UINT32_MAX;
+  }
+
+  *base += ticks * interval;
+  arm_gt_clock_set_ticks(*base, 1);
+
+  return (uint32_t) ticks;
+}
+
+static void arm_gt_clock_set_next_tick(uint32_t ticks)
+{
+  /*
+   * The timecounter must be updated before the 32-bit counter wraps.
+   */
+  if (ticks > arm_gt_clock_instance.max_ticks) {
+    ticks = arm_gt_clock_instance.max_ticks;
+  }
+
+  arm_gt_clock_set_ticks(*arm_gt_clock_base(), ticks);
+}
+
+static void arm_gt_clock_idle_wait(void)
+{
+  __asm__ volatile ("wfi" : : : "memory");
+}
+
+#if CLOCK_DRIVER_USE_HIGH_RESOLUTION
+static void arm_gt_clock_set_next_event(uint64_t ns)
+{
+  uint64_t cval;
+
+  /*
+   * A later event is covered by the next tick.  This also avoids an overflow
+   * in the conversion to counter ticks.
+   */
+  if (ns > 1000000000) {
+    ns = 1000000000;
+  }
+
+  cval = arm_gt_clock_get_count();
+  cval += (ns * arm_gt_clock_instance.tc.tc_frequency + 999999999)
+    / 1000000000;
+
+  if (cval < arm_gt_clock_get_compare_value()) {
+    arm_gt_clock_set_compare(cval);
+  }
+}
+#endif
+#endif
 
 static void arm_gt_clock_handler_install(void)
 {
@@ -119,6 +213,22 @@ static void arm_gt_clock_initialize(void)
   cval += interval;
   arm_gt_clock_instance.interval = interval;
 
+#if CLOCK_DRIVER_USE_DYNAMIC_TICK
+  {
+    uint32_t cpu_index;
+
+    arm_gt_clock_instance.max_ticks = UINT32_C(0x7fffffff) / interval;
+
+    if (arm_gt_clock_instance.max_ticks == 0) {
+      arm_gt_clock_instance.max_ticks = 1;
+    }
+
+    for (cpu_index = 0; cpu_index < CPU_MAXIMUM_PROCESSORS; ++cpu_index) {
+      arm_gt_clock_instance.base[cpu_index] = cval - interval;
+    }
+  }
+#endif
+
   arm_gt_clock_gt_init(cval);
   arm_gt_clock_secondary_initialization(cval);
 
@@ -161,8 +271,24 @@ RTEMS_SYSINIT_ITEM(
   RTEMS_SYSINIT_ORDER_FIRST
 );
 
+#if !CLOCK_DRIVER_USE_DYNAMIC_TICK
 #define Clock_driver_support_at_tick() \
   arm_gt_clock_at_tick()
+#else
+#define Clock_driver_support_elapsed_ticks() \
+  arm_gt_clock_elapsed_ticks()
+
+#define Clock_driver_support_set_next_tick(ticks) \
+  arm_gt_clock_set_next_tick(ticks)
+
+#define Clock_driver_support_idle_wait() \
+  arm_gt_clock_idle_wait()
+
+#if CLOCK_DRIVER_USE_HIGH_RESOLUTION
+#define Clock_driver_support_set_next_event(ns) \
+  arm_gt_clock_set_next_event(ns)
+#endif
+#endif
 
 #define Clock_driver_support_initialize_hardware() \
   arm_gt_clock_initialize()
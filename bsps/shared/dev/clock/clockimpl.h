@@ -23,6 +23,7 @@
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/timecounter.h>
 #include <rtems/score/thread.h>
+#include <rtems/score/threaddispatch.h>
 #include <rtems/score/watchdogimpl.h>
 
 #ifdef Clock_driver_nanoseconds_since_last_tick
@@ -41,6 +42,69 @@
 #error "Fast Idle PLUS n ISRs per tick is not supported"
 #endif
 
+/*
+ * With a dynamic tick an idle processor does not get a clock interrupt for
+ * each clock tick.  The clock driver idle thread body programs the clock
+ * interrupt for the tick of the first watchdog expiration of the processor
+ * and waits for an interrupt.  The skipped ticks are accounted with the next
+ * clock tick.  The BSP must define
+ *
+ * uint32_t Clock_driver_support_elapsed_ticks( void ): Returns the count of
+ * clock ticks elapsed since the last call on this processor, which may be
+ * zero, advances the tick base by this count and programs the clock interrupt
+ * for the next tick.
+ *
+ * void Clock_driver_support_set_next_tick( uint32_t ticks ): Programs the
+ * clock interrupt of this processor for the tick which is the specified count
+ * of ticks after the tick base.  It may program an earlier tick.  A count of
+ * zero requests a clock interrupt as soon as interrupts are enabled.
+ *
+ * void Clock_driver_support_idle_wait( void ): Waits with interrupts disabled
+ * until an interrupt is pending.
+ *
+ * and use Clock_driver_dynamic_tick_idle_body() as the idle thread body.
+ * Watchdogs must be inserted by the processor which owns them, since a remote
+ * insertion does not wake up an idle processor.
+ */
+#if CLOCK_DRIVER_USE_DYNAMIC_TICK
+  #if CLOCK_DRIVER_USE_FAST_IDLE || CLOCK_DRIVER_ISRS_PER_TICK
+    #error "Dynamic tick PLUS fast idle or n ISRs per tick is not supported"
+  #endif
+  #if defined(CLOCK_DRIVER_USE_DUMMY_TIMECOUNTER) || \
+    defined(CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR)
+    #error "Dynamic tick needs a timecounter and a clock interrupt per processor"
+  #endif
+  #if !defined(Clock_driver_support_elapsed_ticks) || \
+    !defined(Clock_driver_support_set_next_tick) || \
+    !defined(Clock_driver_support_idle_wait)
+    #error "Dynamic tick is not supported by this clock driver"
+  #endif
+#endif
+
+/*
+ * With a high resolution timer the clock interrupt is also used as a one-shot
+ * timer for the first monotonic watchdog of the processor, so that it expires
+ * at its expiration time and not at the next clock tick.  This needs a
+ * dynamic tick.  The BSP must define
+ *
+ * void Clock_driver_support_set_next_event( uint64_t nanoseconds ): Programs
+ * the clock interrupt of this processor to occur at most the specified
+ * nanoseconds from now.  A clock interrupt programmed for an earlier time is
+ * kept.
+ *
+ * The clock interrupts for a one-shot event are not clock ticks.  Monotonic
+ * watchdogs of other processors expire at the next clock tick of their
+ * processor.
+ */
+#if CLOCK_DRIVER_USE_HIGH_RESOLUTION
+  #if !CLOCK_DRIVER_USE_DYNAMIC_TICK
+    #error "High resolution timer needs a dynamic tick"
+  #endif
+  #if !defined(Clock_driver_support_set_next_event)
+    #error "High resolution timer is not supported by this clock driver"
+  #endif
+#endif
+
 /**
  * @brief Do nothing by default.
  */
@@ -102,16 +166,63 @@ static void Clock_driver_timecounter_tick( void )
 #endif
 
 /**
- * @brief ISRs until next clock tick
+ * @brief Clock ticks since initialization
  */
-#if CLOCK_DRIVER_ISRS_PER_TICK
-  volatile uint32_t  Clock_driver_isrs;
+volatile uint32_t    Clock_driver_ticks;
+
+#if CLOCK_DRIVER_USE_DYNAMIC_TICK
+/*
+ * The idle thread accounts for the ticks it skipped when it wakes up.  The
+ * last elapsed tick is left pending for the clock interrupt, which services
+ * the watchdogs.
+ */
+static uint32_t Clock_driver_pending_ticks[ CPU_MAXIMUM_PROCESSORS ];
+
+/*
+ * Accounts for the clock ticks elapsed since the last clock tick of this
+ * processor.  Skipped ticks are added to the tick count before the regular
+ * tick services the watchdogs.
+ */
+static void Clock_driver_dynamic_tick( void )
+{
+  Per_CPU_Control *cpu_self;
+  uint32_t        *pending;
+  uint32_t         ticks;
+
+  cpu_self = _Per_CPU_Get();
+  pending = &Clock_driver_pending_ticks[ _Per_CPU_Get_index( cpu_self ) ];
+  ticks = *pending + Clock_driver_support_elapsed_ticks();
+  *pending = 0;
+  Clock_driver_ticks += ticks;
+
+  if ( ticks > 0 ) {
+    _Watchdog_Skip_ticks( cpu_self, ticks - 1 );
+    Clock_driver_timecounter_tick();
+  }
+
+  #if CLOCK_DRIVER_USE_HIGH_RESOLUTION
+    /*
+     *  Getting the elapsed ticks programmed the clock interrupt for the next
+     *  tick, so the one-shot event must be serviced and programmed again.
+     */
+    _Watchdog_High_resolution_tick( _Per_CPU_Get() );
+  #endif
+}
+#endif
+
+#if CLOCK_DRIVER_USE_HIGH_RESOLUTION
+static void Clock_driver_high_resolution_handler( uint64_t nanoseconds )
+{
+  Clock_driver_support_set_next_event( nanoseconds );
+}
 #endif
 
 /**
- * @brief Clock ticks since initialization
+ * @brief ISRs until next clock tick
  */
-volatile uint32_t    Clock_driver_ticks;
+#if CLOCK_DRIVER_ISRS_PER_TICK
+  volatile uint32_t  Clock_driver_isrs;
+#endif
 
 #ifdef Clock_driver_support_shutdown_hardware
 #error "Clock_driver_support_shutdown_hardware() is no longer supported"
@@ -136,12 +247,22 @@ rtems_isr Clock_isr(
 )
 {
 #endif
-  /*
-   *  Accurate count of ISRs
-   */
-  Clock_driver_ticks += 1;
+  #if !CLOCK_DRIVER_USE_DYNAMIC_TICK
+    /*
+     *  Accurate count of ISRs.  With a dynamic tick, the elapsed ticks are
+     *  added by Clock_driver_dynamic_tick().
+     */
+    Clock_driver_ticks += 1;
+  #endif
 
-  #if CLOCK_DRIVER_USE_FAST_IDLE
+  #if CLOCK_DRIVER_USE_DYNAMIC_TICK
+    /*
+     *  The clock interrupt may be for a tick already accounted by the idle
+     *  thread or for a one-shot event, so the elapsed ticks are determined by
+     *  the hardware.
+     */
+    Clock_driver_dynamic_tick();
+  #elif CLOCK_DRIVER_USE_FAST_IDLE
     {
       Clock_driver_timecounter_tick();
 
@@ -201,6 +322,77 @@ rtems_isr Clock_isr(
   #endif
 }
 
+#if CLOCK_DRIVER_USE_DYNAMIC_TICK
+void *Clock_driver_dynamic_tick_idle_body( uintptr_t ignored )
+{
+  (void) ignored;
+
+  while ( true ) {
+    Per_CPU_Control *cpu_self;
+    ISR_Level        level;
+    uint32_t         ticks;
+
+    cpu_self = _Thread_Dispatch_disable();
+    _ISR_Local_disable( level );
+
+    if ( cpu_self->dispatch_necessary ) {
+      ticks = 0;
+    }
+#if defined(RTEMS_SMP)
+    /*
+     *  The boot processor updates the timecounter and the ticks since boot
+     *  for all processors, so it must not skip ticks in this case.
+     */
+    else if (
+      _Per_CPU_Is_boot_processor( cpu_self )
+        && _SMP_Get_processor_maximum() > 1
+    ) {
+      ticks = 1;
+    }
+#endif
+    else {
+      ticks = _Watchdog_Ticks_until_expiry( cpu_self, UINT32_MAX );
+    }
+
+    if ( ticks > 0 ) {
+      if ( ticks > 1 ) {
+        Clock_driver_support_set_next_tick( ticks );
+
+        #if CLOCK_DRIVER_USE_HIGH_RESOLUTION
+          _Watchdog_High_resolution_update( cpu_self );
+        #endif
+      }
+
+      Clock_driver_support_idle_wait();
+
+      if ( ticks > 1 ) {
+        uint32_t elapsed;
+
+        /*
+         *  Account for the skipped ticks before the interrupt which woke up
+         *  this processor is serviced.  The interrupt service routine may
+         *  use the tick count to insert a watchdog.  The last elapsed tick
+         *  is done by the clock interrupt.
+         */
+        elapsed = Clock_driver_support_elapsed_ticks();
+
+        if ( elapsed > 0 ) {
+          Clock_driver_ticks += elapsed - 1;
+          _Watchdog_Skip_ticks( cpu_self, elapsed - 1 );
+          Clock_driver_pending_ticks[ _Per_CPU_Get_index( cpu_self ) ] = 1;
+          Clock_driver_support_set_next_tick( 0 );
+        }
+      }
+    }
+
+    _ISR_Local_enable( level );
+    _Thread_Dispatch_enable( cpu_self );
+  }
+
+  return NULL;
+}
+#endif
+
 void _Clock_Initialize( void )
 {
   Clock_driver_ticks = 0;
@@ -226,6 +418,10 @@ void _Clock_Initialize( void )
    */
   Clock_driver_support_initialize_hardware();
 
+  #if CLOCK_DRIVER_USE_HIGH_RESOLUTION
+    _Watchdog_High_resolution_handler = Clock_driver_high_resolution_handler;
+  #endif
+
   /*
    *  If we are counting ISRs per tick, then initialize the counter.
    */
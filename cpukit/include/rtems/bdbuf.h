@@ -539,6 +539,85 @@ rtems_bdbuf_read (
   rtems_bdbuf_buffer** bd
 );
 
+/**
+ * @brief Checks if a user buffer is aligned for a direct transfer.
+ *
+ * The user buffer of a direct transfer is handed over to the disk driver like
+ * a buffer of the cache, so it must be aligned to the data cache line size
+ * like the buffers of the cache.  Callers should use the cache for transfers
+ * with buffers which are not aligned.
+ *
+ * @param buffer [in] The user buffer.
+ *
+ * @retval true The buffer is aligned for a direct transfer.
+ * @retval false Otherwise.
+ */
+bool
+rtems_bdbuf_is_direct_aligned (const void *buffer);
+
+/**
+ * @brief Reads consecutive blocks directly from the disk into a user buffer.
+ *
+ * The transfer bypasses the cache.  The blocks are read by multi-segment
+ * transfer requests with one segment per block pointing into the user buffer.
+ * Modified buffers of the blocks are written to the disk before the transfer.
+ * The call blocks until the transfer has completed.  Buffers of the blocks
+ * which are currently with a user are waited for, so the caller must not hold
+ * one of them.
+ *
+ * This is intended for large sequential transfers which would only pollute
+ * the cache.  The user buffer must be aligned, see
+ * rtems_bdbuf_is_direct_aligned().
+ *
+ * Before you can use this function, the rtems_bdbuf_init() routine must be
+ * called at least once to initialize the cache, otherwise a fatal error will
+ * occur.
+ *
+ * @param dd [in] The disk device.
+ * @param block [in] Linear block number of the first block.
+ * @param block_count [in] Count of blocks to read.
+ * @param buffer [out] The user buffer of @a block_count times the block size
+ * of the disk device.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid block range.
+ * @retval RTEMS_INVALID_ADDRESS The user buffer is not aligned.
+ * @retval RTEMS_IO_ERROR IO error.
+ */
+rtems_status_code
+rtems_bdbuf_read_direct (
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum block,
+  uint32_t block_count,
+  void *buffer
+);
+
+/**
+ * @brief Writes consecutive blocks directly from a user buffer to the disk.
+ *
+ * The transfer bypasses the cache.  Buffers of the blocks are discarded before
+ * and after the transfer since their content is stale.  Otherwise this
+ * function behaves like rtems_bdbuf_read_direct().
+ *
+ * @param dd [in] The disk device.
+ * @param block [in] Linear block number of the first block.
+ * @param block_count [in] Count of blocks to write.
+ * @param buffer [in] The user buffer of @a block_count times the block size
+ * of the disk device.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid block range.
+ * @retval RTEMS_INVALID_ADDRESS The user buffer is not aligned.
+ * @retval RTEMS_IO_ERROR IO error.
+ */
+rtems_status_code
+rtems_bdbuf_write_direct (
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum block,
+  uint32_t block_count,
+  const void *buffer
+);
+
 /**
  * Release the buffer obtained by a read call back to the cache. If the buffer
  * was obtained by a get call and was not already in the cache the release
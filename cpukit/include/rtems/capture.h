@@ -161,6 +161,7 @@ typedef struct rtems_capture_control
 #define RTEMS_CAPTURE_TRACED      (1U << 0)
 #define RTEMS_CAPTURE_INIT_TASK   (1U << 1)
 #define RTEMS_CAPTURE_RECORD_TASK (1U << 2)
+#define RTEMS_CAPTURE_WATCHED     (1U << 3)
 
 /*
  * @brief Capture record.
@@ -262,14 +263,13 @@ typedef void (*rtems_capture_timestamp)(rtems_capture_time* time);
  * masks interrupts so use this lock only when needed and do not hold it for
  * long.
  *
- * The lock first masks the CPU interrupt before taking the interrupt
- * lock. This stops a thread context taking the lock and then an interrupt on
- * the same CPU attempting to take the lock so creating a deadlock.
- *
+ * Only the CPU owning a per CPU buffer writes records to it and the reader
+ * only moves the tail of the buffer, so masking the interrupts of the CPU is
+ * enough to lock the buffer. No other CPU is involved.
  */
 typedef struct {
-  rtems_interrupt_lock_context lock_context;
-  rtems_interrupt_lock*        lock;
+  rtems_interrupt_level        level;
+  struct rtems_capture_buffer* buffer;
 } rtems_capture_record_lock_context;
 
 /**
@@ -48,6 +48,15 @@ extern volatile uint32_t Clock_driver_ticks;
  */
 void _Clock_Initialize( void );
 
+/**
+ * @brief Idle thread body of clock drivers with a dynamic tick.
+ *
+ * An idle processor skips the clock ticks until the first watchdog
+ * expiration.  Available if the clock driver is built with
+ * CLOCK_DRIVER_USE_DYNAMIC_TICK.
+ */
+void *Clock_driver_dynamic_tick_idle_body( uintptr_t ignored );
+
 /** @} */
 
 #ifdef __cplusplus
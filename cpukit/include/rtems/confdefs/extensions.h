@@ -90,6 +90,8 @@
 
 #ifdef CONFIGURE_STACK_CHECKER_ENABLED
   #include <rtems/stackchk.h>
+#elif defined(CONFIGURE_STACK_CHECKER_WATERMARK)
+  #warning "CONFIGURE_STACK_CHECKER_WATERMARK defined without CONFIGURE_STACK_CHECKER_ENABLED"
 #endif
 
 #ifdef __cplusplus
@@ -133,7 +135,11 @@ extern "C" {
       RTEMS_NEWLIB_EXTENSION,
     #endif
     #ifdef CONFIGURE_STACK_CHECKER_ENABLED
-      RTEMS_STACK_CHECKER_EXTENSION,
+      #ifdef CONFIGURE_STACK_CHECKER_WATERMARK
+        RTEMS_STACK_CHECKER_WATERMARK_EXTENSION,
+      #else
+        RTEMS_STACK_CHECKER_EXTENSION,
+      #endif
     #endif
     #ifdef CONFIGURE_INITIAL_EXTENSIONS
       CONFIGURE_INITIAL_EXTENSIONS,
@@ -327,6 +327,9 @@ RTEMS_SYSINIT_ITEM(
 #if CONFIGURE_MAXIMUM_FILE_DESCRIPTORS > 0
   rtems_libio_t rtems_libio_iops[ CONFIGURE_MAXIMUM_FILE_DESCRIPTORS ];
 
+  rtems_libio_free_cell
+    rtems_libio_iop_free_cells[ 2 * CONFIGURE_MAXIMUM_FILE_DESCRIPTORS ];
+
   const uint32_t rtems_libio_number_iops = RTEMS_ARRAY_SIZE( rtems_libio_iops );
 #endif
 
@@ -158,6 +158,13 @@ struct Thread_Configured_control {
   #else
     struct { /* Empty */ } Newlib;
   #endif
+  #if defined(CONFIGURE_STACK_CHECKER_ENABLED) \
+    && defined(CONFIGURE_STACK_CHECKER_WATERMARK)
+    Thread_Stack_check_control Stack_check;
+  #endif
+  #ifdef CONFIGURE_CPU_USAGE_COUNTERS
+    Thread_Performance_counters Performance_counters;
+  #endif
 };
 
 const Thread_Control_add_on _Thread_Control_add_ons[] = {
@@ -200,6 +207,21 @@ const Thread_Control_add_on _Thread_Control_add_ons[] = {
 const size_t _Thread_Control_add_on_count =
   RTEMS_ARRAY_SIZE( _Thread_Control_add_ons );
 
+#if defined(CONFIGURE_STACK_CHECKER_ENABLED) \
+  && defined(CONFIGURE_STACK_CHECKER_WATERMARK)
+  const size_t _Thread_Stack_check_offset =
+    offsetof( Thread_Configured_control, Stack_check );
+#else
+  const size_t _Thread_Stack_check_offset = 0;
+#endif
+
+#ifdef CONFIGURE_CPU_USAGE_COUNTERS
+  const size_t _Thread_Performance_counters_offset =
+    offsetof( Thread_Configured_control, Performance_counters );
+#else
+  const size_t _Thread_Performance_counters_offset = 0;
+#endif
+
 #ifdef RTEMS_SMP
   struct Thread_queue_Configured_heads {
     Thread_queue_Heads Heads;
@@ -72,6 +72,248 @@ void rtems_cpu_usage_top( void );
 
 void rtems_cpu_usage_reset( void );
 
+/**
+ * @brief The CPU usage of a thread in the last sampler period.
+ */
+typedef struct {
+  /**
+   * @brief The thread identifier.
+   */
+  rtems_id id;
+
+  /**
+   * @brief The real priority of the thread.
+   */
+  rtems_task_priority real_priority;
+
+  /**
+   * @brief The current priority of the thread.
+   */
+  rtems_task_priority priority;
+
+  /**
+   * @brief The CPU time used by the thread in nanoseconds.
+   */
+  uint64_t total;
+
+  /**
+   * @brief The CPU time used by the thread in the last period in nanoseconds.
+   */
+  uint64_t current;
+} rtems_cpu_usage_sample;
+
+/**
+ * @brief The system CPU usage of the last sampler period.
+ */
+typedef struct {
+  /**
+   * @brief The uptime since the last CPU usage reset in nanoseconds.
+   */
+  uint64_t uptime;
+
+  /**
+   * @brief The length of the last period in nanoseconds.
+   */
+  uint64_t period;
+
+  /**
+   * @brief The CPU time used by all threads in nanoseconds.
+   */
+  uint64_t total;
+
+  /**
+   * @brief The CPU time used by the idle threads in nanoseconds.
+   */
+  uint64_t idle;
+
+  /**
+   * @brief The CPU time used by all threads in the last period in
+   * nanoseconds.
+   */
+  uint64_t current;
+
+  /**
+   * @brief The CPU time used by the idle threads in the last period in
+   * nanoseconds.
+   */
+  uint64_t current_idle;
+
+  /**
+   * @brief The number of threads.
+   */
+  uint32_t threads;
+
+  /**
+   * @brief The number of threads which used the processor in the last
+   * period.
+   */
+  uint32_t active;
+
+  /**
+   * @brief The sum of the thread stack sizes in bytes.
+   */
+  uintptr_t stack_size;
+} rtems_cpu_usage_summary;
+
+/**
+ * @brief Creates the CPU usage sampler.
+ *
+ * The sampler keeps the CPU usage of each thread in a table allocated when
+ * it is created.  A thread switch extension records the threads which used a
+ * processor so that a sampler update only visits these threads and not every
+ * thread of the system.  The table has an entry for each thread object
+ * configured when the sampler is created.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_RESOURCE_IN_USE The sampler exists already.
+ * @retval RTEMS_NO_MEMORY Not enough memory for the sampler table.
+ */
+rtems_status_code rtems_cpu_usage_sampler_create( void );
+
+/**
+ * @brief Deletes the CPU usage sampler.
+ */
+void rtems_cpu_usage_sampler_delete( void );
+
+/**
+ * @brief Ends the current sampler period and starts a new one.
+ *
+ * @param[out] summary The system CPU usage of the ended period.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE The sampler does not exist.
+ * @retval RTEMS_TOO_MANY A thread was created which has no entry in the
+ *   sampler table.  The values do not include this thread.
+ */
+rtems_status_code rtems_cpu_usage_sampler_update(
+  rtems_cpu_usage_summary *summary
+);
+
+/**
+ * @brief Gets the threads with the highest CPU usage of the last sampler
+ * period.
+ *
+ * Ordered by the CPU time used in the last period only the threads which
+ * used a processor in this period are visited.
+ *
+ * @param[out] samples The threads in descending order of CPU usage.
+ * @param count The maximum number of threads to get.
+ * @param total Order by the total CPU time used instead of the CPU time used
+ *   in the last period.
+ *
+ * @return The number of threads stored in @a samples.
+ */
+size_t rtems_cpu_usage_sampler_top(
+  rtems_cpu_usage_sample *samples,
+  size_t                  count,
+  bool                    total
+);
+
+/**
+ * @brief Processor performance counter values.
+ */
+typedef struct {
+  /**
+   * @brief The processor cycles.
+   *
+   * On processors without a cycle counter, this is the CPU counter ticks, see
+   * rtems_counter_read().
+   */
+  uint64_t cycles;
+
+  /**
+   * @brief The instructions retired.
+   */
+  uint64_t instructions;
+
+  /**
+   * @brief The data cache misses.
+   */
+  uint64_t cache_misses;
+} rtems_cpu_usage_counters;
+
+/**
+ * @brief Enables the CPU usage counters.
+ *
+ * The performance counters of each processor are started and a thread switch
+ * extension adds the counter increments to the thread leaving a processor
+ * and to the processor totals.  The values are reset by
+ * rtems_cpu_usage_reset().
+ *
+ * On processors without performance monitor support only the cycles are
+ * counted, see rtems_cpu_usage_counters_have_events().  The counters are read
+ * as 32-bit values, so they are also sampled by a watchdog on each processor
+ * four times per second.
+ *
+ * The application configuration must define CONFIGURE_CPU_USAGE_COUNTERS to
+ * provide the storage for the counters in the thread control blocks.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_NOT_CONFIGURED The CPU usage counters are not configured.
+ * @retval RTEMS_RESOURCE_IN_USE The CPU usage counters are already enabled.
+ */
+rtems_status_code rtems_cpu_usage_counters_enable( void );
+
+/**
+ * @brief Disables the CPU usage counters.
+ *
+ * The accumulated values are kept.
+ */
+void rtems_cpu_usage_counters_disable( void );
+
+/**
+ * @brief Indicates if the CPU usage counters are enabled.
+ *
+ * @retval true The CPU usage counters are enabled.
+ * @retval false Otherwise.
+ */
+bool rtems_cpu_usage_counters_are_enabled( void );
+
+/**
+ * @brief Indicates if the CPU usage counters count the instructions and cache
+ * misses in addition to the cycles.
+ *
+ * @retval true The instructions and cache misses are counted.
+ * @retval false Only the cycles are counted or the CPU usage counters were
+ *   never enabled.
+ */
+bool rtems_cpu_usage_counters_have_events( void );
+
+/**
+ * @brief Gets the CPU usage counters of a thread.
+ *
+ * The values include the counter increments up to the last time the thread
+ * left a processor or the counters were last sampled.
+ *
+ * @param id The thread identifier.  Use RTEMS_SELF for the executing thread.
+ * @param[out] counters The counter values of the thread.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The counters pointer was NULL.
+ * @retval RTEMS_NOT_CONFIGURED The CPU usage counters are not configured.
+ * @retval RTEMS_INVALID_ID There is no thread with this identifier.
+ */
+rtems_status_code rtems_cpu_usage_get_counters(
+  rtems_id                  id,
+  rtems_cpu_usage_counters *counters
+);
+
+/**
+ * @brief Gets the CPU usage counters of a processor.
+ *
+ * @param cpu_index The processor index.
+ * @param[out] counters The counter values summed up over all threads which
+ *   used the processor.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The counters pointer was NULL.
+ * @retval RTEMS_INVALID_NUMBER The processor index is invalid.
+ */
+rtems_status_code rtems_cpu_usage_get_processor_counters(
+  uint32_t                  cpu_index,
+  rtems_cpu_usage_counters *counters
+);
+
 /**
  * @brief Reports per-processor information.
  *
@@ -294,6 +294,38 @@ typedef struct {
    * rtems_dosfs_create_utf8_converter().
    */
   rtems_dosfs_convert_control *converter;
+
+  /**
+   * @brief Maximum count of directories with a name index.
+   *
+   * The name index of a directory maps the names of the directory entries to
+   * their position in the directory.  It is built by the first name lookup in
+   * a directory and avoids the scan and name conversion of all directory
+   * entries for further lookups.  This speeds up the lookup in large
+   * directories considerably.  The least recently used index is discarded if
+   * this maximum is reached.  The memory used by an index is roughly
+   * proportional to the count and length of the names in the directory.
+   *
+   * A value of zero disables the name index.
+   */
+  uint32_t name_index_directories;
+
+  /**
+   * @brief Minimum count of bytes of a file read or write transfer to use
+   * direct I/O.
+   *
+   * The whole clusters of such a transfer are transferred directly between
+   * the device and the user buffer with multi-segment block device requests.
+   * This bypasses the block device buffer cache and avoids the copy of the
+   * data, which speeds up large sequential transfers considerably.  Cached
+   * blocks of the clusters are synchronized or discarded as needed.  Transfers
+   * with a user buffer which is not aligned for direct transfers, see
+   * rtems_bdbuf_is_direct_aligned(), and the parts of a transfer which do not
+   * cover whole clusters use the cache.
+   *
+   * A value of zero disables the direct I/O.
+   */
+  uint32_t direct_io_threshold;
 } rtems_dosfs_mount_options;
 
 /**
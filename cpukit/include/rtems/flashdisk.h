@@ -75,14 +75,16 @@ extern "C" {
  * pages it is queue on the available queue. If the segment has
  * no erased pages it is queue on the used queue.
  *
- * The available queue is sorted from the least number available
- * to the most number of available pages. A segment that has just
- * been erased will placed at the end of the queue. A segment that
- * has only a few available pages will be used sooner and once
- * there are no available pages it is queued on the used queue.
- * The used queue hold segments that have no available pages and
- * is sorted from the least number of active pages to the most
- * number of active pages.
+ * The available queue is a set of buckets indexed by the number of
+ * available pages. Writes take the segment from the bucket with the
+ * least number available and compaction takes the segment from the
+ * bucket with the most number of available pages. A bitmap of the
+ * buckets in use finds these segments without walking the queue. A
+ * segment that has just been erased will placed at the end of its
+ * bucket. A segment that has only a few available pages will be used
+ * sooner and once there are no available pages it is queued on the
+ * used queue. The used queue hold segments that have no available
+ * pages and is a set of buckets indexed by the number of used pages.
  *
  * The driver is required to compact segments. Compacting takes
  * the segment with the most number of available pages from the
@@ -371,6 +373,14 @@ typedef struct rtems_fdisk_device_desc
  * when writing. If you set this to 0 then compaction will fail because
  * there will be no segments to compact into.
  *
+ * With the RTEMS_FDISK_BACKGROUND_COMPACT flag and a non-zero compaction task
+ * priority the driver creates a task for each disk which compacts the disk
+ * once the available compacting segment count is reached. The write request
+ * that reaches this level only wakes the task. This keeps the time of a
+ * write short and predictable. A write only compacts itself if no segment is
+ * available at all. If the task cannot be started the disk compacts in the
+ * foreground.
+ *
  * The info level can be 0 for off with error, and abort messages allowed.
  * Level 1 is warning messages, level 1 is informational messages, and level 3
  * is debugging type prints. The info level can be turned off with a compile
@@ -402,6 +412,13 @@ typedef struct rtems_flashdisk_config
    */
   uint32_t                       avail_compact_segs;
   uint32_t                       info_level;     /**< Default info level. */
+
+  /**
+   * The priority of the background compaction task.  The task is only
+   * created if the RTEMS_FDISK_BACKGROUND_COMPACT flag is set and the
+   * priority is not zero.
+   */
+  rtems_task_priority            compact_task_priority;
 } rtems_flashdisk_config;
 
 /*
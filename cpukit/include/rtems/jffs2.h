@@ -16,6 +16,7 @@
 #define RTEMS_JFFS2_H
 
 #include <rtems/fs.h>
+#include <rtems/rtems/tasks.h>
 #include <sys/param.h>
 #include <sys/ioccom.h>
 #include <zlib.h>
@@ -296,6 +297,9 @@ struct rtems_jffs2_flash_control {
    * This operation is optional and may be NULL.  This operation should wake up
    * a garbage collection thread.  The garbage collection thread should use the
    * RTEMS_JFFS2_ON_DEMAND_GARBAGE_COLLECTION IO control to carry out the work.
+   *
+   * This operation is not used if the file system instance has a garbage
+   * collection task, see rtems_jffs2_mount_data::gc_task_priority.
    */
   rtems_jffs2_trigger_garbage_collection trigger_garbage_collection;
 };
@@ -442,6 +446,63 @@ int rtems_jffs2_compressor_zlib_decompress(
   uint32_t datalen
 );
 
+/**
+ * @brief JFFS2 compression type of the LZ4 compressor.
+ *
+ * This compression type is specific to RTEMS.  It is outside the range of
+ * types used by Linux, so file systems with LZ4 compressed nodes cannot be
+ * read by Linux.
+ */
+#define RTEMS_JFFS2_COMPR_LZ4 0x40
+
+/**
+ * @brief LZ4 compressor control structure.
+ *
+ * The LZ4 compressor trades compression ratio for speed.  It compresses and
+ * decompresses considerably faster than the ZLIB compressor and needs no
+ * heap memory.  Use it for example like this
+ *
+ * @code
+ * static rtems_jffs2_compressor_lz4_control compressor_instance = {
+ *   .super = {
+ *     .compress = rtems_jffs2_compressor_lz4_compress,
+ *     .decompress = rtems_jffs2_compressor_lz4_decompress
+ *   }
+ * };
+ * @endcode
+ */
+typedef struct {
+  rtems_jffs2_compressor_control super;
+
+  /**
+   * @brief Hash table of recent input positions used by the match search.
+   */
+  uint16_t hash_table[4096];
+} rtems_jffs2_compressor_lz4_control;
+
+/**
+ * @brief LZ4 compressor compress operation.
+ */
+uint16_t rtems_jffs2_compressor_lz4_compress(
+  rtems_jffs2_compressor_control *self,
+  unsigned char *data_in,
+  unsigned char *cdata_out,
+  uint32_t *datalen,
+  uint32_t *cdatalen
+);
+
+/**
+ * @brief LZ4 compressor decompress operation.
+ */
+int rtems_jffs2_compressor_lz4_decompress(
+  rtems_jffs2_compressor_control *self,
+  uint16_t comprtype,
+  unsigned char *cdata_in,
+  unsigned char *data_out,
+  uint32_t cdatalen,
+  uint32_t datalen
+);
+
 /**
  * @brief JFFS2 mount options.
  *
@@ -459,6 +520,71 @@ typedef struct {
    * The compressor is optional and this pointer may be @c NULL.
    */
   rtems_jffs2_compressor_control *compressor_control;
+
+  /**
+   * @brief Enables the erase block summary support.
+   *
+   * In case this option is enabled, a summary node is written to the end of
+   * each erase block once it is full.  The summary node describes all nodes
+   * of the erase block, so that the mount needs to read only the summary
+   * nodes of full erase blocks instead of scanning their entire content.
+   * This speeds up the mount considerably for large file systems.  The
+   * summary nodes use some flash space and are compatible with the Linux
+   * JFFS2 summary support.  File systems with summary nodes may be mounted
+   * with this option disabled, the summary nodes are ignored in this case.
+   */
+  bool enable_summary;
+
+  /**
+   * @brief Priority of the garbage collection task.
+   *
+   * In case this value is not zero, then a garbage collection task with this
+   * priority is created for the file system instance.  It is woken up by the
+   * file system once the garbage collection thresholds are reached and
+   * performs garbage collection passes in the background until the
+   * thresholds are satisfied again.  Use a low priority so that the garbage
+   * collection runs in otherwise idle periods and writes seldom need to
+   * collect garbage on demand.  The task is deleted during unmount.
+   *
+   * In case this value is zero, then no garbage collection task is created
+   * and the flash control trigger garbage collection operation is used.
+   */
+  rtems_task_priority gc_task_priority;
+
+  /**
+   * @brief Count of free erase blocks below which the garbage collection task
+   * is woken up.
+   *
+   * In case this value is zero, then a default value derived from the flash
+   * size is used.
+   */
+  uint32_t gc_trigger_free_blocks;
+
+  /**
+   * @brief Count of very dirty erase blocks at which the garbage collection
+   * task is woken up.
+   *
+   * In case this value is zero, then a default value derived from the flash
+   * size is used.
+   */
+  uint32_t gc_trigger_very_dirty_blocks;
+
+  /**
+   * @brief Size in bytes of the per-file write buffer.
+   *
+   * In case this value is not zero, then small appends to the end of a file
+   * are collected in a write buffer of this size and written as one data
+   * node once the buffer is full, the buffered data reaches a page boundary,
+   * or the file is read, truncated, synchronized or closed.  This reduces the
+   * node overhead on flash and the count of flash writes for applications
+   * which append small records, for example logging tasks.  The size is
+   * limited to the page size of 4096 bytes.  Buffered data is lost in case
+   * of a power failure before it is written to flash.
+   *
+   * In case this value is zero, then each write produces data nodes
+   * immediately.
+   */
+  uint32_t write_buffer_size;
 } rtems_jffs2_mount_data;
 
 /**
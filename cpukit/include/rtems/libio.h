@@ -1325,6 +1325,19 @@ struct rtems_libio_tt {
   void                                   *data1;     /* ... */
 };
 
+/**
+ * @brief A cell of the free file descriptor queue.
+ *
+ * The queue holds the indices of the free file descriptors in a ring of cells.
+ * The sequence number tells the enqueue and dequeue operations if the cell is
+ * ready for them.  This enables a lock-free allocation and release of the file
+ * descriptors.
+ */
+typedef struct {
+  Atomic_Uint sequence;
+  uint32_t    descriptor;
+} rtems_libio_free_cell;
+
 /**
  * @brief Paramameter block for read/write.
  *
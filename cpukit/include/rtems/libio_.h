@@ -60,8 +60,25 @@ extern "C" {
 
 extern const uint32_t rtems_libio_number_iops;
 extern rtems_libio_t rtems_libio_iops[];
-extern void *rtems_libio_iop_free_head;
-extern void **rtems_libio_iop_free_tail;
+extern rtems_libio_free_cell rtems_libio_iop_free_cells[];
+
+/**
+ * @brief The free file descriptor queue.
+ *
+ * This is a bounded multi-producer/multi-consumer queue of the free file
+ * descriptor indices.  The ring size is the smallest power of two greater than
+ * or equal to the number of file descriptors.  The ring cells are provided by
+ * the application configuration with twice the number of file descriptors.
+ * The queue is first in, first out.  This increases the likelihood that a use
+ * after close is detected.
+ */
+typedef struct {
+  Atomic_Uint enqueue;
+  Atomic_Uint dequeue;
+  uint32_t    mask;
+} rtems_libio_free_queue;
+
+extern rtems_libio_free_queue rtems_libio_iop_free;
 
 extern const rtems_filesystem_file_handlers_r rtems_filesystem_null_handlers;
 
@@ -362,11 +379,35 @@ static inline void rtems_filesystem_instance_unlock(
  */
 
 /**
- * This routine searches the IOP Table for an unused entry.  If it
- * finds one, it returns it.  Otherwise, it returns NULL.
+ * This routine dequeues the next free entry of the IOP Table.  If there
+ * is one, it returns it.  Otherwise, it returns NULL.  It does not
+ * obtain the libio lock.
  */
 rtems_libio_t *rtems_libio_allocate(void);
 
+/**
+ * @brief Returns the count of free file descriptors.
+ *
+ * The count is a snapshot which may be out of date if other threads allocate
+ * or free file descriptors concurrently.
+ */
+static inline uint32_t rtems_libio_free_count( void )
+{
+  unsigned int dequeue;
+  unsigned int enqueue;
+
+  dequeue = _Atomic_Load_uint(
+    &rtems_libio_iop_free.dequeue,
+    ATOMIC_ORDER_ACQUIRE
+  );
+  enqueue = _Atomic_Load_uint(
+    &rtems_libio_iop_free.enqueue,
+    ATOMIC_ORDER_ACQUIRE
+  );
+
+  return enqueue - dequeue;
+}
+
 /**
  * Convert UNIX fnctl(2) flags to ones that RTEMS drivers understand
  */
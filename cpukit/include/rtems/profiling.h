@@ -51,7 +51,9 @@ extern "C" {
  * Profiling information includes critical timing values such as the maximum
  * time of disabled thread dispatching which is a measure for the thread
  * dispatch latency.  On SMP configurations statistics of all SMP locks in the
- * system are available.
+ * system are available.  The contention statistics of Classic semaphores and
+ * POSIX mutexes and rwlocks are available on uniprocessor and SMP profiling
+ * configurations.
  *
  * Profiling information can be retrieved via rtems_profiling_iterate() and
  * reported as an XML dump via rtems_profiling_report_xml().  These functions
@@ -77,7 +79,21 @@ typedef enum {
    *
    * @see rtems_profiling_smp_lock.
    */
-  RTEMS_PROFILING_SMP_LOCK
+  RTEMS_PROFILING_SMP_LOCK,
+
+  /**
+   * @brief Type of object contention profiling data.
+   *
+   * @see rtems_profiling_object.
+   */
+  RTEMS_PROFILING_OBJECT,
+
+  /**
+   * @brief Type of object contention profiling overflow data.
+   *
+   * @see rtems_profiling_object_overflow.
+   */
+  RTEMS_PROFILING_OBJECT_OVERFLOW
 } rtems_profiling_type;
 
 /**
@@ -265,6 +281,113 @@ typedef struct {
   uint64_t contention_counts[RTEMS_PROFILING_SMP_LOCK_CONTENTION_COUNTS];
 } rtems_profiling_smp_lock;
 
+/**
+ * @brief Object contention profiling data.
+ *
+ * Statistics are gathered for Classic semaphores and POSIX mutexes and
+ * rwlocks which were acquired at least once.  The statistics of Classic
+ * semaphores are part of the semaphore.  The POSIX mutexes and rwlocks are
+ * self-contained objects, so their statistics are kept in a table with a
+ * limited number of entries, see rtems_profiling_object_overflow.  An entry
+ * is given back when the object is destroyed or initialized again.  Objects
+ * which are never destroyed keep their entry.
+ *
+ * An acquire operation is contended if the acquiring thread had to wait for
+ * the object.  The wait time is the time elapsed between the enqueue of the
+ * thread on the thread queue of the object and the successful return of the
+ * acquire operation.
+ *
+ * The hold time is the time elapsed between the outermost acquire operation
+ * and the outermost release operation of the owner.  Only mutexes and write
+ * locked rwlocks have a hold time.  The readers of a rwlock share it without
+ * an owner, so read locks have no hold time.
+ */
+typedef struct {
+  /**
+   * @brief The profiling data header.
+   */
+  rtems_profiling_header header;
+
+  /**
+   * @brief The object identifier or zero for POSIX mutexes and rwlocks.
+   */
+  uint32_t id;
+
+  /**
+   * @brief The object address.
+   */
+  const void *object;
+
+  /**
+   * @brief The object name or NULL for POSIX mutexes and rwlocks.
+   */
+  const char *name;
+
+  /**
+   * @brief The maximum wait time of a contended acquire operation in
+   * nanoseconds.
+   */
+  uint32_t max_wait_time;
+
+  /**
+   * @brief The maximum hold time in nanoseconds.
+   */
+  uint32_t max_hold_time;
+
+  /**
+   * @brief The count of successful acquire operations.
+   *
+   * This value may overflow.
+   */
+  uint64_t acquire_count;
+
+  /**
+   * @brief The count of contended acquire operations.
+   *
+   * This value may overflow.
+   */
+  uint64_t contention_count;
+
+  /**
+   * @brief Total wait time of contended acquire operations in nanoseconds.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_wait_time;
+
+  /**
+   * @brief Total hold time in nanoseconds.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_hold_time;
+} rtems_profiling_object;
+
+/**
+ * @brief Object contention profiling overflow data.
+ *
+ * Acquire operations of POSIX mutexes and rwlocks which found no free entry
+ * in the statistics table are not recorded.  They are counted instead.
+ */
+typedef struct {
+  /**
+   * @brief The profiling data header.
+   */
+  rtems_profiling_header header;
+
+  /**
+   * @brief The count of entries in the statistics table.
+   */
+  uint32_t table_size;
+
+  /**
+   * @brief The count of acquire operations which were not recorded.
+   *
+   * This value may overflow.
+   */
+  uint64_t overflow_count;
+} rtems_profiling_object_overflow;
+
 /**
  * @brief Collection of profiling data.
  */
@@ -283,6 +406,17 @@ typedef union {
    * @brief SMP lock profiling data if indicated by the header.
    */
   rtems_profiling_smp_lock smp_lock;
+
+  /**
+   * @brief Object contention profiling data if indicated by the header.
+   */
+  rtems_profiling_object object;
+
+  /**
+   * @brief Object contention profiling overflow data if indicated by the
+   * header.
+   */
+  rtems_profiling_object_overflow object_overflow;
 } rtems_profiling_data;
 
 /**
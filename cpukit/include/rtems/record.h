@@ -1905,6 +1905,65 @@ void _Record_Drain(
  */
 void rtems_record_drain( rtems_record_drain_visitor visitor, void *arg );
 
+/**
+ * @brief The maximum count of callers recorded by the sampling profiler for
+ * one sample.
+ */
+#define RTEMS_RECORD_PROFILER_DEPTH_MAXIMUM 8
+
+/**
+ * @brief Starts the sampling profiler.
+ *
+ * On each online processor, a watchdog samples the context interrupted by
+ * the clock tick interrupt each @a interval clock ticks, see
+ * rtems_record_profiler_sample().  Processors which are not online, for
+ * example processors not assigned to a scheduler, are not sampled.  The
+ * samples are recorded in the record items of the processor and can be
+ * drained like all other record items.  The thread switch events of the
+ * record extensions, see CONFIGURE_RECORD_EXTENSIONS_ENABLED, associate the
+ * samples with threads.
+ *
+ * The record client, see <rtems/recordclient.h>, decodes the sample events.
+ * There is no host tool in this tree which builds profiles from them.
+ *
+ * @param interval The sample interval in clock ticks.  A value of zero is
+ *   treated as one.
+ * @param depth The maximum count of callers recorded for each sample.  The
+ *   value is limited to RTEMS_RECORD_PROFILER_DEPTH_MAXIMUM.
+ */
+void rtems_record_profiler_start( uint32_t interval, unsigned int depth );
+
+/**
+ * @brief Stops the sampling profiler.
+ */
+void rtems_record_profiler_stop( void );
+
+/**
+ * @brief Samples the context interrupted by the current interrupt.
+ *
+ * This function may be called by the handler of an arbitrary interrupt, for
+ * example a high rate timer interrupt, to sample the interrupted context.
+ * It does nothing in case the CPU port cannot determine the interrupted
+ * context.
+ */
+void rtems_record_profiler_sample( void );
+
+/**
+ * @brief Records a profiler sample.
+ *
+ * Generates an RTEMS_RECORD_SAMPLE_PC event followed by one
+ * RTEMS_RECORD_SAMPLE_CALLER event for each return address found through the
+ * frame pointer chain.  The chain is followed as long as the frame records
+ * are in the stack of the executing thread, up to the depth set by
+ * rtems_record_profiler_start().
+ *
+ * @param pc The sampled program counter.  A value of zero produces no events.
+ * @param fp The frame pointer of the sampled context.  It points to a frame
+ *   record which consists of the previous frame pointer followed by the
+ *   return address.  Use zero to produce no RTEMS_RECORD_SAMPLE_CALLER events.
+ */
+void rtems_record_profiler_sample_context( uintptr_t pc, uintptr_t fp );
+
 /** @} */
 
 #ifdef __cplusplus
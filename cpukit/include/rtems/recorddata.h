@@ -55,7 +55,7 @@ extern "C" {
  * The record version reflects the record event definitions.  It is reported by
  * the RTEMS_RECORD_VERSION event.
  */
-#define RTEMS_RECORD_THE_VERSION 9
+#define RTEMS_RECORD_THE_VERSION 10
 
 /**
  * @brief The items are in 32-bit little-endian format.
@@ -281,6 +281,8 @@ typedef enum {
   RTEMS_RECORD_RTEMS_TIMER_RESET,
   RTEMS_RECORD_RTEMS_TIMER_SERVER_FIRE_AFTER,
   RTEMS_RECORD_RTEMS_TIMER_SERVER_FIRE_WHEN,
+  RTEMS_RECORD_SAMPLE_CALLER,
+  RTEMS_RECORD_SAMPLE_PC,
   RTEMS_RECORD_SBWAIT_ENTRY,
   RTEMS_RECORD_SBWAIT_EXIT,
   RTEMS_RECORD_SBWAKEUP_ENTRY,
@@ -437,8 +439,6 @@ typedef enum {
   RTEMS_RECORD_WRITEV_EXIT,
 
   /* Unused system events */
-  RTEMS_RECORD_SYSTEM_341,
-  RTEMS_RECORD_SYSTEM_342,
   RTEMS_RECORD_SYSTEM_343,
   RTEMS_RECORD_SYSTEM_344,
   RTEMS_RECORD_SYSTEM_345,
@@ -285,6 +285,28 @@ int rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
                                 bool*                     allocate,
                                 rtems_rfs_bitmap_bit*     bit);
 
+/**
+ * Find a free bit searching from the seed as @ref rtems_rfs_bitmap_map_alloc
+ * does and allocate the clear bits that follow it up to the count. The bits
+ * allocated are a contiguous run starting at the bit returned.
+ *
+ * @param[in] control is the map control.
+ * @param[in] seed is the bit to search out from.
+ * @param[in] count is the maximum number of bits to allocate.
+ * @param[out] allocated A bit was allocated.
+ * @param[out] bit will contain the first bit of the run if allocated.
+ * @param[out] allocated_count will contain the number of bits allocated.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_bitmap_map_alloc_run (rtems_rfs_bitmap_control* control,
+                                    rtems_rfs_bitmap_bit      seed,
+                                    size_t                    count,
+                                    bool*                     allocated,
+                                    rtems_rfs_bitmap_bit*     bit,
+                                    size_t*                   allocated_count);
+
 /**
  * Create a search bit map from the actual bit map.
  *
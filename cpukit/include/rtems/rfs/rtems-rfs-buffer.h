@@ -45,6 +45,8 @@ typedef rtems_blkdev_bnum  rtems_rfs_buffer_block;
 typedef rtems_bdbuf_buffer rtems_rfs_buffer;
 #define rtems_rfs_buffer_io_request rtems_rfs_buffer_bdbuf_request
 #define rtems_rfs_buffer_io_release rtems_rfs_buffer_bdbuf_release
+#define rtems_rfs_buffer_io_direct rtems_rfs_buffer_bdbuf_direct
+#define rtems_rfs_buffer_io_direct_aligned rtems_bdbuf_is_direct_aligned
 
 /**
  * Request a buffer from the RTEMS libblock BD buffer cache.
@@ -58,6 +60,15 @@ int rtems_rfs_buffer_bdbuf_request (rtems_rfs_file_system* fs,
  */
 int rtems_rfs_buffer_bdbuf_release (rtems_rfs_buffer* handle,
                                     bool              modified);
+/**
+ * Transfer blocks directly between the media and a user buffer bypassing the
+ * RTEMS libblock BD buffer cache.
+ */
+int rtems_rfs_buffer_bdbuf_direct (rtems_rfs_file_system* fs,
+                                   rtems_rfs_buffer_block block,
+                                   size_t                 count,
+                                   void*                  data,
+                                   bool                   read);
 #else /* Device I/O */
 typedef uint32_t rtems_rfs_buffer_block;
 typedef struct _rtems_rfs_buffer
@@ -70,6 +81,8 @@ typedef struct _rtems_rfs_buffer
 } rtems_rfs_buffer;
 #define rtems_rfs_buffer_io_request rtems_rfs_buffer_deviceio_request
 #define rtems_rfs_buffer_io_release rtems_rfs_buffer_deviceio_release
+#define rtems_rfs_buffer_io_direct rtems_rfs_buffer_deviceio_direct
+#define rtems_rfs_buffer_io_direct_aligned(_d) (true)
 
 /**
  * Request a buffer from the device I/O.
@@ -83,6 +96,14 @@ int rtems_rfs_buffer_deviceio_request (rtems_rfs_file_system* fs,
  */
 int rtems_rfs_buffer_deviceio_release (rtems_rfs_buffer* handle,
                                        bool              modified);
+/**
+ * Transfer blocks directly between the device and a user buffer.
+ */
+int rtems_rfs_buffer_deviceio_direct (rtems_rfs_file_system* fs,
+                                      rtems_rfs_buffer_block block,
+                                      size_t                 count,
+                                      void*                  data,
+                                      bool                   read);
 #endif
 
 /**
@@ -280,4 +301,27 @@ int rtems_rfs_buffer_setblksize (rtems_rfs_file_system* fs, uint32_t size);
  */
 int rtems_rfs_buffers_release (rtems_rfs_file_system* fs);
 
+/**
+ * Transfer a run of consecutive blocks directly between the media and a user
+ * buffer. The transfer bypasses the cache and the data is not copied. Buffers
+ * of the blocks held by the file system in the local cache are released
+ * before the transfer.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] block is the first block of the run.
+ * @param[in] count is the number of blocks in the run.
+ * @param[in] data is the user buffer of @a count blocks.
+ * @param[in] read is the transfer a read from the media if true else it is a
+ *                 write.
+ *
+ * @retval 0 Successful operation.
+ * @retval EBUSY A block of the run is attached to a buffer handle.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_buffer_direct (rtems_rfs_file_system* fs,
+                             rtems_rfs_buffer_block block,
+                             size_t                 count,
+                             void*                  data,
+                             bool                   read);
+
 #endif
@@ -22,6 +22,7 @@
 #define _RTEMS_RFS_FILE_SYSTEM_H_
 
 #include <rtems/rfs/rtems-rfs-group.h>
+#include <rtems/rfs/rtems-rfs-mutex.h>
 
 /**
  * Superblock offsets and values.
@@ -215,6 +216,13 @@ struct _rtems_rfs_file_system
    */
   uint32_t max_held_buffers;
 
+  /**
+   * Minimum number of bytes of a file read or write to transfer the whole
+   * blocks directly between the media and the user buffer. Zero disables the
+   * direct I/O.
+   */
+  size_t direct_io_threshold;
+
   /**
    * List of buffers attached to buffer handles. Allows sharing.
    */
@@ -253,6 +261,25 @@ struct _rtems_rfs_file_system
    */
   rtems_chain_control file_shares;
 
+  /**
+   * The lock of the group bitmaps. The bitmaps are shared by the I/O of all
+   * files.
+   */
+  rtems_rfs_mutex bitmap_lock;
+
+  /**
+   * The lock of the buffer lists and counts. It is the innermost lock. It is
+   * not held while a buffer is requested from the media.
+   */
+  rtems_rfs_mutex buffer_lock;
+
+  /**
+   * Signalled when a buffer requested from the media has arrived. A block in
+   * flight has a place holder on the buffers list so a block is never
+   * requested twice.
+   */
+  rtems_rfs_condition buffer_arrived;
+
   /**
    * Pointer to user data supplied when opening.
    */
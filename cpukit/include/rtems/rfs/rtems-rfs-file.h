@@ -84,6 +84,12 @@ typedef struct _rtems_rfs_file_shared
    */
   rtems_rfs_file_system* fs;
 
+  /**
+   * The lock of the file's I/O. It serialises the I/O of all handles of the
+   * file and allows the I/O of different files to run in parallel.
+   */
+  rtems_rfs_mutex lock;
+
 } rtems_rfs_file_shared;
 
 /**
@@ -342,6 +348,31 @@ int rtems_rfs_file_io_start (rtems_rfs_file_handle* handle,
                              size_t*                available,
                              bool                   read);
 
+/**
+ * Perform a direct I/O of whole blocks from the current position of a file
+ * straight between the media and the user buffer. The I/O bypasses the cache
+ * and is only done if the file system has direct I/O enabled, the size is at
+ * least the direct I/O threshold, the user buffer is aligned for direct
+ * transfers and the position is at the start of a block. A single run of
+ * consecutive blocks is transferred. A write grows the file as needed and
+ * releases the blocks grown but not transferred. The file position is not adjusted until the I/O ends with
+ * rtems_rfs_file_io_end.
+ *
+ * @param[in] handle is the file handle.
+ * @param[in] data is the user buffer.
+ * @param[in,out] size is the amount of data requested on entry and the
+ *                     amount of data transferred on return. Zero means the
+ *                     I/O has to be done through the cache.
+ * @param[in] read is the I/O operation is a read from the media.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_file_io_direct (rtems_rfs_file_handle* handle,
+                              void*                  data,
+                              size_t*                size,
+                              bool                   read);
+
 /**
  * End the I/O. Any buffers held in the file handle and returned to the
  * cache. If inode updating is not disable and the I/O is a read the atime
@@ -139,6 +139,26 @@ int rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
                                   bool                   inode,
                                   rtems_rfs_bitmap_bit*  result);
 
+/**
+ * @brief Allocate a run of contiguous blocks.
+ *
+ * The search for the first block is the same as a block allocated with
+ * rtems_rfs_group_bitmap_alloc. The run is extended with the free blocks
+ * following the first block in its group up to the count.
+ *
+ * @param fs The file system data.
+ * @param goal The goal to seed the bitmap search.
+ * @param count The maximum number of blocks to allocate.
+ * @param result The first block of the run.
+ * @param allocated The number of blocks in the run.
+ * @retval int The error number (errno). No error if 0.
+ */
+int rtems_rfs_group_bitmap_alloc_blocks (rtems_rfs_file_system* fs,
+                                         rtems_rfs_bitmap_bit   goal,
+                                         size_t                 count,
+                                         rtems_rfs_bitmap_bit*  result,
+                                         size_t*                allocated);
+
 /**
  * @brief Free the group allocated bit.
  *
@@ -96,4 +96,152 @@ rtems_rfs_mutex_unlock (rtems_rfs_mutex* mutex)
   return 0;
 }
 
+/**
+ * RFS condition variable type. A task waits on the condition variable with a
+ * locked RFS mutex.
+ */
+#if __rtems__
+typedef rtems_condition_variable rtems_rfs_condition;
+#else
+typedef uint32_t rtems_rfs_condition; /* place holder */
+#endif
+
+/**
+ * @brief Create the condition variable.
+ *
+ * @param[in] condition is pointer to the condition variable.
+ *
+ * @retval 0 Successful operation.
+ * @retval EIO An error occurred.
+ */
+int rtems_rfs_condition_create (rtems_rfs_condition* condition);
+
+/**
+ * @brief Destroy the condition variable.
+ *
+ * @param[in] condition is pointer to the condition variable.
+ *
+ * @retval 0 Successful operation.
+ * @retval EIO An error occurred.
+ */
+int rtems_rfs_condition_destroy (rtems_rfs_condition* condition);
+
+/**
+ * @brief Wait on the condition variable. The mutex is unlocked while waiting
+ * and locked again with its previous nest level before the return.
+ *
+ * @param[in] condition is a pointer to the condition variable.
+ * @param[in] mutex is a pointer to the mutex locked by the caller.
+ *
+ * @retval 0 Successful operation.
+ * @retval EIO An error occurred.
+ */
+static inline int
+rtems_rfs_condition_wait (rtems_rfs_condition* condition,
+                          rtems_rfs_mutex*     mutex)
+{
+#if __rtems__
+  _Condition_Wait_recursive (condition, mutex);
+#endif
+  return 0;
+}
+
+/**
+ * @brief Wake up all tasks waiting on the condition variable.
+ *
+ * @param[in] condition is a pointer to the condition variable.
+ *
+ * @retval 0 Successful operation.
+ * @retval EIO An error occurred.
+ */
+static inline int
+rtems_rfs_condition_broadcast (rtems_rfs_condition* condition)
+{
+#if __rtems__
+  rtems_condition_variable_broadcast (condition);
+#endif
+  return 0;
+}
+
+/**
+ * RFS reader/writer lock type. The lock is held exclusively by one owner,
+ * which may nest the exclusive lock, or is shared by any number of owners.
+ * Waiting exclusive owners block new shared owners.
+ */
+#if __rtems__
+typedef struct _rtems_rfs_rwlock
+{
+  rtems_mutex              mutex;
+  rtems_condition_variable changed;
+  uint32_t                 readers;
+  uint32_t                 writers_waiting;
+  uint32_t                 writer_nest;
+  rtems_id                 writer;
+} rtems_rfs_rwlock;
+#else
+typedef uint32_t rtems_rfs_rwlock; /* place holder */
+#endif
+
+/**
+ * @brief Create the reader/writer lock.
+ *
+ * @param[in] rwlock is pointer to the lock.
+ *
+ * @retval 0 Successful operation.
+ * @retval EIO An error occurred.
+ */
+int rtems_rfs_rwlock_create (rtems_rfs_rwlock* rwlock);
+
+/**
+ * @brief Destroy the reader/writer lock.
+ *
+ * @param[in] rwlock is pointer to the lock.
+ *
+ * @retval 0 Successful operation.
+ * @retval EIO An error occurred.
+ */
+int rtems_rfs_rwlock_destroy (rtems_rfs_rwlock* rwlock);
+
+/**
+ * @brief Lock the reader/writer lock exclusively. The exclusive owner may
+ * nest exclusive and shared locks.
+ *
+ * @param[in] rwlock is a pointer to the lock.
+ *
+ * @retval 0 Successful operation.
+ * @retval EIO An error occurred.
+ */
+int rtems_rfs_rwlock_lock (rtems_rfs_rwlock* rwlock);
+
+/**
+ * @brief Unlock the exclusively locked reader/writer lock.
+ *
+ * @param[in] rwlock is a pointer to the lock.
+ *
+ * @retval 0 Successful operation.
+ * @retval EIO An error occurred.
+ */
+int rtems_rfs_rwlock_unlock (rtems_rfs_rwlock* rwlock);
+
+/**
+ * @brief Lock the reader/writer lock shared. A shared owner must not nest the
+ * lock.
+ *
+ * @param[in] rwlock is a pointer to the lock.
+ *
+ * @retval 0 Successful operation.
+ * @retval EIO An error occurred.
+ */
+int rtems_rfs_rwlock_lock_shared (rtems_rfs_rwlock* rwlock);
+
+/**
+ * @brief Unlock the shared locked reader/writer lock.
+ *
+ * @param[in] rwlock is a pointer to the lock.
+ *
+ * @retval 0 Successful operation.
+ * @retval EIO An error occurred.
+ */
+int rtems_rfs_rwlock_unlock_shared (rtems_rfs_rwlock* rwlock);
+
 #endif
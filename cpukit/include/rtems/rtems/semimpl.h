@@ -134,6 +134,44 @@ RTEMS_INLINE_ROUTINE const Thread_queue_Operations *_Semaphore_Get_operations(
   return &_Thread_queue_Operations_FIFO;
 }
 
+/**
+ * @brief Indicates if the thread owns the semaphore without nested acquire
+ * operations.
+ *
+ * Only the mutex variants have an owner.  This is used to sample the hold
+ * time of the semaphore, see _Thread_queue_Stats_acquire().
+ *
+ * @param the_semaphore The semaphore.
+ * @param variant The semaphore variant.
+ * @param the_thread The thread.
+ *
+ * @retval true The thread owns the semaphore and the nest level is zero.
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Semaphore_Is_owner_not_nested(
+  const Semaphore_Control *the_semaphore,
+  Semaphore_Variant        variant,
+  const Thread_Control    *the_thread
+)
+{
+  switch ( variant ) {
+    case SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY:
+    case SEMAPHORE_VARIANT_MUTEX_PRIORITY_CEILING:
+    case SEMAPHORE_VARIANT_MUTEX_NO_PROTOCOL:
+      return _CORE_mutex_Get_owner(
+        &the_semaphore->Core_control.Mutex.Recursive.Mutex
+      ) == the_thread
+        && the_semaphore->Core_control.Mutex.Recursive.nest_level == 0;
+#if defined(RTEMS_SMP)
+    case SEMAPHORE_VARIANT_MRSP:
+      return _MRSP_Get_owner( &the_semaphore->Core_control.MRSP )
+        == the_thread;
+#endif
+    default:
+      return false;
+  }
+}
+
 /**
  *  @brief Allocates a semaphore control block from
  *  the inactive chain of free semaphore control blocks.
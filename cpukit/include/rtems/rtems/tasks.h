@@ -597,6 +597,23 @@ rtems_status_code rtems_task_wake_after(
   rtems_interval  ticks
 );
 
+/**
+ * @brief RTEMS Task Wake After Nanoseconds
+ *
+ * This routine implements the rtems_task_wake_after_ns directive.  The
+ * calling task is blocked until the indicated number of nanoseconds of the
+ * monotonic clock have elapsed.  A zero interval yields the processor.  The
+ * delay is only shorter than a clock tick if the clock driver provides a
+ * high resolution timer, otherwise the task is woken up by the clock tick
+ * which follows the end of the interval.
+ *
+ * @param[in] nanoseconds is the number of nanoseconds to wait
+ * @retval RTEMS_SUCCESSFUL
+ */
+rtems_status_code rtems_task_wake_after_ns(
+  uint64_t nanoseconds
+);
+
 /**
  *  @brief rtems_task_is_suspended
  *
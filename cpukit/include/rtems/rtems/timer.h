@@ -298,6 +298,78 @@ rtems_status_code rtems_timer_initiate_server(
  */
 #define RTEMS_TIMER_SERVER_DEFAULT_PRIORITY (uint32_t) -1
 
+/**
+ * @brief Initiates a timer server for each processor of a processor set.
+ *
+ * This directive creates and starts a server for task-based timers for each
+ * online processor of the processor set.  Each server task uses the scheduler
+ * instance which owns its processor and, if the scheduler supports it, an
+ * affinity to only this processor.  A task-based timer is serviced by the
+ * server of the processor which fired it.  Timers fired by a processor not in
+ * the set are serviced by the server of the first processor of the set.  It
+ * must be invoked instead of rtems_timer_initiate_server() and before any
+ * task-based timers can be initiated.
+ *
+ * @param priority The timer server task priority.
+ * @param stack_size The stack size in bytes for each timer server task.
+ * @param attribute_set The timer server task attributes.
+ * @param cpusetsize The size of the processor set in bytes.
+ * @param cpuset The processor set.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE The timer server is already initiated.
+ * @retval RTEMS_INVALID_ADDRESS The processor set is @c NULL.
+ * @retval RTEMS_INVALID_NUMBER The processor set contains no online
+ *   processor.
+ * @retval RTEMS_NO_MEMORY Not enough memory for the timer servers.
+ * @return Other status codes of the task create and set scheduler
+ *   directives.
+ */
+rtems_status_code rtems_timer_initiate_server_set(
+  rtems_task_priority  priority,
+  size_t               stack_size,
+  rtems_attribute      attribute_set,
+  size_t               cpusetsize,
+  const cpu_set_t     *cpuset
+);
+
+/**
+ * @brief Timer server statistics.
+ */
+typedef struct {
+  /** This indicates the count of serviced timers. */
+  uint64_t count;
+  /**
+   * This indicates the sum of the latencies in nanoseconds from the timer
+   * expiration to the invocation of the timer service routine.
+   */
+  uint64_t total_latency;
+  /** This indicates the maximum latency in nanoseconds. */
+  uint64_t max_latency;
+  /**
+   * This indicates the maximum execution time of a timer service routine in
+   * nanoseconds.
+   */
+  uint64_t max_runtime;
+} rtems_timer_server_statistics;
+
+/**
+ * @brief Gets the statistics of the timer server of a processor.
+ *
+ * @param cpu_index The index of the processor.
+ * @param[out] statistics The statistics of the timer server which services
+ *   the timers fired by this processor.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The statistics pointer is @c NULL.
+ * @retval RTEMS_INVALID_NUMBER The processor index is invalid.
+ * @retval RTEMS_INCORRECT_STATE The timer server is not initiated.
+ */
+rtems_status_code rtems_timer_server_get_statistics(
+  uint32_t                       cpu_index,
+  rtems_timer_server_statistics *statistics
+);
+
 /**
  *  This is the structure filled in by the timer get information
  *  service.
@@ -55,6 +55,13 @@ typedef struct {
   Watchdog_Interval start_time;
   /** This field is the timer stop time point in ticks. */
   Watchdog_Interval stop_time;
+  /**
+   * This field is the timer server of a task-based timer.  It is the timer
+   * server of the processor which fired the timer.
+   */
+  struct Timer_server_Control *server;
+  /** This field is the CPU counter value when a task-based timer expired. */
+  CPU_Counter_ticks expire_instant;
 }   Timer_Control;
 
 /**
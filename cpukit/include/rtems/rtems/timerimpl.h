@@ -43,6 +43,14 @@ typedef struct Timer_server_Control {
   Chain_Control Pending;
 
   Objects_Id server_id;
+
+  /**
+   * @brief The statistics of this timer server.
+   *
+   * The latencies and runtimes are in CPU counter ticks.  This member is
+   * protected by the timer server lock.
+   */
+  rtems_timer_server_statistics Statistics;
 } Timer_server_Control;
 
 /**
@@ -52,6 +60,37 @@ typedef struct Timer_server_Control {
  */
 extern Timer_server_Control *volatile _Timer_server;
 
+/**
+ * @brief The timer server of each processor.
+ *
+ * This value is @c NULL unless the timer servers were initiated with
+ * rtems_timer_initiate_server_set().  It is set before _Timer_server.
+ */
+extern Timer_server_Control **_Timer_server_Processors;
+
+/**
+ * @brief Gets the timer server which services the timers fired by the
+ * processor.
+ *
+ * @param cpu The processor.
+ *
+ * @return The timer server.
+ */
+RTEMS_INLINE_ROUTINE Timer_server_Control *_Timer_server_Get(
+  const Per_CPU_Control *cpu
+)
+{
+  Timer_server_Control **processors;
+
+  processors = _Timer_server_Processors;
+
+  if ( processors != NULL ) {
+    return processors[ _Per_CPU_Get_index( cpu ) ];
+  }
+
+  return _Timer_server;
+}
+
 /**
  *  @brief Timer_Allocate
  *
@@ -67,6 +67,9 @@ typedef struct rtems_rtl_archive_symbol
 {
   size_t      entry;  /**< Index in the symbol offset table. */
   const char* label;  /**< The symbol's label. */
+  uint32_t    hash;   /**< The hash of the label. */
+  uint32_t    next;   /**< The next symbol in the hash bucket plus one, 0 ends
+                       *   the bucket. */
 } rtems_rtl_archive_symbol;
 
 /**
@@ -78,7 +81,10 @@ typedef struct rtems_rtl_archive_symbols
   size_t                    size;     /**< Size of the symbol table. */
   size_t                    entries;  /**< Entries in the symbol table. */
   const char*               names;    /**< Start of the symbol names. */
-  rtems_rtl_archive_symbol* symbols;  /**< Sorted symbol table. */
+  rtems_rtl_archive_symbol* symbols;  /**< Hashed symbol table. */
+  uint32_t*                 buckets;  /**< The first symbol plus one in each
+                                       *   hash bucket. */
+  size_t                    nbuckets; /**< The number of hash buckets. */
 } rtems_rtl_archive_symbols;
 
 /**
@@ -33,6 +33,11 @@
  *
  * You can have more than one cache for a single file all looking at different
  * parts of the file.
+ *
+ * A file held in memory, for example a file of a tar image loaded into the
+ * IMFS, is not copied into the buffer. If the file system can map the file
+ * the cache references the file's data in place and reads by reference are
+ * not limited by the cache's size.
  */
 
 #if !defined (_RTEMS_RTL_OBJ_CACHE_H_)
@@ -52,13 +57,16 @@ extern "C" {
  */
 typedef struct rtems_rtl_obj_cache
 {
-  int      fd;        /**< The file descriptor of the data in the cache. */
-  size_t   file_size; /**< The size of the file. */
-  off_t    offset;    /**< The base offset of the buffer. */
-  size_t   size;      /**< The size of the cache. */
-  size_t   level;     /**< The amount of data in the cache. A file can be
-                       * smaller than the cache file. */
-  uint8_t* buffer;    /**< The buffer */
+  int            fd;        /**< The file descriptor of the data in the
+                             * cache. */
+  size_t         file_size; /**< The size of the file. */
+  off_t          offset;    /**< The base offset of the buffer. */
+  size_t         size;      /**< The size of the cache. */
+  size_t         level;     /**< The amount of data in the cache. A file can
+                             * be smaller than the cache file. */
+  uint8_t*       buffer;    /**< The buffer */
+  const uint8_t* mem;       /**< The file's data if the file is held in
+                             * memory else NULL. */
 } rtems_rtl_obj_cache;
 
 /**
@@ -89,7 +97,8 @@ void rtems_rtl_obj_cache_flush (rtems_rtl_obj_cache* cache);
 /**
  * Read data by reference. The length contains the amount of data that should
  * be available in the cache and referenced by the buffer handle. It must be
- * less than or equal to the size of the cache. This call will return the
+ * less than or equal to the size of the cache unless the file is held in
+ * memory. This call will return the
  * amount of data that is available. It can be less than you ask if the offset
  * and size is past the end of the file.
  *
@@ -125,6 +134,25 @@ bool rtems_rtl_obj_cache_read_byval (rtems_rtl_obj_cache* cache,
                                      void*                buffer,
                                      size_t               length);
 
+/**
+ * Reference the data of a file held in memory in place. Nothing is read if
+ * the file is not held in memory.
+ *
+ * @param cache The cache the file is referenced through.
+ * @param fd The file descriptor. Must be an open file.
+ * @param offset The offset in the file of the data.
+ * @param buffer The location of the data in memory.
+ * @param length The length of the data.
+ * @retval true The data is held in memory and referenced by the buffer.
+ * @retval false The file is not held in memory or the data is not in the
+ *               file. Read the data from the file.
+ */
+bool rtems_rtl_obj_cache_mapped (rtems_rtl_obj_cache* cache,
+                                 int                  fd,
+                                 off_t                offset,
+                                 const void**         buffer,
+                                 size_t               length);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -87,6 +87,15 @@ bool rtems_rtl_symbol_global_add (rtems_rtl_obj*       obj,
                                   const unsigned char* esyms,
                                   unsigned int         size);
 
+/**
+ * Hash a symbol label. The hash is used to index the global symbol table, the
+ * archive symbol tables and the unresolved symbol names.
+ *
+ * @param s The label as an ASCIIZ string.
+ * @return uint_fast32_t The 32bit hash of the label.
+ */
+uint_fast32_t rtems_rtl_symbol_hash (const char *s);
+
 /**
  * Find a symbol given the symbol label in the global symbol table.
  *
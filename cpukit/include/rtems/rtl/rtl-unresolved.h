@@ -24,10 +24,13 @@
  * relocations are resolved and removed the table is compacted. The only
  * pointer in the table is the object file poniter. This is used to identify
  * which object the relocation belongs to. There are no linking or back
- * pointers in the unresolved relocations table. The table is scanned for each
- * object file's relocations. This is not fast but the table should be small
- * and if it happens to grow large you have other more pressing issues to
- * resolve in your application.
+ * pointers in the unresolved relocations table.
+ *
+ * The symbol names are indexed. Each name has an identifier that does not
+ * change while the name is in the table. The index finds a name's record by
+ * its identifier and by the hash of the name. Adding a relocation finds the
+ * name in the index and resolving the symbols looks up each name once and
+ * then scans the table once to fix up the relocation records.
  *
  * The table holds two (2) types of records:
  *
@@ -39,7 +42,7 @@
  * counts the number of references and the string is removed from the table
  * when the reference count reaches 0. There can be many relocations
  * referencing the symbol. The strings are referenced by a single 16bit
- * unsigned integer which is the count of the string in the table.
+ * unsigned integer which is the identifier of the string in the index.
  *
  * The section the relocation is for in the object is the section number. The
  * relocation data is series of machine word sized fields:
@@ -97,6 +100,7 @@ typedef struct rtems_rtl_unresolv_symbol
   uint16_t   refs;     /**< The number of references to this name. */
   uint16_t   flags;    /**< Flags to manage the symbol. */
   uint16_t   length;   /**< The length of this name. */
+  uint16_t   id;       /**< The identifier of this name. */
   const char name[];   /**< The symbol name. */
 } rtems_rtl_unresolv_symbol;
 
@@ -149,14 +153,34 @@ typedef struct rtems_rtl_unresolv_block
   rtems_rtl_unresolv_rec rec[]; /**< The records. More follow. */
 } rtems_rtl_unresolv_block;
 
+/**
+ * Unresolved symbol name index. The identifier 0 is not used and ends a hash
+ * bucket. There is a hash bucket for each identifier.
+ */
+typedef struct rtems_rtl_unresolv_index
+{
+  rtems_rtl_unresolv_rec**   names;   /**< The name record of each identifier,
+                                       *   NULL if not used. */
+  struct rtems_rtl_obj_sym** syms;    /**< The symbol each name resolves to
+                                       *   while resolving. */
+  uint16_t*                  buckets; /**< The first identifier in each hash
+                                       *   bucket. */
+  uint16_t*                  next;    /**< The next identifier in the hash
+                                       *   bucket. */
+  size_t                     size;    /**< The number of identifiers. */
+  size_t                     free;    /**< The lowest possibly free
+                                       *   identifier. */
+} rtems_rtl_unresolv_index;
+
 /**
  * Unresolved table holds the names and relocations.
  */
 typedef struct rtems_rtl_unresolved
 {
-  uint32_t            marker;     /**< Block marker. */
-  size_t              block_recs; /**< The records per blocks allocated. */
-  rtems_chain_control blocks;     /**< List of blocks. */
+  uint32_t                 marker;     /**< Block marker. */
+  size_t                   block_recs; /**< The records per blocks allocated. */
+  rtems_chain_control      blocks;     /**< List of blocks. */
+  rtems_rtl_unresolv_index index;      /**< The symbol name index. */
 } rtems_rtl_unresolved;
 
 /**
@@ -118,6 +118,9 @@ struct rtems_rtl_data
   rtems_rtl_obj_cache   strings;        /**< Strings object file cache. */
   rtems_rtl_obj_cache   relocs;         /**< Relocations object file cache. */
   rtems_rtl_obj_comp    decomp;         /**< The decompression compressor. */
+  const char*           reloc_cache;    /**< The relocation cache directory. */
+  uint64_t              base_hash;      /**< The hash of the base image's
+                                         *   symbol table, 0 if not known. */
   int                   last_errno;     /**< Last error number. */
   char                  last_error[64]; /**< Last error string. */
 };
@@ -367,6 +370,20 @@ bool rtems_rtl_path_append (const char* path);
 
 bool rtems_rtl_path_prepend (const char* path);
 
+/**
+ * Set the directory of the relocation cache files. The relocation cache holds
+ * the base image symbols the relocation records of an object file resolve
+ * to. An object file loaded again with the same base image resolves these
+ * symbols from its cache file instead of searching the global symbol table.
+ * The directory must exist and be writable to create the cache files.
+ *
+ * @param path The directory of the cache files. NULL disables the relocation
+ *             cache.
+ * @retval false The path could not be set.
+ * @retval true The path was set.
+ */
+bool rtems_rtl_reloc_cache_set_path (const char* path);
+
 /**
  * Add an exported symbol table to the global symbol table. This call is
  * normally used by an object file when loaded that contains a global symbol
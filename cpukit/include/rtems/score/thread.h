@@ -713,6 +713,48 @@ typedef struct  {
   void *        control;
 }Thread_Capture_control;
 
+/**
+ * @brief The stack usage of a thread tracked by the stack checker in the
+ * watermark mode.
+ *
+ * It is placed in the thread control block by <rtems/confdefs.h> only if the
+ * watermark mode is configured, see _Thread_Stack_check_offset.
+ */
+typedef struct {
+  /**
+   * @brief The highest stack usage seen so far in bytes.
+   */
+  size_t used;
+} Thread_Stack_check_control;
+
+/**
+ * @brief The processor performance counters accumulated by a thread.
+ *
+ * The counters are updated by the CPU usage counters thread switch extension
+ * each time the thread leaves a processor.  They are placed in the thread
+ * control block by <rtems/confdefs.h> only if the CPU usage counters are
+ * configured, see _Thread_Performance_counters_offset.
+ */
+typedef struct {
+  /**
+   * @brief The processor cycles used by the thread.
+   *
+   * In case the processor has no cycle counter, then this is the CPU counter
+   * ticks used by the thread.
+   */
+  uint64_t cycles;
+
+  /**
+   * @brief The instructions retired by the thread.
+   */
+  uint64_t instructions;
+
+  /**
+   * @brief The data cache misses caused by the thread.
+   */
+  uint64_t cache_misses;
+} Thread_Performance_counters;
+
 /**
  *  This structure defines the Thread Control Block (TCB).
  *
@@ -929,6 +971,30 @@ extern const Thread_Control_add_on _Thread_Control_add_ons[];
  */
 extern const size_t _Thread_Control_add_on_count;
 
+/**
+ * @brief Offset of the stack checker watermark control relative to the thread
+ * control block begin.
+ *
+ * The offset is zero if the stack checker watermark mode is not configured.
+ *
+ * This value is provided via <rtems/confdefs.h>.
+ *
+ * @see Thread_Stack_check_control.
+ */
+extern const size_t _Thread_Stack_check_offset;
+
+/**
+ * @brief Offset of the CPU usage performance counters relative to the thread
+ * control block begin.
+ *
+ * The offset is zero if the CPU usage counters are not configured.
+ *
+ * This value is provided via <rtems/confdefs.h>.
+ *
+ * @see Thread_Performance_counters.
+ */
+extern const size_t _Thread_Performance_counters_offset;
+
 /**
  * @brief Count of configured threads.
  *
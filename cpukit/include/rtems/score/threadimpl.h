@@ -2405,6 +2405,33 @@ RTEMS_INLINE_ROUTINE void _Thread_Add_timeout_ticks(
   _ISR_lock_Release_and_ISR_enable( &the_thread->Timer.Lock, &lock_context );
 }
 
+/**
+ * @brief Adds a monotonic timeout to the thread.
+ *
+ * @param[in, out] the_thread The thread to add the timeout to.
+ * @param cpu The cpu to get the watchdog header from.
+ * @param expire The expiration time of the timeout in the monotonic watchdog
+ *   time format.
+ */
+RTEMS_INLINE_ROUTINE void _Thread_Add_timeout_monotonic(
+  Thread_Control  *the_thread,
+  Per_CPU_Control *cpu,
+  uint64_t         expire
+)
+{
+  ISR_lock_Context  lock_context;
+  Watchdog_Header  *header;
+
+  _ISR_lock_ISR_disable_and_acquire( &the_thread->Timer.Lock, &lock_context );
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
+  the_thread->Timer.header = header;
+  the_thread->Timer.Watchdog.routine = _Thread_Timeout;
+  _Watchdog_Per_CPU_insert( &the_thread->Timer.Watchdog, cpu, header, expire );
+
+  _ISR_lock_Release_and_ISR_enable( &the_thread->Timer.Lock, &lock_context );
+}
+
 /**
  * @brief Inserts the cpu's watchdog realtime into the thread's timer.
  *
@@ -190,6 +190,68 @@ typedef struct {
 } Thread_queue_Link;
 #endif
 
+#if defined(RTEMS_PROFILING)
+/**
+ * @brief Contention statistics of an object using a thread queue.
+ *
+ * The statistics are embedded in the thread queue control and protected by
+ * the thread queue lock.  The layout of self-contained objects is fixed by the
+ * C library, so their statistics are kept in a table indexed by the object
+ * address, see _Thread_queue_Stats_acquire_self_contained().
+ *
+ * @see _Thread_queue_Stats_acquire() and _Thread_queue_Stats_release().
+ */
+typedef struct {
+  /**
+   * @brief Indicates if the object is held by an owner and the hold instant
+   * is valid.
+   */
+  bool held;
+
+  /**
+   * @brief The count of successful acquire operations.
+   */
+  uint64_t acquire_count;
+
+  /**
+   * @brief The count of successful acquire operations which blocked the
+   * acquiring thread.
+   */
+  uint64_t contention_count;
+
+  /**
+   * @brief The total wait time of contended acquire operations in CPU counter
+   * ticks.
+   */
+  uint64_t total_wait_time;
+
+  /**
+   * @brief The total time the object was held by its owner in CPU counter
+   * ticks.
+   *
+   * Only objects with an owner, for example mutexes, have a hold time.
+   */
+  uint64_t total_hold_time;
+
+  /**
+   * @brief The maximum wait time of a contended acquire operation in CPU
+   * counter ticks.
+   */
+  CPU_Counter_ticks max_wait_time;
+
+  /**
+   * @brief The maximum time the object was held by its owner in CPU counter
+   * ticks.
+   */
+  CPU_Counter_ticks max_hold_time;
+
+  /**
+   * @brief The instant of the last outermost acquire operation of the owner.
+   */
+  CPU_Counter_ticks hold_instant;
+} Thread_queue_Stats;
+#endif
+
 /**
  * @brief Thread queue context for the thread queue methods.
  *
@@ -316,6 +378,25 @@ struct Thread_queue_Context {
    */
   Thread_queue_MP_callout mp_callout;
 #endif
+
+#if defined(RTEMS_PROFILING)
+  /**
+   * @brief Indicates if the thread was enqueued by _Thread_queue_Enqueue().
+   *
+   * This field is only used on profiling configurations.
+   */
+  bool enqueued;
+
+  /**
+   * @brief The instant of the enqueue operation if the enqueued indicator is
+   * set.
+   *
+   * This field is only used on profiling configurations.
+   *
+   * @see _Thread_queue_Stats_acquire().
+   */
+  CPU_Counter_ticks enqueue_instant;
+#endif
 };
 
 /**
@@ -581,6 +662,15 @@ typedef struct {
    * @brief The actual thread queue.
    */
   Thread_queue_Queue Queue;
+
+#if defined(RTEMS_PROFILING)
+  /**
+   * @brief The contention statistics of the object using this thread queue.
+   *
+   * The statistics are protected by the thread queue lock.
+   */
+  Thread_queue_Stats Stats;
+#endif
 } Thread_queue_Control;
 
 /** @} */
@@ -160,7 +160,11 @@ RTEMS_INLINE_ROUTINE void _Thread_queue_Context_initialize(
 #endif
   queue_context->enqueue_callout = NULL;
   queue_context->deadlock_callout = NULL;
-#else
+#endif
+#if defined(RTEMS_PROFILING)
+  queue_context->enqueued = false;
+#endif
+#if !defined(RTEMS_DEBUG) && !defined(RTEMS_PROFILING)
   (void) queue_context;
 #endif
 }
@@ -1495,6 +1499,241 @@ void _Thread_queue_Object_initialize(
   Thread_queue_Control *the_thread_queue
 );
 
+#if defined(RTEMS_PROFILING)
+/**
+ * @brief The count of entries in the contention statistics table of
+ * self-contained objects.
+ *
+ * Acquire operations of objects which do not fit into the table are counted,
+ * see _Thread_queue_Stats_get_overflows().
+ */
+#define THREAD_QUEUE_STATS_COUNT 256
+
+/**
+ * @brief Records a successful acquire operation in the contention statistics.
+ *
+ * Use _Thread_queue_Stats_acquire() instead.
+ *
+ * @param stats The contention statistics.
+ * @param queue_context The thread queue context of the acquire operation.
+ * @param hold Indicates if this was the outermost acquire operation of the
+ *   new owner of the object.
+ */
+void _Thread_queue_Stats_record_acquire(
+  Thread_queue_Stats         *stats,
+  const Thread_queue_Context *queue_context,
+  bool                        hold
+);
+
+/**
+ * @brief Records the outermost release operation of the owner in the
+ * contention statistics.
+ *
+ * Use _Thread_queue_Stats_release() instead.
+ *
+ * @param stats The contention statistics.
+ */
+void _Thread_queue_Stats_record_release( Thread_queue_Stats *stats );
+
+/**
+ * @brief Records a successful acquire operation of a self-contained object.
+ *
+ * Use _Thread_queue_Stats_acquire_self_contained() instead.
+ *
+ * @param queue The thread queue of the object.
+ * @param object The object address.
+ * @param queue_context The thread queue context of the acquire operation.
+ * @param hold Indicates if this was the outermost acquire operation of the
+ *   new owner of the object.
+ */
+void _Thread_queue_Stats_record_acquire_self_contained(
+  Thread_queue_Queue         *queue,
+  const void                 *object,
+  const Thread_queue_Context *queue_context,
+  bool                        hold
+);
+
+/**
+ * @brief Records the outermost release operation of the owner of a
+ * self-contained object.
+ *
+ * Use _Thread_queue_Stats_release_self_contained() instead.
+ *
+ * @param object The object address.
+ */
+void _Thread_queue_Stats_record_release_self_contained( const void *object );
+
+/**
+ * @brief Removes the contention statistics of a self-contained object.
+ *
+ * Use _Thread_queue_Stats_remove_self_contained() instead.
+ *
+ * @param object The object address.
+ */
+void _Thread_queue_Stats_record_remove_self_contained( const void *object );
+
+/**
+ * @brief Gets a snapshot of a contention statistics table entry of
+ * self-contained objects.
+ *
+ * The snapshot is consistent, however, the entry is not locked and may
+ * change right after the snapshot.
+ *
+ * @param index The table index.
+ * @param[out] object The object address of the table entry.
+ * @param[out] snapshot The snapshot of the table entry.
+ *
+ * @retval true The table entry is used by an object.
+ * @retval false Otherwise.
+ */
+bool _Thread_queue_Stats_get_self_contained(
+  size_t              index,
+  const void        **object,
+  Thread_queue_Stats *snapshot
+);
+
+/**
+ * @brief Gets the count of acquire operations of self-contained objects
+ * which were not recorded since the contention statistics table was full.
+ *
+ * @return The overflow count.
+ */
+uint64_t _Thread_queue_Stats_get_overflows( void );
+#endif
+
+/**
+ * @brief Updates the contention statistics after a successful acquire
+ * operation.
+ *
+ * The caller must own the lock of the thread queue containing the
+ * statistics.  The wait time is sampled by _Thread_queue_Enqueue() through
+ * the thread queue context.  This function does nothing on configurations
+ * without profiling.
+ *
+ * @param the_thread_queue The thread queue of the object.
+ * @param queue_context The thread queue context of the acquire operation.
+ * @param hold Indicates if this was the outermost acquire operation of the
+ *   new owner of the object.  This starts the hold time.
+ */
+RTEMS_INLINE_ROUTINE void _Thread_queue_Stats_acquire(
+  Thread_queue_Control       *the_thread_queue,
+  const Thread_queue_Context *queue_context,
+  bool                        hold
+)
+{
+#if defined(RTEMS_PROFILING)
+  _Thread_queue_Stats_record_acquire(
+    &the_thread_queue->Stats,
+    queue_context,
+    hold
+  );
+#else
+  (void) the_thread_queue;
+  (void) queue_context;
+  (void) hold;
+#endif
+}
+
+/**
+ * @brief Updates the contention statistics before the outermost release
+ * operation of the owner.
+ *
+ * The caller must own the lock of the thread queue containing the
+ * statistics.  This ends the hold time.  This function does nothing on
+ * configurations without profiling.
+ *
+ * @param the_thread_queue The thread queue of the object.
+ */
+RTEMS_INLINE_ROUTINE void _Thread_queue_Stats_release(
+  Thread_queue_Control *the_thread_queue
+)
+{
+#if defined(RTEMS_PROFILING)
+  _Thread_queue_Stats_record_release( &the_thread_queue->Stats );
+#else
+  (void) the_thread_queue;
+#endif
+}
+
+/**
+ * @brief Updates the contention statistics of a self-contained object after a
+ * successful acquire operation.
+ *
+ * The thread queue lock of the object must not be owned by the caller, this
+ * function acquires it.  This function does nothing on configurations without
+ * profiling.
+ *
+ * @param queue The thread queue of the object.
+ * @param object The object address.
+ * @param queue_context The thread queue context of the acquire operation.
+ * @param hold Indicates if this was the outermost acquire operation of the
+ *   new owner of the object.  This starts the hold time.
+ */
+RTEMS_INLINE_ROUTINE void _Thread_queue_Stats_acquire_self_contained(
+  Thread_queue_Queue         *queue,
+  const void                 *object,
+  const Thread_queue_Context *queue_context,
+  bool                        hold
+)
+{
+#if defined(RTEMS_PROFILING)
+  _Thread_queue_Stats_record_acquire_self_contained(
+    queue,
+    object,
+    queue_context,
+    hold
+  );
+#else
+  (void) queue;
+  (void) object;
+  (void) queue_context;
+  (void) hold;
+#endif
+}
+
+/**
+ * @brief Updates the contention statistics of a self-contained object before
+ * the outermost release operation of the owner.
+ *
+ * The caller must own the thread queue lock of the object.  This function
+ * does nothing on configurations without profiling.
+ *
+ * @param object The object address.
+ */
+RTEMS_INLINE_ROUTINE void _Thread_queue_Stats_release_self_contained(
+  const void *object
+)
+{
+#if defined(RTEMS_PROFILING)
+  _Thread_queue_Stats_record_release_self_contained( object );
+#else
+  (void) object;
+#endif
+}
+
+/**
+ * @brief Removes the contention statistics of a destroyed or initialized
+ * self-contained object.
+ *
+ * An object which is never destroyed keeps its table entry, so the
+ * initialization removes the statistics of a previous object at the same
+ * address.  The caller must own the thread queue lock of the object or have
+ * exclusive access to it, for example during the initialization.  This
+ * function does nothing on configurations without profiling.
+ *
+ * @param object The object address.
+ */
+RTEMS_INLINE_ROUTINE void _Thread_queue_Stats_remove_self_contained(
+  const void *object
+)
+{
+#if defined(RTEMS_PROFILING)
+  _Thread_queue_Stats_record_remove_self_contained( object );
+#else
+  (void) object;
+#endif
+}
+
 /** @} */
 
 #ifdef __cplusplus
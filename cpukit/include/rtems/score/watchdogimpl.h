@@ -139,6 +139,83 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Header_destroy(
  */
 void _Watchdog_Tick( struct Per_CPU_Control *cpu );
 
+/**
+ * @brief Gets the count of clock ticks until the first watchdog of the
+ * processor expires.
+ *
+ * This is used by clock drivers with a dynamic tick to determine how many
+ * clock ticks an idle processor may skip.
+ *
+ * @param cpu The processor to get the count of clock ticks of.
+ * @param maximum The maximum count of clock ticks to return.  It must be
+ *   greater than zero.
+ *
+ * @return The count of clock ticks until the tick which expires the first
+ *   watchdog of the processor, at least one and at most @a maximum.
+ */
+uint32_t _Watchdog_Ticks_until_expiry(
+  struct Per_CPU_Control *cpu,
+  uint32_t                maximum
+);
+
+/**
+ * @brief Accounts for clock ticks skipped by the processor.
+ *
+ * This is used by clock drivers with a dynamic tick.  The tick count of the
+ * processor and, on the boot processor, the ticks since boot are advanced by
+ * @a skipped.  No watchdog is serviced, this is done by the following
+ * _Watchdog_Tick().
+ *
+ * @param cpu The processor which skipped the clock ticks.
+ * @param skipped The count of skipped clock ticks.
+ */
+void _Watchdog_Skip_ticks( struct Per_CPU_Control *cpu, uint32_t skipped );
+
+/**
+ * @brief The high resolution timer handler.
+ *
+ * A clock driver with a one-shot timer sets this handler to let the
+ * monotonic watchdogs expire at their expiration time instead of at the next
+ * clock tick.  The handler programs the timer interrupt of the current
+ * processor to occur at most the specified nanoseconds from now.  The clock
+ * driver calls _Watchdog_High_resolution_tick() in this interrupt.  This
+ * handler is @c NULL by default.
+ */
+extern void ( *_Watchdog_High_resolution_handler )( uint64_t nanoseconds );
+
+/**
+ * @brief Programs the high resolution timer for the first monotonic watchdog
+ * of the processor.
+ *
+ * The watchdog lock of the processor must be acquired and the processor must
+ * be the current processor.  Nothing is done if no high resolution timer
+ * handler is set.
+ *
+ * @param cpu The current processor.
+ */
+void _Watchdog_High_resolution_program( struct Per_CPU_Control *cpu );
+
+/**
+ * @brief Programs the high resolution timer for the first monotonic watchdog
+ * of the processor.
+ *
+ * This variant acquires the watchdog lock of the processor.
+ *
+ * @param cpu The current processor.
+ */
+void _Watchdog_High_resolution_update( struct Per_CPU_Control *cpu );
+
+/**
+ * @brief Performs a high resolution timer tick.
+ *
+ * The monotonic watchdogs of the processor which expired with respect to the
+ * current uptime are serviced and the high resolution timer is programmed for
+ * the next monotonic watchdog.
+ *
+ * @param cpu The current processor.
+ */
+void _Watchdog_High_resolution_tick( struct Per_CPU_Control *cpu );
+
 /**
  * @brief Gets the state of the watchdog.
  *
@@ -635,6 +712,21 @@ RTEMS_INLINE_ROUTINE uint64_t _Watchdog_Per_CPU_insert(
 
   _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
   _Watchdog_Insert( header, the_watchdog, expire );
+
+  /*
+   * A new first monotonic watchdog may expire before the high resolution
+   * timer interrupt.  A watchdog of another processor is serviced by its next
+   * clock tick at the latest.
+   */
+  if (
+    _Watchdog_High_resolution_handler != NULL
+      && header->first == &the_watchdog->Node.RBTree
+      && header == &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ]
+      && cpu == _Per_CPU_Get()
+  ) {
+    _Watchdog_High_resolution_program( cpu );
+  }
+
   _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
   return expire;
 }
@@ -41,9 +41,25 @@ extern "C" {
  */
 /**@{**/
 
+/**
+ * @brief Sparse disk key.
+ *
+ * The keys form a hash table with one bucket for each key.  The bucket and
+ * next members are key indices plus one, zero marks the end of a chain.
+ */
 typedef struct {
   rtems_blkdev_bnum  block;
   void              *data;
+
+  /**
+   * @brief First key of the hash bucket with the index of this key.
+   */
+  rtems_blkdev_bnum  bucket;
+
+  /**
+   * @brief Next key in the hash bucket of this key.
+   */
+  rtems_blkdev_bnum  next;
 } rtems_sparse_disk_key;
 
 typedef struct rtems_sparse_disk rtems_sparse_disk;
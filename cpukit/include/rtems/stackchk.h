@@ -24,6 +24,8 @@
 #include <stdbool.h> /* bool */
 
 #include <rtems/score/thread.h> /* Thread_Control */
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/types.h>
 #include <rtems/print.h>
 
 /**
@@ -73,6 +75,39 @@ void rtems_stack_checker_report_usage_with_plugin(
   const rtems_printer *printer
 );
 
+/**
+ * @brief Gets the stack usage of a task.
+ *
+ * With CONFIGURE_STACK_CHECKER_WATERMARK the stack usage is tracked by the
+ * context switch extension and this is a constant time operation, else the
+ * stack of the task is scanned for the fill pattern.  The stack usage in the
+ * watermark mode is a lower bound with a resolution of
+ * RTEMS_STACK_CHECKER_WATERMARK_STRIDE bytes below the stack pointers seen.
+ *
+ * The stack is examined with interrupts enabled while the object allocator
+ * lock is owned, so this directive may be called only from task context.
+ *
+ * @param id The task identifier.  RTEMS_SELF is the executing task.
+ * @param[out] used The highest stack usage of the task in bytes.
+ * @param[out] size The usable stack size of the task in bytes.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The used or size parameter is NULL.
+ * @retval RTEMS_INVALID_ID Invalid task identifier.
+ * @retval RTEMS_NOT_CONFIGURED The stack checker is not enabled.
+ */
+rtems_status_code rtems_stack_checker_get_usage(
+  rtems_id  id,
+  size_t   *used,
+  size_t   *size
+);
+
+/**
+ * @brief The distance in bytes of the guard words placed in the stack of a
+ * task in the watermark mode.
+ */
+#define RTEMS_STACK_CHECKER_WATERMARK_STRIDE 1024
+
 /*************************************************************
  *************************************************************
  **  Prototyped only so the user extension can be installed **
@@ -95,6 +130,21 @@ bool rtems_stack_checker_create_extension(
   Thread_Control *the_thread
 );
 
+/**
+ * @brief Stack Checker Task Create Extension of the Watermark Mode
+ *
+ * Instead of filling the entire stack only the sanity pattern and a guard
+ * word each RTEMS_STACK_CHECKER_WATERMARK_STRIDE bytes are placed in the
+ * stack.
+ *
+ * @param[in] running points to the currently executing task
+ * @param[in] the_thread points to the newly created task
+ */
+bool rtems_stack_checker_watermark_create_extension(
+  Thread_Control *running,
+  Thread_Control *the_thread
+);
+
 void rtems_stack_checker_begin_extension( Thread_Control *executing );
 
 /**
@@ -113,6 +163,22 @@ void rtems_stack_checker_switch_extension(
   Thread_Control *heir
 );
 
+/**
+ * @brief Stack Checker Task Context Switch Extension of the Watermark Mode
+ *
+ * In addition to the checks of rtems_stack_checker_switch_extension() this
+ * extension updates the stack usage of the task using the processor stack
+ * from the stack pointer and the next guard word.
+ *
+ * @param[in] running points to the currently executing task which
+ *            is being context switched out
+ * @param[in] running points to the heir task which we are switching to
+ */
+void rtems_stack_checker_watermark_switch_extension(
+  Thread_Control *running,
+  Thread_Control *heir
+);
+
 /**
  *  @brief Stack Checker Extension Set Definition
  *
@@ -132,6 +198,26 @@ void rtems_stack_checker_switch_extension(
   0                                            /* terminate    */ \
 }
 
+/**
+ *  @brief Stack Checker Watermark Mode Extension Set Definition
+ *
+ *  This macro defines the user extension handler set for the stack
+ *  checker in the watermark mode.  This macro is normally only used by
+ *  confdefs.h.
+ */
+#define RTEMS_STACK_CHECKER_WATERMARK_EXTENSION \
+{ \
+  rtems_stack_checker_watermark_create_extension, /* rtems_task_create  */ \
+  0,                                           /* rtems_task_start   */ \
+  0,                                           /* rtems_task_restart */ \
+  0,                                           /* rtems_task_delete  */ \
+  rtems_stack_checker_watermark_switch_extension, /* task_switch  */ \
+  rtems_stack_checker_begin_extension,         /* task_begin   */ \
+  0,                                           /* task_exitted */ \
+  0,                                           /* fatal        */ \
+  0                                            /* terminate    */ \
+}
+
 #ifdef __cplusplus
 }
 #endif
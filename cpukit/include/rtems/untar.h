@@ -23,7 +23,9 @@
 #include <zlib.h>
 #include <xz.h>
 
+#include <rtems.h>
 #include <rtems/print.h>
+#include <rtems/thread.h>
 
 /**
  *  @defgroup libmisc_untar_img Untar Image
@@ -146,6 +148,73 @@ typedef struct {
 
 } Untar_XzChunkContext;
 
+typedef struct {
+  /**
+   * @brief Instance of Chunk Context used by the extractor task.
+   */
+  Untar_ChunkContext base;
+
+  /**
+   * @brief Buffers passed from the producer to the extractor task.
+   */
+  unsigned char *buffers;
+
+  /**
+   * @brief Length of the data in each buffer.
+   */
+  size_t *lengths;
+
+  /**
+   * @brief Size of each buffer.
+   */
+  size_t buffer_size;
+
+  /**
+   * @brief Number of buffers.
+   */
+  size_t buffer_count;
+
+  /**
+   * @brief Index of the next buffer the producer fills.
+   */
+  size_t producer;
+
+  /**
+   * @brief Index of the next buffer the extractor task processes.
+   */
+  size_t consumer;
+
+  /**
+   * @brief Counts the buffers the producer can fill.
+   */
+  rtems_counting_semaphore empty;
+
+  /**
+   * @brief Counts the buffers the extractor task can process.
+   */
+  rtems_counting_semaphore full;
+
+  /**
+   * @brief Signals the extractor task has finished.
+   */
+  rtems_binary_semaphore done;
+
+  /**
+   * @brief Extractor task.
+   */
+  rtems_id task;
+
+  /**
+   * @brief Status of the extraction.
+   */
+  int status;
+
+  /**
+   * @brief Printer used by the extractor task.
+   */
+  const rtems_printer *printer;
+} Untar_PipeContext;
+
 /**
  * @brief Initializes the Untar_ChunkContext files out of a part of a block of
  * memory.
@@ -238,6 +307,104 @@ int Untar_FromXzChunk_Print(
   const rtems_printer* printer
 );
 
+/**
+ * @brief Initializes the Untar_PipeContext and starts the extractor task.
+ *
+ * The producer fills buffers obtained with Untar_Pipe_Obtain() and passes
+ * them with Untar_Pipe_Release() to the extractor task. The extractor task
+ * processes the buffers with Untar_FromChunk_Print() in the order they are
+ * filled. The producer, for example a decompressor, and the extractor task
+ * run in parallel if there is more than one processor. The extractor task
+ * needs a task object.
+ *
+ * @param Untar_PipeContext *ctx [in] Pointer to a context structure.
+ * @param size_t buffer_size [in] Size of each buffer. Large buffers result
+ *   in large writes to the files.
+ * @param size_t buffer_count [in] Number of buffers.
+ * @param rtems_task_priority priority [in] Priority of the extractor task,
+ *   RTEMS_CURRENT_PRIORITY for the priority of the calling task.
+ * @param rtems_printer *printer [in] Printer used by the extractor task.
+ *
+ * @retval UNTAR_SUCCESSFUL (0)    the extractor task is started.
+ * @retval UNTAR_FAIL              the buffers or task could not be created.
+ */
+int Untar_PipeContext_Init(
+  Untar_PipeContext *ctx,
+  size_t buffer_size,
+  size_t buffer_count,
+  rtems_task_priority priority,
+  const rtems_printer *printer
+);
+
+/**
+ * @brief Obtains an empty buffer of the buffer size to fill.
+ *
+ * Blocks until the extractor task has processed a buffer if all the buffers
+ * are full.
+ *
+ * @param Untar_PipeContext *ctx [in] Pointer to a context structure.
+ *
+ * @return The buffer or NULL if the extraction has failed.
+ */
+void *Untar_Pipe_Obtain(Untar_PipeContext *ctx);
+
+/**
+ * @brief Passes the buffer obtained last to the extractor task.
+ *
+ * @param Untar_PipeContext *ctx [in] Pointer to a context structure.
+ * @param size_t length [in] Length of the data in the buffer.
+ */
+void Untar_Pipe_Release(Untar_PipeContext *ctx, size_t length);
+
+/**
+ * @brief Waits for the extractor task to process the filled buffers and frees
+ * the resources of the context.
+ *
+ * @param Untar_PipeContext *ctx [in] Pointer to a context structure.
+ *
+ * @retval UNTAR_SUCCESSFUL (0)    on successful completion.
+ * @retval UNTAR_FAIL              for a faulty step within the process.
+ * @retval UNTAR_INVALID_CHECKSUM  for an invalid header checksum.
+ * @retval UNTAR_INVALID_HEADER    for an invalid header.
+ */
+int Untar_PipeContext_Finish(Untar_PipeContext *ctx);
+
+/**
+ * @brief Untars a GZ compressed POSIX TAR image in memory with an extractor
+ * task.
+ *
+ * The calling task inflates the image into the buffers of the pipe. The pipe
+ * is finished by this function.
+ *
+ * @param Untar_PipeContext *ctx [in] Pointer to an initialized context.
+ * @param void *tgz [in] Pointer to the compressed image.
+ * @param size_t size [in] Size of the compressed image.
+ */
+int Untar_FromGzMemory_Pipe(
+  Untar_PipeContext *ctx,
+  const void *tgz,
+  size_t size
+);
+
+/**
+ * @brief Untars a XZ compressed POSIX TAR image in memory with an extractor
+ * task.
+ *
+ * The calling task decompresses the image into the buffers of the pipe. The
+ * pipe is finished by this function.
+ *
+ * @param Untar_PipeContext *ctx [in] Pointer to an initialized context.
+ * @param void *txz [in] Pointer to the compressed image.
+ * @param size_t size [in] Size of the compressed image.
+ * @param uint32_t dict_max [in] Maximum size of dictionary.
+ */
+int Untar_FromXzMemory_Pipe(
+  Untar_PipeContext *ctx,
+  const void *txz,
+  size_t size,
+  uint32_t dict_max
+);
+
 int Untar_ProcessHeader(Untar_HeaderContext *ctx, const char *bufr);
 
 #ifdef __cplusplus
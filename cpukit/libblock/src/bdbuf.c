@@ -164,6 +164,7 @@ typedef enum {
   RTEMS_BDBUF_FATAL_STATE_9,
   RTEMS_BDBUF_FATAL_STATE_10,
   RTEMS_BDBUF_FATAL_STATE_11,
+  RTEMS_BDBUF_FATAL_STATE_12,
   RTEMS_BDBUF_FATAL_SWAPOUT_RE,
   RTEMS_BDBUF_FATAL_TREE_RM,
   RTEMS_BDBUF_FATAL_WAIT_EVNT,
@@ -280,6 +281,15 @@ rtems_bdbuf_show_users (const char* where, rtems_bdbuf_buffer* bd)
 #define RTEMS_BDBUF_AVL_MAX_HEIGHT (32)
 #endif
 
+/**
+ * The maximum count of segments of a direct transfer request.  Larger direct
+ * transfers are split into several requests.  The request is allocated on the
+ * stack.
+ */
+#ifndef RTEMS_BDBUF_DIRECT_TRANSFER_SEGMENTS
+#define RTEMS_BDBUF_DIRECT_TRANSFER_SEGMENTS (64)
+#endif
+
 static void
 rtems_bdbuf_fatal (rtems_fatal_code error)
 {
@@ -2112,6 +2122,219 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
   return sc;
 }
 
+/**
+ * Makes the cached copies of the blocks of a direct transfer coherent with the
+ * device.  Before a direct read all modified buffers in the range are written
+ * to the device.  Before and after a direct write all buffers in the range are
+ * discarded since their content is stale.  Buffers in use are waited for.
+ *
+ * The function assumes the cache is locked on entry and it will be locked on
+ * exit.
+ */
+static void
+rtems_bdbuf_prepare_direct_transfer (rtems_disk_device       *dd,
+                                     rtems_blkdev_request_op  op,
+                                     rtems_blkdev_bnum        media_block,
+                                     uint32_t                 block_count)
+{
+  uint32_t media_blocks_per_block = dd->media_blocks_per_block;
+  uint32_t block_index;
+
+  for (block_index = 0; block_index < block_count; ++block_index)
+  {
+    rtems_bdbuf_buffer *bd;
+
+    while ((bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd,
+                                         media_block)) != NULL)
+    {
+      switch (bd->state)
+      {
+        case RTEMS_BDBUF_STATE_EMPTY:
+          break;
+        case RTEMS_BDBUF_STATE_CACHED:
+          if (op == RTEMS_BLKDEV_REQ_WRITE)
+          {
+            rtems_chain_extract_unprotected (&bd->link);
+            rtems_bdbuf_discard_buffer (bd);
+          }
+          break;
+        case RTEMS_BDBUF_STATE_MODIFIED:
+          if (op == RTEMS_BLKDEV_REQ_READ)
+          {
+            rtems_bdbuf_request_sync_for_modified_buffer (bd);
+            rtems_bdbuf_wait_for_sync_done (bd);
+            continue;
+          }
+          rtems_bdbuf_group_release (bd);
+          rtems_chain_extract_unprotected (&bd->link);
+          rtems_bdbuf_discard_buffer (bd);
+          break;
+        case RTEMS_BDBUF_STATE_ACCESS_CACHED:
+        case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
+        case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
+        case RTEMS_BDBUF_STATE_ACCESS_PURGED:
+          rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+          continue;
+        case RTEMS_BDBUF_STATE_SYNC:
+        case RTEMS_BDBUF_STATE_TRANSFER:
+        case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
+          rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+          continue;
+        default:
+          rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_12);
+      }
+
+      break;
+    }
+
+    media_block += media_blocks_per_block;
+  }
+
+  rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+}
+
+static rtems_status_code
+rtems_bdbuf_execute_direct_request (rtems_disk_device       *dd,
+                                    rtems_blkdev_request_op  op,
+                                    rtems_blkdev_bnum        block,
+                                    uint32_t                 block_count,
+                                    uint8_t                 *buffer)
+{
+  rtems_status_code     sc = RTEMS_SUCCESSFUL;
+  rtems_blkdev_request *req = NULL;
+  rtems_blkdev_bnum     media_block;
+  uint32_t              media_blocks_per_block = dd->media_blocks_per_block;
+  uint32_t              block_size = dd->block_size;
+
+  if (block_count == 0)
+    return RTEMS_SUCCESSFUL;
+
+  if (block_count > dd->block_count || block > dd->block_count - block_count)
+    return RTEMS_INVALID_ID;
+
+  if (!rtems_bdbuf_is_direct_aligned (buffer))
+    return RTEMS_INVALID_ADDRESS;
+
+  sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
+  if (sc != RTEMS_SUCCESSFUL)
+    return sc;
+
+  req = bdbuf_alloc (rtems_bdbuf_read_request_size (
+    RTEMS_BDBUF_DIRECT_TRANSFER_SEGMENTS));
+
+  rtems_bdbuf_lock_cache ();
+
+  while (sc == RTEMS_SUCCESSFUL && block_count > 0)
+  {
+    uint32_t transfer_count = block_count;
+    uint32_t transfer_index;
+
+    if (transfer_count > RTEMS_BDBUF_DIRECT_TRANSFER_SEGMENTS)
+      transfer_count = RTEMS_BDBUF_DIRECT_TRANSFER_SEGMENTS;
+
+    if (rtems_bdbuf_tracer)
+      printf ("bdbuf:direct %s: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
+              op == RTEMS_BLKDEV_REQ_READ ? "read" : "write",
+              media_block, transfer_count, (unsigned) dd->dev);
+
+    rtems_bdbuf_prepare_direct_transfer (dd, op, media_block, transfer_count);
+
+    req->req = op;
+    req->done = rtems_bdbuf_transfer_done;
+    req->io_task = rtems_task_self ();
+    req->bufnum = transfer_count;
+
+    for (transfer_index = 0; transfer_index < transfer_count; ++transfer_index)
+    {
+      req->bufs [transfer_index].user   = NULL;
+      req->bufs [transfer_index].block  = media_block;
+      req->bufs [transfer_index].length = block_size;
+      req->bufs [transfer_index].buffer = buffer;
+
+      media_block += media_blocks_per_block;
+      buffer += block_size;
+    }
+
+    rtems_bdbuf_unlock_cache ();
+
+    /* The return value will be ignored for transfer requests */
+    dd->ioctl (dd->phys_dev, RTEMS_BLKIO_REQUEST, req);
+
+    /* Wait for transfer request completion */
+    rtems_bdbuf_wait_for_transient_event ();
+    sc = req->status;
+
+    rtems_bdbuf_lock_cache ();
+
+    /* Statistics */
+    if (op == RTEMS_BLKDEV_REQ_READ)
+    {
+      dd->stats.read_blocks += transfer_count;
+      if (sc != RTEMS_SUCCESSFUL)
+        ++dd->stats.read_errors;
+    }
+    else
+    {
+      dd->stats.write_blocks += transfer_count;
+      ++dd->stats.write_transfers;
+      if (sc != RTEMS_SUCCESSFUL)
+        ++dd->stats.write_errors;
+
+      /*
+       * The read-ahead task may have read some of the blocks during the
+       * transfer.
+       */
+      rtems_bdbuf_prepare_direct_transfer (dd,
+                                           op,
+                                           req->bufs [0].block,
+                                           transfer_count);
+    }
+
+    block_count -= transfer_count;
+  }
+
+  rtems_bdbuf_unlock_cache ();
+
+  if (sc == RTEMS_SUCCESSFUL)
+    return sc;
+  else
+    return RTEMS_IO_ERROR;
+}
+
+bool
+rtems_bdbuf_is_direct_aligned (const void *buffer)
+{
+  size_t alignment = rtems_cache_get_data_line_size ();
+
+  return alignment == 0 || ((uintptr_t) buffer % alignment) == 0;
+}
+
+rtems_status_code
+rtems_bdbuf_read_direct (rtems_disk_device *dd,
+                         rtems_blkdev_bnum  block,
+                         uint32_t           block_count,
+                         void              *buffer)
+{
+  return rtems_bdbuf_execute_direct_request (dd,
+                                             RTEMS_BLKDEV_REQ_READ,
+                                             block,
+                                             block_count,
+                                             buffer);
+}
+
+rtems_status_code
+rtems_bdbuf_write_direct (rtems_disk_device *dd,
+                          rtems_blkdev_bnum  block,
+                          uint32_t           block_count,
+                          const void        *buffer)
+{
+  return rtems_bdbuf_execute_direct_request (dd,
+                                             RTEMS_BLKDEV_REQ_WRITE,
+                                             block,
+                                             block_count,
+                                             RTEMS_DECONST (void *, buffer));
+}
+
 static rtems_status_code
 rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
 {
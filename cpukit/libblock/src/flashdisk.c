@@ -90,9 +90,15 @@ typedef struct rtems_fdisk_page_desc
 typedef struct rtems_fdisk_segment_ctl
 {
   /**
-   * Segments with available pages are maintained as a linked list.
+   * Segments are maintained on doubly linked queues.
    */
   struct rtems_fdisk_segment_ctl* next;
+  struct rtems_fdisk_segment_ctl* prev;
+
+  /**
+   * The queue the segment is on or NULL if it is on no queue.
+   */
+  struct rtems_fdisk_segment_ctl_queue* queue;
 
   /**
    * The descriptor provided by the low-level driver.
@@ -143,6 +149,21 @@ typedef struct rtems_fdisk_segment_ctl_queue
   uint32_t                 count;
 } rtems_fdisk_segment_ctl_queue;
 
+/**
+ * Segment control table buckets. A set of queues indexed by a key such as the
+ * number of available pages. The map has a bit set for each queue that is not
+ * empty so the queue with the lowest or highest key is found without walking
+ * the segments.
+ */
+typedef struct rtems_fdisk_segment_ctl_buckets
+{
+  rtems_fdisk_segment_ctl_queue* queues; /**< One queue for each key. */
+  uint32_t*                      map;    /**< Bit set if a queue has
+                                              segments. */
+  uint32_t                       size;   /**< The number of queues. */
+  uint32_t                       count;  /**< The number of segments. */
+} rtems_fdisk_segment_ctl_buckets;
+
 /**
  * Flash Device Control holds the segment controls
  */
@@ -189,10 +210,13 @@ typedef struct rtems_flashdisk
                                                 disk. */
   uint32_t                device_count;    /**< The number of flash devices. */
 
-  rtems_fdisk_segment_ctl_queue available; /**< The queue of segments with
-                                                available pages. */
-  rtems_fdisk_segment_ctl_queue used;      /**< The list of segments with all
-                                                pages used. */
+  rtems_fdisk_segment_ctl_buckets available; /**< The segments with
+                                                  available pages by the
+                                                  number of available
+                                                  pages. */
+  rtems_fdisk_segment_ctl_buckets used;      /**< The segments with all pages
+                                                  used by the number of
+                                                  used pages. */
   rtems_fdisk_segment_ctl_queue erase;     /**< The list of segments to be
                                                 erased. */
   rtems_fdisk_segment_ctl_queue failed;    /**< The list of segments that failed
@@ -204,13 +228,28 @@ typedef struct rtems_flashdisk
   uint32_t info_level;                     /**< The info trace level. */
 
   uint32_t starvations;                    /**< Erased blocks starvations counter. */
+
+  rtems_id compact_task;                   /**< The background compaction
+                                                task or RTEMS_ID_NONE. */
 } rtems_flashdisk;
 
 /**
- * The CRC16 factor table. Created during initialisation.
+ * The event sent to the background compaction task.
+ */
+#define RTEMS_FDISK_COMPACT_EVENT RTEMS_EVENT_0
+
+/**
+ * The CRC16 factor tables. Created during initialisation. The first table
+ * is the byte at a time table. The other seven tables allow the checksum to
+ * process eight bytes at a time.
  */
 static uint16_t* rtems_fdisk_crc16_factor;
 
+/**
+ * The number of CRC16 factor tables.
+ */
+#define RTEMS_FDISK_CRC16_TABLES 8
+
 /**
  * Calculate the CRC16 checksum.
  *
@@ -231,8 +270,13 @@ static rtems_status_code
 rtems_fdisk_crc16_gen_factors (uint16_t pattern)
 {
   uint32_t b;
+  uint32_t t;
+
+  if (rtems_fdisk_crc16_factor)
+    return RTEMS_SUCCESSFUL;
 
-  rtems_fdisk_crc16_factor = malloc (sizeof (uint16_t) * 256);
+  rtems_fdisk_crc16_factor =
+    malloc (sizeof (uint16_t) * 256 * RTEMS_FDISK_CRC16_TABLES);
   if (!rtems_fdisk_crc16_factor)
     return RTEMS_NO_MEMORY;
 
@@ -244,6 +288,19 @@ rtems_fdisk_crc16_gen_factors (uint16_t pattern)
       v = v & 1 ? (v >> 1) ^ pattern : v >> 1;
     rtems_fdisk_crc16_factor[b] = v & 0xffff;
   }
+
+  /*
+   * Each table advances the factors of the previous table by one byte.
+   */
+  for (t = 1; t < RTEMS_FDISK_CRC16_TABLES; t++)
+  {
+    for (b = 0; b < 256; b++)
+    {
+      uint16_t v = rtems_fdisk_crc16_factor[(t - 1) * 256 + b];
+      rtems_fdisk_crc16_factor[t * 256 + b] = rtems_fdisk_calc_crc16 (0, v);
+    }
+  }
+
   return RTEMS_SUCCESSFUL;
 }
 
@@ -394,37 +451,18 @@ rtems_fdisk_segment_queue_push_head (rtems_fdisk_segment_ctl_queue* queue,
 {
   if (sc)
   {
+    sc->prev = 0;
     sc->next = queue->head;
-    queue->head = sc;
 
-    if (queue->tail == 0)
+    if (queue->head)
+      queue->head->prev = sc;
+    else
       queue->tail = sc;
-    queue->count++;
-  }
-}
-
-/**
- * Pop the head of the segment control queue.
- */
-static rtems_fdisk_segment_ctl*
-rtems_fdisk_segment_queue_pop_head (rtems_fdisk_segment_ctl_queue* queue)
-{
-  if (queue->head)
-  {
-    rtems_fdisk_segment_ctl* sc = queue->head;
-
-    queue->head = sc->next;
-    if (!queue->head)
-      queue->tail = 0;
 
-    queue->count--;
-
-    sc->next = 0;
-
-    return sc;
+    queue->head = sc;
+    sc->queue = queue;
+    queue->count++;
   }
-
-  return 0;
 }
 
 /**
@@ -437,91 +475,58 @@ rtems_fdisk_segment_queue_push_tail (rtems_fdisk_segment_ctl_queue* queue,
   if (sc)
   {
     sc->next = 0;
+    sc->prev = queue->tail;
 
-    if (queue->head)
-    {
+    if (queue->tail)
       queue->tail->next = sc;
-      queue->tail       = sc;
-    }
     else
-    {
-      queue->head = queue->tail = sc;
-    }
+      queue->head = sc;
 
+    queue->tail = sc;
+    sc->queue = queue;
     queue->count++;
   }
 }
 
 /**
- * Remove from the segment control queue.
+ * Remove from the segment control queue. Nothing is done if the segment is
+ * not on this queue.
  */
 static void
 rtems_fdisk_segment_queue_remove (rtems_fdisk_segment_ctl_queue* queue,
                                   rtems_fdisk_segment_ctl*       sc)
 {
-  rtems_fdisk_segment_ctl* prev = 0;
-  rtems_fdisk_segment_ctl* it = queue->head;
+  if (sc->queue != queue)
+    return;
 
-  /*
-   * Do not change sc->next as sc could be on another queue.
-   */
+  if (sc->prev)
+    sc->prev->next = sc->next;
+  else
+    queue->head = sc->next;
 
-  while (it)
-  {
-    if (sc == it)
-    {
-      if (prev == 0)
-      {
-        queue->head = sc->next;
-        if (queue->head == 0)
-          queue->tail = 0;
-      }
-      else
-      {
-        prev->next = sc->next;
-        if (queue->tail == sc)
-          queue->tail = prev;
-      }
-      sc->next = 0;
-      queue->count--;
-      break;
-    }
+  if (sc->next)
+    sc->next->prev = sc->prev;
+  else
+    queue->tail = sc->prev;
 
-    prev = it;
-    it = it->next;
-  }
+  sc->next = 0;
+  sc->prev = 0;
+  sc->queue = 0;
+  queue->count--;
 }
 
 /**
- * Insert into the segment control queue before the specific
- * segment control item.
+ * Pop the head of the segment control queue.
  */
-static void
-rtems_fdisk_segment_queue_insert_before (rtems_fdisk_segment_ctl_queue* queue,
-                                         rtems_fdisk_segment_ctl*       item,
-                                         rtems_fdisk_segment_ctl*       sc)
+static rtems_fdisk_segment_ctl*
+rtems_fdisk_segment_queue_pop_head (rtems_fdisk_segment_ctl_queue* queue)
 {
-  if (item)
-  {
-    rtems_fdisk_segment_ctl** prev = &queue->head;
-    rtems_fdisk_segment_ctl*  it = queue->head;
-
-    while (it)
-    {
-      if (item == it)
-      {
-        sc->next = item;
-        *prev = sc;
-        queue->count++;
-        return;
-      }
+  rtems_fdisk_segment_ctl* sc = queue->head;
 
-      prev = &it->next;
-      it = it->next;
-    }
-  }
+  if (sc)
+    rtems_fdisk_segment_queue_remove (queue, sc);
 
-  rtems_fdisk_segment_queue_push_tail (queue, sc);
+  return sc;
 }
 
 /**
@@ -558,16 +563,245 @@ static bool
 rtems_fdisk_segment_queue_present (rtems_fdisk_segment_ctl_queue* queue,
                                    rtems_fdisk_segment_ctl*       sc)
 {
-  rtems_fdisk_segment_ctl*  it = queue->head;
+  return sc->queue == queue;
+}
+
+/**
+ * The number of words in the map of the segment control buckets.
+ */
+static uint32_t
+rtems_fdisk_segment_buckets_map_size (uint32_t size)
+{
+  return (size + 31) / 32;
+}
+
+/**
+ * Allocate the segment control buckets for keys from 0 to size - 1.
+ */
+static int
+rtems_fdisk_segment_buckets_create (rtems_fdisk_segment_ctl_buckets* buckets,
+                                    uint32_t                         size)
+{
+  buckets->queues = calloc (size, sizeof (rtems_fdisk_segment_ctl_queue));
+  buckets->map = calloc (rtems_fdisk_segment_buckets_map_size (size),
+                         sizeof (uint32_t));
+  buckets->size = size;
+  buckets->count = 0;
+
+  if (!buckets->queues || !buckets->map)
+  {
+    free (buckets->queues);
+    free (buckets->map);
+    return ENOMEM;
+  }
+
+  return 0;
+}
+
+/**
+ * Initialise the segment control buckets.
+ */
+static void
+rtems_fdisk_segment_buckets_init (rtems_fdisk_segment_ctl_buckets* buckets)
+{
+  uint32_t key;
+
+  for (key = 0; key < buckets->size; key++)
+    rtems_fdisk_segment_queue_init (&buckets->queues[key]);
+
+  memset (buckets->map, 0,
+          rtems_fdisk_segment_buckets_map_size (buckets->size) *
+          sizeof (uint32_t));
+  buckets->count = 0;
+}
+
+/**
+ * See if a segment control is present in these buckets.
+ */
+static bool
+rtems_fdisk_segment_buckets_present (const rtems_fdisk_segment_ctl_buckets* buckets,
+                                     const rtems_fdisk_segment_ctl*         sc)
+{
+  return (sc->queue >= &buckets->queues[0]) &&
+    (sc->queue < &buckets->queues[buckets->size]);
+}
+
+/**
+ * Push to the head or tail of the queue for the key. A key outside the
+ * buckets is placed in the last queue.
+ */
+static void
+rtems_fdisk_segment_buckets_push (rtems_fdisk_segment_ctl_buckets* buckets,
+                                  rtems_fdisk_segment_ctl*         sc,
+                                  uint32_t                         key,
+                                  bool                             head)
+{
+  if (key >= buckets->size)
+    key = buckets->size - 1;
+
+  if (head)
+    rtems_fdisk_segment_queue_push_head (&buckets->queues[key], sc);
+  else
+    rtems_fdisk_segment_queue_push_tail (&buckets->queues[key], sc);
+
+  buckets->map[key / 32] |= 1U << (key % 32);
+  buckets->count++;
+}
 
-  while (it)
+/**
+ * Remove from the segment control buckets. Nothing is done if the segment is
+ * not in these buckets.
+ */
+static void
+rtems_fdisk_segment_buckets_remove (rtems_fdisk_segment_ctl_buckets* buckets,
+                                    rtems_fdisk_segment_ctl*         sc)
+{
+  if (rtems_fdisk_segment_buckets_present (buckets, sc))
   {
-    if (it == sc)
-      return true;
-    it = it->next;
+    rtems_fdisk_segment_ctl_queue* queue = sc->queue;
+    uint32_t                       key = queue - &buckets->queues[0];
+
+    rtems_fdisk_segment_queue_remove (queue, sc);
+
+    if (!queue->head)
+      buckets->map[key / 32] &= ~(1U << (key % 32));
+
+    buckets->count--;
   }
+}
+
+/**
+ * Find the first segment in the queue with the lowest key that is greater
+ * than or equal to the key.
+ */
+static rtems_fdisk_segment_ctl*
+rtems_fdisk_segment_buckets_lowest (const rtems_fdisk_segment_ctl_buckets* buckets,
+                                    uint32_t                               key)
+{
+  uint32_t words = rtems_fdisk_segment_buckets_map_size (buckets->size);
+  uint32_t word = key / 32;
+  uint32_t bits;
 
-  return false;
+  if (key >= buckets->size)
+    return 0;
+
+  bits = buckets->map[word] & ~((1U << (key % 32)) - 1);
+
+  while (true)
+  {
+    if (bits)
+      return buckets->queues[word * 32 + __builtin_ctz (bits)].head;
+
+    if (++word == words)
+      return 0;
+
+    bits = buckets->map[word];
+  }
+}
+
+/**
+ * Find the first segment in the queue with the highest key that is less than
+ * or equal to the key.
+ */
+static rtems_fdisk_segment_ctl*
+rtems_fdisk_segment_buckets_highest (const rtems_fdisk_segment_ctl_buckets* buckets,
+                                     uint32_t                               key)
+{
+  uint32_t word;
+  uint32_t bits;
+
+  if (key >= buckets->size)
+    key = buckets->size - 1;
+
+  word = key / 32;
+  bits = buckets->map[word];
+
+  if ((key % 32) != 31)
+    bits &= (1U << ((key % 32) + 1)) - 1;
+
+  while (true)
+  {
+    if (bits)
+      return buckets->queues[word * 32 + 31 - __builtin_clz (bits)].head;
+
+    if (word-- == 0)
+      return 0;
+
+    bits = buckets->map[word];
+  }
+}
+
+/**
+ * Get the segment following this segment when walking the buckets from the
+ * highest key to the lowest key.
+ */
+static rtems_fdisk_segment_ctl*
+rtems_fdisk_segment_buckets_next_lower (const rtems_fdisk_segment_ctl_buckets* buckets,
+                                        const rtems_fdisk_segment_ctl*         sc)
+{
+  uint32_t key;
+
+  if (sc->next)
+    return sc->next;
+
+  key = sc->queue - &buckets->queues[0];
+  if (key == 0)
+    return 0;
+
+  return rtems_fdisk_segment_buckets_highest (buckets, key - 1);
+}
+
+/**
+ * Pop the first segment of the queue with the lowest key.
+ */
+static rtems_fdisk_segment_ctl*
+rtems_fdisk_segment_buckets_pop_lowest (rtems_fdisk_segment_ctl_buckets* buckets)
+{
+  rtems_fdisk_segment_ctl* sc = rtems_fdisk_segment_buckets_lowest (buckets, 0);
+
+  if (sc)
+    rtems_fdisk_segment_buckets_remove (buckets, sc);
+
+  return sc;
+}
+
+/**
+ * Pop the first segment of the queue with the highest key.
+ */
+static rtems_fdisk_segment_ctl*
+rtems_fdisk_segment_buckets_pop_highest (rtems_fdisk_segment_ctl_buckets* buckets)
+{
+  rtems_fdisk_segment_ctl* sc =
+    rtems_fdisk_segment_buckets_highest (buckets, buckets->size - 1);
+
+  if (sc)
+    rtems_fdisk_segment_buckets_remove (buckets, sc);
+
+  return sc;
+}
+
+/**
+ * Count the number of segments in the buckets.
+ */
+static uint32_t
+rtems_fdisk_segment_buckets_count (const rtems_fdisk_segment_ctl_buckets* buckets)
+{
+  return buckets->count;
+}
+
+/**
+ * Count the number of segments in the buckets by walking the queues.
+ */
+static uint32_t
+rtems_fdisk_segment_count_buckets (rtems_fdisk_segment_ctl_buckets* buckets)
+{
+  uint32_t count = 0;
+  uint32_t key;
+
+  for (key = 0; key < buckets->size; key++)
+    count += rtems_fdisk_segment_count_queue (&buckets->queues[key]);
+
+  return count;
 }
 
 /**
@@ -578,8 +812,8 @@ rtems_fdisk_queue_status (rtems_flashdisk*         fd,
                           rtems_fdisk_segment_ctl* sc,
                           char                     queues[5])
 {
-  queues[0] = rtems_fdisk_segment_queue_present (&fd->available, sc) ? 'A' : '-';
-  queues[1] = rtems_fdisk_segment_queue_present (&fd->used, sc)      ? 'U' : '-';
+  queues[0] = rtems_fdisk_segment_buckets_present (&fd->available, sc) ? 'A' : '-';
+  queues[1] = rtems_fdisk_segment_buckets_present (&fd->used, sc)      ? 'U' : '-';
   queues[2] = rtems_fdisk_segment_queue_present (&fd->erase, sc)     ? 'E' : '-';
   queues[3] = rtems_fdisk_segment_queue_present (&fd->failed, sc)    ? 'F' : '-';
   queues[4] = '\0';
@@ -706,23 +940,25 @@ rtems_fdisk_seg_next_available_page (rtems_fdisk_segment_ctl* sc)
 }
 
 /**
- * Find the segment on the queue that has the most free pages.
+ * Find the segment that has the most free pages. The available buckets are
+ * keyed by the number of available pages.
  */
 static rtems_fdisk_segment_ctl*
-rtems_fdisk_seg_most_available (const rtems_fdisk_segment_ctl_queue* queue)
+rtems_fdisk_seg_most_available (const rtems_fdisk_segment_ctl_buckets* available)
 {
-  rtems_fdisk_segment_ctl* sc      = queue->head;
-  rtems_fdisk_segment_ctl* biggest = queue->head;
-
-  while (sc)
-  {
-    if (rtems_fdisk_seg_pages_available (sc) >
-        rtems_fdisk_seg_pages_available (biggest))
-      biggest = sc;
-    sc = sc->next;
-  }
+  return rtems_fdisk_segment_buckets_highest (available, available->size - 1);
+}
 
-  return biggest;
+/**
+ * Place a segment in the available buckets. Segments with the same number of
+ * available pages are used in the order they are queued.
+ */
+static void
+rtems_fdisk_seg_make_available (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
+{
+  rtems_fdisk_segment_buckets_push (&fd->available, sc,
+                                    rtems_fdisk_seg_pages_available (sc),
+                                    false);
 }
 
 /**
@@ -1045,11 +1281,33 @@ rtems_fdisk_erase_flash (const rtems_flashdisk* fd)
 static uint16_t
 rtems_fdisk_page_checksum (const uint8_t* buffer, uint32_t page_size)
 {
-  uint16_t cs = 0xffff;
-  uint32_t i;
+  const uint16_t* f = rtems_fdisk_crc16_factor;
+  uint16_t        cs = 0xffff;
 
-  for (i = 0; i < page_size; i++, buffer++)
+  /*
+   * Process eight bytes at a time. The checksum is folded into the first two
+   * bytes and every byte is looked up in the table for its distance to the
+   * end of the eight bytes.
+   */
+  while (page_size >= 8)
+  {
+    uint32_t c = cs ^ (buffer[0] | ((uint32_t) buffer[1] << 8));
+
+    cs = f[7 * 256 + (c & 0xff)] ^ f[6 * 256 + (c >> 8)] ^
+         f[5 * 256 + buffer[2]] ^ f[4 * 256 + buffer[3]] ^
+         f[3 * 256 + buffer[4]] ^ f[2 * 256 + buffer[5]] ^
+         f[1 * 256 + buffer[6]] ^ f[buffer[7]];
+
+    buffer += 8;
+    page_size -= 8;
+  }
+
+  while (page_size > 0)
+  {
     cs = rtems_fdisk_calc_crc16 (*buffer, cs);
+    buffer++;
+    page_size--;
+  }
 
   return cs;
 }
@@ -1093,11 +1351,11 @@ rtems_fdisk_erase_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
   sc->failed = false;
 
   /*
-   * Push to the tail of the available queue. It is a very
-   * simple type of wear reduction. Every other available
-   * segment will now get a go.
+   * Push to the tail of the queue of empty segments. It is a very
+   * simple type of wear reduction. Every other empty segment
+   * will now get a go.
    */
-  rtems_fdisk_segment_queue_push_tail (&fd->available, sc);
+  rtems_fdisk_seg_make_available (fd, sc);
 
   return 0;
 }
@@ -1143,6 +1401,12 @@ rtems_fdisk_queue_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
                     sc->failed ? "FAILED" : "no", sc->next ? "set" : "null");
 #endif
 
+  /*
+   * Remove the segment from the available or used buckets.
+   */
+  rtems_fdisk_segment_buckets_remove (&fd->available, sc);
+  rtems_fdisk_segment_buckets_remove (&fd->used, sc);
+
   /*
    * If the segment has failed then check the failed queue and append
    * if not failed.
@@ -1154,12 +1418,6 @@ rtems_fdisk_queue_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
     return;
   }
 
-  /*
-   * Remove the queue from the available or used queue.
-   */
-  rtems_fdisk_segment_queue_remove (&fd->available, sc);
-  rtems_fdisk_segment_queue_remove (&fd->used, sc);
-
   /*
    * Are all the pages in the segment used ?
    * If they are and the driver has been configured to background
@@ -1172,23 +1430,11 @@ rtems_fdisk_queue_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
     if (sc->pages_active)
     {
       /*
-       * Keep the used queue sorted by the most number of used
-       * pages. When we compact we want to move the pages into
-       * a new segment and cover more than one segment.
+       * The used buckets are keyed by the number of used pages. When we
+       * compact we want to move the pages of the segments with the most
+       * used pages into a new segment and cover more than one segment.
        */
-      rtems_fdisk_segment_ctl* seg = fd->used.head;
-
-      while (seg)
-      {
-        if (sc->pages_used > seg->pages_used)
-          break;
-        seg = seg->next;
-      }
-
-      if (seg)
-        rtems_fdisk_segment_queue_insert_before (&fd->used, seg, sc);
-      else
-        rtems_fdisk_segment_queue_push_tail (&fd->used, sc);
+      rtems_fdisk_segment_buckets_push (&fd->used, sc, sc->pages_used, false);
     }
     else
     {
@@ -1201,45 +1447,19 @@ rtems_fdisk_queue_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
   else
   {
     /*
-     * The segment has pages available so place back onto the
-     * available list. The list is sorted from the least number
-     * of available pages to the most. This approach means
+     * The segment has pages available so place back into the
+     * available buckets. Segments are taken from the bucket with
+     * the least number of available pages. This approach means
      * the pages of a partially filled segment will be filled
      * before moving onto another emptier segment. This keeps
      * empty segments longer aiding compaction.
      *
-     * The down side is the wear effect as a single segment
-     * could be used more than segment. This will not be
-     * addressed until wear support is added.
-     *
-     * @note Wear support can be added by having counts for
-     * for the number of times a segment is erased. This
-     * available list is then sorted on the least number
-     * of available pages then empty segments are sorted
-     * on the least number of erases the segment has.
-     *
-     * The erase count can be stored in specially flaged
-     * pages and contain a counter (32bits?) and 32 bits
-     * for each segment. When a segment is erased a
-     * bit is cleared for that segment. When 32 erasers
-     * has occurred the page is re-written to the flash
-     * with all the counters updated with the number of
-     * bits cleared and all bits set back to 1.
+     * Segments with the same number of available pages are used
+     * in turn. An erased segment is placed at the tail of the
+     * empty segments so every other empty segment is used before
+     * it is used again.
      */
-    rtems_fdisk_segment_ctl* seg = fd->available.head;
-
-    while (seg)
-    {
-      if (rtems_fdisk_seg_pages_available (sc) <
-          rtems_fdisk_seg_pages_available (seg))
-        break;
-      seg = seg->next;
-    }
-
-    if (seg)
-      rtems_fdisk_segment_queue_insert_before (&fd->available, seg, sc);
-    else
-      rtems_fdisk_segment_queue_push_tail (&fd->available, sc);
+    rtems_fdisk_seg_make_available (fd, sc);
   }
 }
 
@@ -1278,7 +1498,7 @@ rtems_fdisk_recycle_segment (rtems_flashdisk*         fd,
                            rtems_fdisk_seg_pages_available (dsc));
         dsc->failed = true;
         rtems_fdisk_queue_segment (fd, dsc);
-        rtems_fdisk_segment_queue_push_head (&fd->used, ssc);
+        rtems_fdisk_segment_buckets_push (&fd->used, ssc, ssc->pages_used, true);
         return EIO;
       }
 
@@ -1300,7 +1520,7 @@ rtems_fdisk_recycle_segment (rtems_flashdisk*         fd,
                            dsc->device, dsc->segment, dpage,
                            strerror (ret), ret);
         rtems_fdisk_queue_segment (fd, dsc);
-        rtems_fdisk_segment_queue_push_head (&fd->used, ssc);
+        rtems_fdisk_segment_buckets_push (&fd->used, ssc, ssc->pages_used, true);
         return ret;
       }
 
@@ -1318,7 +1538,7 @@ rtems_fdisk_recycle_segment (rtems_flashdisk*         fd,
                            dsc->device, dsc->segment, dpage,
                            strerror (ret), ret);
         rtems_fdisk_queue_segment (fd, dsc);
-        rtems_fdisk_segment_queue_push_head (&fd->used, ssc);
+        rtems_fdisk_segment_buckets_push (&fd->used, ssc, ssc->pages_used, true);
         return ret;
       }
 
@@ -1414,9 +1634,9 @@ rtems_fdisk_compact (rtems_flashdisk* fd)
     rtems_fdisk_printf (fd, " resolve starvation");
 #endif
 
-    ssc = rtems_fdisk_segment_queue_pop_head (&fd->used);
+    ssc = rtems_fdisk_segment_buckets_pop_highest (&fd->used);
     if (!ssc)
-      ssc = rtems_fdisk_segment_queue_pop_head (&fd->available);
+      ssc = rtems_fdisk_segment_buckets_pop_lowest (&fd->available);
 
     if (ssc)
     {
@@ -1440,7 +1660,7 @@ rtems_fdisk_compact (rtems_flashdisk* fd)
     }
   }
 
-  while (fd->used.head)
+  while (rtems_fdisk_segment_buckets_count (&fd->used))
   {
     uint32_t                 dst_pages;
     uint32_t                 segments;
@@ -1457,7 +1677,7 @@ rtems_fdisk_compact (rtems_flashdisk* fd)
       return EIO;
     }
 
-    ssc = fd->used.head;
+    ssc = rtems_fdisk_segment_buckets_highest (&fd->used, fd->used.size - 1);
     dst_pages = rtems_fdisk_seg_pages_available (dsc);
     segments = 0;
     pages = 0;
@@ -1481,7 +1701,7 @@ rtems_fdisk_compact (rtems_flashdisk* fd)
     {
       pages += ssc->pages_active;
       segments++;
-      ssc = ssc->next;
+      ssc = rtems_fdisk_segment_buckets_next_lower (&fd->used, ssc);
     }
 
     /*
@@ -1504,7 +1724,7 @@ rtems_fdisk_compact (rtems_flashdisk* fd)
                         pages, segments);
 #endif
 
-    rtems_fdisk_segment_queue_remove (&fd->available, dsc);
+    rtems_fdisk_segment_buckets_remove (&fd->available, dsc);
 
     /*
      * We now copy the pages to the new segment.
@@ -1512,7 +1732,7 @@ rtems_fdisk_compact (rtems_flashdisk* fd)
 
     while (pages)
     {
-      ssc = rtems_fdisk_segment_queue_pop_head (&fd->used);
+      ssc = rtems_fdisk_segment_buckets_pop_highest (&fd->used);
 
       if (ssc)
       {
@@ -1539,8 +1759,8 @@ rtems_fdisk_recover_block_mappings (rtems_flashdisk* fd)
   /*
    * Clear the queues.
    */
-  rtems_fdisk_segment_queue_init (&fd->available);
-  rtems_fdisk_segment_queue_init (&fd->used);
+  rtems_fdisk_segment_buckets_init (&fd->available);
+  rtems_fdisk_segment_buckets_init (&fd->used);
   rtems_fdisk_segment_queue_init (&fd->erase);
   rtems_fdisk_segment_queue_init (&fd->failed);
 
@@ -1581,6 +1801,10 @@ rtems_fdisk_recover_block_mappings (rtems_flashdisk* fd)
 
       sc->failed = false;
 
+      sc->next  = 0;
+      sc->prev  = 0;
+      sc->queue = 0;
+
       if (!sc->page_descriptors)
         sc->page_descriptors = malloc (sc->pages_desc * fd->block_size);
 
@@ -1942,16 +2166,22 @@ rtems_fdisk_write_block (rtems_flashdisk* fd,
   /*
    * Is it time to compact the disk ?
    *
-   * We override the background compaction configruation.
+   * We override the background compaction configruation unless there is a
+   * background compaction task. The task compacts once the write is done.
    */
-  if (rtems_fdisk_segment_count_queue (&fd->available) <=
+  if (rtems_fdisk_segment_buckets_count (&fd->available) <=
       fd->avail_compact_segs)
-    rtems_fdisk_compact (fd);
+  {
+    if (fd->compact_task != RTEMS_ID_NONE)
+      rtems_event_send (fd->compact_task, RTEMS_FDISK_COMPACT_EVENT);
+    else
+      rtems_fdisk_compact (fd);
+  }
 
   /*
    * Get the next avaliable segment.
    */
-  sc = rtems_fdisk_segment_queue_pop_head (&fd->available);
+  sc = rtems_fdisk_segment_buckets_pop_lowest (&fd->available);
 
   /*
    * Is the flash disk full ?
@@ -1968,7 +2198,7 @@ rtems_fdisk_write_block (rtems_flashdisk* fd,
     /*
      * Try again for some free space.
      */
-    sc = rtems_fdisk_segment_queue_pop_head (&fd->available);
+    sc = rtems_fdisk_segment_buckets_pop_lowest (&fd->available);
 
     if (!sc)
     {
@@ -2188,8 +2418,8 @@ rtems_fdisk_monitoring_data (rtems_flashdisk*          fd,
     if (fd->blocks[i].segment)
       data->blocks_used++;
 
-  data->segs_available = rtems_fdisk_segment_count_queue (&fd->available);
-  data->segs_used      = rtems_fdisk_segment_count_queue (&fd->used);
+  data->segs_available = rtems_fdisk_segment_buckets_count (&fd->available);
+  data->segs_used      = rtems_fdisk_segment_buckets_count (&fd->used);
   data->segs_failed    = rtems_fdisk_segment_count_queue (&fd->failed);
 
   data->segment_count = 0;
@@ -2242,14 +2472,14 @@ rtems_fdisk_print_status (rtems_flashdisk* fd)
   rtems_fdisk_printf (fd, "Unavail blocks\t%d", fd->unavail_blocks);
   rtems_fdisk_printf (fd, "Starvation threshold\t%d", fd->starvation_threshold);
   rtems_fdisk_printf (fd, "Starvations\t%d", fd->starvations);
-  count = rtems_fdisk_segment_count_queue (&fd->available);
+  count = rtems_fdisk_segment_count_buckets (&fd->available);
   total = count;
   rtems_fdisk_printf (fd, "Available queue\t%ld (%ld)",
-                      count, rtems_fdisk_segment_queue_count (&fd->available));
-  count = rtems_fdisk_segment_count_queue (&fd->used);
+                      count, rtems_fdisk_segment_buckets_count (&fd->available));
+  count = rtems_fdisk_segment_count_buckets (&fd->used);
   total += count;
   rtems_fdisk_printf (fd, "Used queue\t%ld (%ld)",
-                      count, rtems_fdisk_segment_queue_count (&fd->used));
+                      count, rtems_fdisk_segment_buckets_count (&fd->used));
   count = rtems_fdisk_segment_count_queue (&fd->erase);
   total += count;
   rtems_fdisk_printf (fd, "Erase queue\t%ld (%ld)",
@@ -2335,14 +2565,15 @@ rtems_fdisk_print_status (rtems_flashdisk* fd)
   }
 
   {
-    rtems_fdisk_segment_ctl* sc = fd->used.head;
+    rtems_fdisk_segment_ctl* sc =
+      rtems_fdisk_segment_buckets_highest (&fd->used, fd->used.size - 1);
     int count = 0;
     rtems_fdisk_printf (fd, "Used List:");
     while (sc)
     {
       rtems_fdisk_printf (fd, "  %3d %02d:%03d u:%3ld",
                           count, sc->device, sc->segment, sc->pages_used);
-      sc = sc->next;
+      sc = rtems_fdisk_segment_buckets_next_lower (&fd->used, sc);
       count++;
     }
   }
@@ -2433,6 +2664,112 @@ rtems_fdisk_ioctl (rtems_disk_device *dd, uint32_t req, void* argp)
   return errno == 0 ? 0 : -1;
 }
 
+/**
+ * Flash disk background compaction task. The write handler wakes the task
+ * when the number of available segments drops to the compaction level.
+ *
+ * @param arg The flash disk control table.
+ */
+static rtems_task
+rtems_fdisk_compact_task (rtems_task_argument arg)
+{
+  rtems_flashdisk* fd = (rtems_flashdisk*) arg;
+
+  while (true)
+  {
+    rtems_event_set events;
+
+    rtems_event_receive (RTEMS_FDISK_COMPACT_EVENT,
+                         RTEMS_EVENT_ALL | RTEMS_WAIT,
+                         RTEMS_NO_TIMEOUT,
+                         &events);
+
+    rtems_mutex_lock (&fd->lock);
+
+    /*
+     * Erase the used segments before and after the compaction. The erased
+     * segments are available to compact into and the compaction may leave
+     * segments without active pages.
+     */
+    if ((fd->flags & RTEMS_FDISK_BACKGROUND_ERASE))
+      rtems_fdisk_erase_used (fd);
+
+    if (rtems_fdisk_segment_buckets_count (&fd->available) <=
+        fd->avail_compact_segs)
+      rtems_fdisk_compact (fd);
+
+    if ((fd->flags & RTEMS_FDISK_BACKGROUND_ERASE))
+      rtems_fdisk_erase_used (fd);
+
+    rtems_mutex_unlock (&fd->lock);
+  }
+}
+
+/**
+ * Start the background compaction task of a flash disk.
+ *
+ * @param fd The flash disk control table.
+ * @param priority The task priority.
+ */
+static rtems_status_code
+rtems_fdisk_start_compact_task (rtems_flashdisk*    fd,
+                                rtems_task_priority priority)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_create (rtems_build_name ('F', 'D', 'C', 'a' + fd->minor),
+                          priority,
+                          2 * RTEMS_MINIMUM_STACK_SIZE,
+                          RTEMS_DEFAULT_MODES,
+                          RTEMS_DEFAULT_ATTRIBUTES,
+                          &fd->compact_task);
+  if (sc != RTEMS_SUCCESSFUL)
+  {
+    fd->compact_task = RTEMS_ID_NONE;
+    return sc;
+  }
+
+  sc = rtems_task_start (fd->compact_task, rtems_fdisk_compact_task,
+                         (rtems_task_argument) fd);
+  if (sc != RTEMS_SUCCESSFUL)
+  {
+    rtems_task_delete (fd->compact_task);
+    fd->compact_task = RTEMS_ID_NONE;
+  }
+
+  return sc;
+}
+
+/**
+ * The number of pages in the largest segment of a configuration less the
+ * page descriptor pages.
+ */
+static uint32_t
+rtems_fdisk_max_segment_pages (const rtems_flashdisk_config* c)
+{
+  uint32_t max = 0;
+  uint32_t device;
+
+  for (device = 0; device < c->device_count; device++)
+  {
+    const rtems_fdisk_device_desc* dd = &c->devices[device];
+    uint32_t                       s;
+
+    for (s = 0; s < dd->segment_count; s++)
+    {
+      const rtems_fdisk_segment_desc* sd = &dd->segments[s];
+      uint32_t                        pages;
+
+      pages = rtems_fdisk_pages_in_segment (sd, c->block_size) -
+        rtems_fdisk_page_desc_pages (sd, c->block_size);
+      if (pages > max)
+        max = pages;
+    }
+  }
+
+  return max;
+}
+
 /**
  * Flash disk device driver initialization.
  *
@@ -2498,6 +2835,22 @@ rtems_fdisk_initialize (rtems_device_major_number major,
     if (!fd->devices)
       return RTEMS_NO_MEMORY;
 
+    /*
+     * The buckets are keyed by the number of available or used pages of a
+     * segment.
+     */
+    ret = rtems_fdisk_segment_buckets_create (&fd->available,
+                                              rtems_fdisk_max_segment_pages (c) + 1);
+    if (ret)
+      return RTEMS_NO_MEMORY;
+
+    ret = rtems_fdisk_segment_buckets_create (&fd->used,
+                                              rtems_fdisk_max_segment_pages (c) + 1);
+    if (ret)
+      return RTEMS_NO_MEMORY;
+
+    fd->compact_task = RTEMS_ID_NONE;
+
     rtems_mutex_init (&fd->lock, "Flash Disk");
 
     sc = rtems_blkdev_create(name, c->block_size, blocks - fd->unavail_blocks,
@@ -2581,6 +2934,23 @@ rtems_fdisk_initialize (rtems_device_major_number major,
                          strerror (ret), ret);
       return ret;
     }
+
+    if ((fd->flags & RTEMS_FDISK_BACKGROUND_COMPACT) &&
+        (c->compact_task_priority != 0))
+    {
+      sc = rtems_fdisk_start_compact_task (fd, c->compact_task_priority);
+      if (sc != RTEMS_SUCCESSFUL)
+      {
+        /*
+         * The disk is registered and usable, so compact in the foreground
+         * instead.
+         */
+        rtems_fdisk_error ("compact task start failed: %s: "
+                           "compacting in the foreground",
+                           rtems_status_text (sc));
+        fd->flags &= ~RTEMS_FDISK_BACKGROUND_COMPACT;
+      }
+    }
   }
 
   return RTEMS_SUCCESSFUL;
@@ -95,20 +95,16 @@ static rtems_status_code sparse_disk_initialize( rtems_sparse_disk *sd,
 }
 
 /*
- * Block comparison
+ * Hash bucket of a block
  */
-static int sparse_disk_compare( const void *aa, const void *bb )
+static rtems_sparse_disk_key *sparse_disk_bucket(
+  const rtems_sparse_disk *sparse_disk,
+  rtems_blkdev_bnum        block
+)
 {
-  const rtems_sparse_disk_key *a = aa;
-  const rtems_sparse_disk_key *b = bb;
+  uint32_t hash = (uint32_t) block * 2654435761U;
 
-  if ( a->block < b->block ) {
-    return -1;
-  } else if ( a->block == b->block ) {
-    return 0;
-  } else {
-    return 1;
-  }
+  return &sparse_disk->key_table[ hash % sparse_disk->blocks_with_buffer ];
 }
 
 static rtems_sparse_disk_key *sparse_disk_find_block(
@@ -116,15 +112,46 @@ static rtems_sparse_disk_key *sparse_disk_find_block(
   rtems_blkdev_bnum        block
 )
 {
-  rtems_sparse_disk_key key = { .block = block };
-
-  return bsearch(
-    &key,
-    sparse_disk->key_table,
-    sparse_disk->used_count,
-    sizeof( rtems_sparse_disk_key ),
-    sparse_disk_compare
-  );
+  rtems_blkdev_bnum index;
+
+  /* A disk without buffered blocks has no hash buckets */
+  if ( 0 == sparse_disk->blocks_with_buffer )
+    return NULL;
+
+  index = sparse_disk_bucket( sparse_disk, block )->bucket;
+
+  while ( 0 != index ) {
+    rtems_sparse_disk_key *key = &sparse_disk->key_table[ index - 1 ];
+
+    if ( key->block == block )
+      return key;
+
+    index = key->next;
+  }
+
+  return NULL;
+}
+
+/*
+ * Find a block starting with a hint.  Keys are allocated in the order blocks
+ * are first written, so the key following the key of the previous block is
+ * usually the key of the next block for sequential transfers.
+ */
+static rtems_sparse_disk_key *sparse_disk_find_block_with_hint(
+  const rtems_sparse_disk *sparse_disk,
+  rtems_blkdev_bnum        block,
+  rtems_sparse_disk_key   *hint
+)
+{
+  if (
+    NULL != hint
+      && hint < &sparse_disk->key_table[ sparse_disk->used_count ]
+      && hint->block == block
+  ) {
+    return hint;
+  }
+
+  return sparse_disk_find_block( sparse_disk, block );
 }
 
 static rtems_sparse_disk_key *sparse_disk_get_new_block(
@@ -133,6 +160,7 @@ static rtems_sparse_disk_key *sparse_disk_get_new_block(
 )
 {
   rtems_sparse_disk_key *key;
+  rtems_sparse_disk_key *bucket;
 
   if ( sparse_disk->used_count >= sparse_disk->blocks_with_buffer ) {
     return NULL;
@@ -141,20 +169,20 @@ static rtems_sparse_disk_key *sparse_disk_get_new_block(
   key = &sparse_disk->key_table[ sparse_disk->used_count ];
   key->block = block;
   ++sparse_disk->used_count;
-  qsort(
-    sparse_disk->key_table,
-    sparse_disk->used_count,
-    sizeof( rtems_sparse_disk_key ),
-    sparse_disk_compare
-  );
-  return sparse_disk_find_block( sparse_disk, block );
+
+  bucket = sparse_disk_bucket( sparse_disk, block );
+  key->next = bucket->bucket;
+  bucket->bucket = sparse_disk->used_count;
+
+  return key;
 }
 
 static int sparse_disk_read_block(
   const rtems_sparse_disk *sparse_disk,
   const rtems_blkdev_bnum  block,
   uint8_t                 *buffer,
-  const size_t             buffer_size )
+  const size_t             buffer_size,
+  rtems_sparse_disk_key  **hint )
 {
   size_t                 bytes_to_copy = sparse_disk->media_block_size;
   rtems_sparse_disk_key *key;
@@ -162,12 +190,15 @@ static int sparse_disk_read_block(
   if ( buffer_size < bytes_to_copy )
     bytes_to_copy = buffer_size;
 
-  key = sparse_disk_find_block( sparse_disk, block );
+  key = sparse_disk_find_block_with_hint( sparse_disk, block, *hint );
 
-  if ( NULL != key )
+  if ( NULL != key ) {
     memcpy( buffer, key->data, bytes_to_copy );
-  else
-    memset( buffer, sparse_disk->fill_pattern, buffer_size );
+    *hint = key + 1;
+  } else {
+    memset( buffer, sparse_disk->fill_pattern, bytes_to_copy );
+    *hint = NULL;
+  }
 
   return bytes_to_copy;
 }
@@ -176,7 +207,8 @@ static int sparse_disk_write_block(
   rtems_sparse_disk      *sparse_disk,
   const rtems_blkdev_bnum block,
   const uint8_t          *buffer,
-  const size_t            buffer_size )
+  const size_t            buffer_size,
+  rtems_sparse_disk_key **hint )
 {
   size_t                 bytes_to_copy = sparse_disk->media_block_size;
   bool                   block_needs_writing = false;
@@ -190,7 +222,7 @@ static int sparse_disk_write_block(
    * If the read method does not find a block it will deliver the fill pattern anyway.
    */
 
-  key = sparse_disk_find_block( sparse_disk, block );
+  key = sparse_disk_find_block_with_hint( sparse_disk, block, *hint );
 
   if ( NULL == key ) {
     for ( i = 0; ( !block_needs_writing ) && ( i < bytes_to_copy ); ++i ) {
@@ -203,10 +235,14 @@ static int sparse_disk_write_block(
     }
   }
 
-  if ( NULL != key )
+  if ( NULL != key ) {
     memcpy( key->data, buffer, bytes_to_copy );
-  else if ( block_needs_writing )
+    *hint = key + 1;
+  } else if ( block_needs_writing ) {
     return -1;
+  } else {
+    *hint = NULL;
+  }
 
   return bytes_to_copy;
 }
@@ -226,6 +262,7 @@ static int sparse_disk_read_write(
   uint8_t                *buff;
   size_t                  buff_size;
   unsigned int            bytes_handled;
+  rtems_sparse_disk_key  *hint = NULL;
 
   rtems_mutex_lock( &sparse_disk->mutex );
 
@@ -244,12 +281,14 @@ static int sparse_disk_read_write(
         rv = sparse_disk_read_block( sparse_disk,
                                      block,
                                      &buff[bytes_handled],
-                                     buff_size );
+                                     buff_size,
+                                     &hint );
       else
         rv = sparse_disk_write_block( sparse_disk,
                                       block,
                                       &buff[bytes_handled],
-                                      buff_size );
+                                      buff_size,
+                                      &hint );
 
       ++block;
       bytes_handled += rv;
@@ -27,6 +27,7 @@
 #include <rtems.h>
 #include <rtems/libio_.h>
 #include <rtems/assoc.h>
+#include <rtems/score/threaddispatch.h>
 
 /* define this to alias O_NDELAY to  O_NONBLOCK, i.e.,
  * O_NDELAY is accepted on input but fcntl(F_GETFL) returns
@@ -106,40 +107,95 @@ int rtems_libio_to_fcntl_flags( unsigned int flags )
   return fcntl_flags;
 }
 
+/*
+ * The free file descriptors are in a bounded multi-producer/multi-consumer
+ * queue.  Each cell has a sequence number.  A cell is ready to be dequeued at
+ * position pos if its sequence number is pos + 1 and it is ready to be
+ * enqueued at position pos if its sequence number is pos.  The positions are
+ * reserved with a compare and exchange, so the allocation and release of file
+ * descriptors need no lock.  Thread dispatching is disabled while a position is
+ * reserved and not yet published, so the time to wait for another operation in
+ * progress is bounded.
+ */
+
 rtems_libio_t *rtems_libio_allocate( void )
 {
-  rtems_libio_t *iop;
-
-  rtems_libio_lock();
-
-  iop = rtems_libio_iop_free_head;
-
-  if ( iop != NULL ) {
-    void *next;
-
-    next = iop->data1;
-    rtems_libio_iop_free_head = next;
+  rtems_libio_free_queue *queue;
+  rtems_libio_free_cell  *cell;
+  Per_CPU_Control        *cpu_self;
+  unsigned int            pos;
+  uint32_t                descriptor;
+
+  if ( rtems_libio_number_iops == 0 ) {
+    return NULL;
+  }
 
-    if ( next == NULL ) {
-      rtems_libio_iop_free_tail = &rtems_libio_iop_free_head;
+  queue = &rtems_libio_iop_free;
+  cpu_self = _Thread_Dispatch_disable();
+  pos = _Atomic_Load_uint( &queue->dequeue, ATOMIC_ORDER_RELAXED );
+
+  while ( true ) {
+    unsigned int sequence;
+    int          delta;
+
+    cell = &rtems_libio_iop_free_cells[ pos & queue->mask ];
+    sequence = _Atomic_Load_uint( &cell->sequence, ATOMIC_ORDER_ACQUIRE );
+    delta = (int) ( sequence - ( pos + 1 ) );
+
+    if ( delta == 0 ) {
+      if (
+        _Atomic_Compare_exchange_uint(
+          &queue->dequeue,
+          &pos,
+          pos + 1,
+          ATOMIC_ORDER_RELAXED,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        break;
+      }
+    } else {
+      /*
+       * If the cell is not filled yet and no enqueue reserved this position,
+       * then there is no free file descriptor, otherwise wait for the enqueue
+       * to publish it.
+       */
+      if (
+        delta < 0
+          && _Atomic_Load_uint( &queue->enqueue, ATOMIC_ORDER_RELAXED ) == pos
+      ) {
+        _Thread_Dispatch_enable( cpu_self );
+        return NULL;
+      }
+
+      pos = _Atomic_Load_uint( &queue->dequeue, ATOMIC_ORDER_RELAXED );
     }
   }
 
-  rtems_libio_unlock();
+  descriptor = cell->descriptor;
+  _Atomic_Store_uint(
+    &cell->sequence,
+    pos + queue->mask + 1,
+    ATOMIC_ORDER_RELEASE
+  );
+
+  _Thread_Dispatch_enable( cpu_self );
 
-  return iop;
+  return rtems_libio_iop( (int) descriptor );
 }
 
 void rtems_libio_free(
   rtems_libio_t *iop
 )
 {
-  size_t zero;
+  rtems_libio_free_queue *queue;
+  rtems_libio_free_cell  *cell;
+  Per_CPU_Control        *cpu_self;
+  unsigned int            pos;
+  size_t                  zero;
 
   rtems_filesystem_location_free( &iop->pathinfo );
 
-  rtems_libio_lock();
-
   /*
    * Clear everything except the reference count part.  At this point in time
    * there may be still some holders of this file descriptor.
@@ -149,11 +205,43 @@ void rtems_libio_free(
   memset( (char *) iop + zero, 0, sizeof( *iop ) - zero );
 
   /*
-   * Append it to the free list.  This increases the likelihood that a use
-   * after close is detected.
+   * Append it to the free queue.  This increases the likelihood that a use
+   * after close is detected.  The queue has a cell for each file descriptor, so
+   * it is only full while a dequeue is in progress.
    */
-  *rtems_libio_iop_free_tail = iop;
-  rtems_libio_iop_free_tail = &iop->data1;
+  queue = &rtems_libio_iop_free;
+  cpu_self = _Thread_Dispatch_disable();
+  pos = _Atomic_Load_uint( &queue->enqueue, ATOMIC_ORDER_RELAXED );
+
+  while ( true ) {
+    unsigned int sequence;
+
+    cell = &rtems_libio_iop_free_cells[ pos & queue->mask ];
+    sequence = _Atomic_Load_uint( &cell->sequence, ATOMIC_ORDER_ACQUIRE );
+
+    if ( sequence == pos ) {
+      if (
+        _Atomic_Compare_exchange_uint(
+          &queue->enqueue,
+          &pos,
+          pos + 1,
+          ATOMIC_ORDER_RELAXED,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        break;
+      }
+    } else {
+      /*
+       * Another enqueue used this position or a dequeue of the cell is in
+       * progress.
+       */
+      pos = _Atomic_Load_uint( &queue->enqueue, ATOMIC_ORDER_RELAXED );
+    }
+  }
+
+  cell->descriptor = (uint32_t) rtems_libio_iop_to_descriptor( iop );
+  _Atomic_Store_uint( &cell->sequence, pos + 1, ATOMIC_ORDER_RELEASE );
 
-  rtems_libio_unlock();
+  _Thread_Dispatch_enable( cpu_self );
 }
@@ -41,22 +41,40 @@ void rtems_libio_unlock( void )
   _API_Mutex_Unlock( &rtems_libio_mutex );
 }
 
-void *rtems_libio_iop_free_head;
-
-void **rtems_libio_iop_free_tail = &rtems_libio_iop_free_head;
+rtems_libio_free_queue rtems_libio_iop_free;
 
 static void rtems_libio_init( void )
 {
+    uint32_t n;
+    uint32_t size;
     uint32_t i;
-    rtems_libio_t *iop;
 
-    if (rtems_libio_number_iops > 0)
+    n = rtems_libio_number_iops;
+
+    if (n > 0)
     {
-        iop = rtems_libio_iop_free_head = &rtems_libio_iops[0];
-        for (i = 0 ; (i + 1) < rtems_libio_number_iops ; i++, iop++)
-          iop->data1 = iop + 1;
-        iop->data1 = NULL;
-        rtems_libio_iop_free_tail = &iop->data1;
+        /*
+         * The configuration provides 2 * n cells, so this ring fits.
+         */
+        size = 1;
+        while (size < n)
+          size <<= 1;
+
+        for (i = 0 ; i < size ; i++)
+        {
+          rtems_libio_free_cell *cell = &rtems_libio_iop_free_cells[ i ];
+
+          /*
+           * The first n cells hold the free file descriptors ready to be
+           * dequeued, the other cells are ready to be enqueued.
+           */
+          cell->descriptor = i;
+          _Atomic_Init_uint( &cell->sequence, i < n ? i + 1 : i );
+        }
+
+        rtems_libio_iop_free.mask = size - 1;
+        _Atomic_Init_uint( &rtems_libio_iop_free.enqueue, n );
+        _Atomic_Init_uint( &rtems_libio_iop_free.dequeue, 0 );
     }
 }
 
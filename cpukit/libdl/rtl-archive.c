@@ -217,10 +217,11 @@ rtems_rtl_archive_find (rtems_rtl_archives* archives,
  *
  * The symbol search is performance sensitive. The archive's symbol table being
  * searched is the symbol table in the archive created by ranlib. This table is
- * not sorted so a sorted table of pointeres to the symbols is generated after
- * loading if there are enough symbols. For small symbol tables the search is
- * linear. The entire table is held in memory. At the time of writing this code
- * the symbol table for the SPARC architecture's libc is 16k.
+ * not sorted so a hash table of the symbols is generated after loading. The
+ * search hashes the symbol and compares the labels in the hash bucket. If
+ * there is no memory for the hash table the search is linear. The entire table
+ * is held in memory. At the time of writing this code the symbol table for the
+ * SPARC architecture's libc is 16k.
  *
  * The ranlib table is:
  *
@@ -242,16 +243,6 @@ typedef struct rtems_rtl_archive_obj_data
                                 *   else 0 */
 } rtems_rtl_archive_obj_data;
 
-static int
-rtems_rtl_archive_symbol_compare (const void* a, const void* b)
-{
-  const rtems_rtl_archive_symbol* sa;
-  const rtems_rtl_archive_symbol* sb;
-  sa = (const rtems_rtl_archive_symbol*) a;
-  sb = (const rtems_rtl_archive_symbol*) b;
-  return strcmp (sa->label, sb->label);
-}
-
 static bool
 rtems_rtl_archive_obj_finder (rtems_rtl_archive* archive, void* data)
 {
@@ -267,7 +258,7 @@ rtems_rtl_archive_obj_finder (rtems_rtl_archive* archive, void* data)
   if (symbols->base != NULL)
   {
     /*
-     * Perform a linear search if there is no sorted symbol table.
+     * Perform a linear search if there is no hashed symbol table.
      */
     rtems_rtl_archive_obj_data* search = (rtems_rtl_archive_obj_data*) data;
     if (symbols->symbols == NULL)
@@ -288,22 +279,19 @@ rtems_rtl_archive_obj_finder (rtems_rtl_archive* archive, void* data)
     }
     else
     {
-      rtems_rtl_archive_symbol*      match;
-      const rtems_rtl_archive_symbol key = {
-        .entry = -1,
-        .label = search->symbol
-      };
-      match = bsearch (&key,
-                       symbols->symbols,
-                       symbols->entries,
-                       sizeof (symbols->symbols[0]),
-                       rtems_rtl_archive_symbol_compare);
-      if (match != NULL)
+      uint32_t hash = rtems_rtl_symbol_hash (search->symbol);
+      uint32_t next = symbols->buckets[hash % symbols->nbuckets];
+      while (next != 0)
       {
+        const rtems_rtl_archive_symbol* match = &symbols->symbols[next - 1];
+        if (match->hash == hash && strcmp (search->symbol, match->label) == 0)
+        {
           search->archive = archive;
           search->offset =
             rtems_rtl_archive_read_32 (symbols->base + (match->entry * 4));
           return false;
+        }
+        next = match->next;
       }
     }
   }
@@ -640,6 +628,14 @@ rtems_rtl_archive_loader (rtems_rtl_archive* archive, void* data)
         printf ("rtl: archive: loader: symbols: off=0x%08jx size=%zu\n",
                 offset, size);
 
+      /*
+       * The hashed symbol table is created again for the loaded table.
+       */
+      rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_SYMBOL, archive->symbols.symbols);
+      archive->symbols.symbols = NULL;
+      archive->symbols.buckets = NULL;
+      archive->symbols.nbuckets = 0;
+
       /*
        * Reallocate the symbol table memory if it has changed size.
        * Note, an updated library may have the same symbol table.
@@ -677,7 +673,8 @@ rtems_rtl_archive_loader (rtems_rtl_archive* archive, void* data)
        */
       archive->symbols.entries =
         rtems_rtl_archive_read_32 (archive->symbols.base);
-      if (archive->symbols.entries >= (SIZE_MAX / sizeof (rtems_rtl_archive_symbol)))
+      if (archive->symbols.entries >=
+          (SIZE_MAX / (sizeof (rtems_rtl_archive_symbol) + sizeof (uint32_t))))
       {
         rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_SYMBOL, archive->symbols.base);
         close (fd);
@@ -691,25 +688,43 @@ rtems_rtl_archive_loader (rtems_rtl_archive* archive, void* data)
       archive->symbols.names += (archive->symbols.entries + 1) * 4;
 
       /*
-       * Create a sorted symbol table.
+       * Create a hashed symbol table. There is a bucket for each symbol. The
+       * buckets are held after the symbols in the same allocation. The
+       * symbols are linked into the buckets last to first so a bucket's
+       * symbols are in the ranlib table's order and the first object file
+       * with a symbol is found.
        */
-      size = archive->symbols.entries * sizeof (rtems_rtl_archive_symbol);
+      archive->symbols.nbuckets =
+        archive->symbols.entries > 0 ? archive->symbols.entries : 1;
+      size = (archive->symbols.entries * sizeof (rtems_rtl_archive_symbol)) +
+        (archive->symbols.nbuckets * sizeof (uint32_t));
       archive->symbols.symbols =
         rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_SYMBOL, size, true);
       if (archive->symbols.symbols != NULL)
       {
         const char* symbol = archive->symbols.names;
         size_t      e;
+        archive->symbols.buckets =
+          (uint32_t*) &archive->symbols.symbols[archive->symbols.entries];
         for (e = 0; e < archive->symbols.entries; ++e)
         {
           archive->symbols.symbols[e].entry = e + 1;
           archive->symbols.symbols[e].label = symbol;
+          archive->symbols.symbols[e].hash = rtems_rtl_symbol_hash (symbol);
           symbol += strlen (symbol) + 1;
         }
-        qsort (archive->symbols.symbols,
-               archive->symbols.entries,
-               sizeof (rtems_rtl_archive_symbol),
-               rtems_rtl_archive_symbol_compare);
+        for (e = archive->symbols.entries; e > 0; --e)
+        {
+          rtems_rtl_archive_symbol* sym = &archive->symbols.symbols[e - 1];
+          size_t                    bucket;
+          bucket = sym->hash % archive->symbols.nbuckets;
+          sym->next = archive->symbols.buckets[bucket];
+          archive->symbols.buckets[bucket] = e;
+        }
+      }
+      else
+      {
+        archive->symbols.nbuckets = 0;
       }
 
       if (rtems_rtl_trace (RTEMS_RTL_TRACE_ARCHIVES))
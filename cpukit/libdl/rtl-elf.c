@@ -30,6 +30,7 @@
 #include <rtems/rtl/rtl.h>
 #include "rtl-elf.h"
 #include "rtl-error.h"
+#include "rtl-reloc-cache.h"
 #include <rtems/rtl/rtl-trace.h>
 #include "rtl-trampoline.h"
 #include "rtl-unwind.h"
@@ -206,8 +207,10 @@ typedef bool (*rtems_rtl_elf_reloc_handler)(rtems_rtl_obj*      obj,
  */
 typedef struct
 {
-  size_t dependents; /**< The number of dependent object files. */
-  size_t unresolved; /**< The number of unresolved symbols. */
+  size_t                dependents; /**< The number of dependent object
+                                     *   files. */
+  size_t                unresolved; /**< The number of unresolved symbols. */
+  rtems_rtl_reloc_cache cache;      /**< The relocation cache. */
 } rtems_rtl_elf_reloc_data;
 
 static bool
@@ -397,6 +400,7 @@ rtems_rtl_elf_relocate_worker (rtems_rtl_obj*              obj,
                                int                         fd,
                                rtems_rtl_obj_sect*         sect,
                                rtems_rtl_elf_reloc_handler handler,
+                               rtems_rtl_elf_reloc_data*   rd,
                                void*                       data)
 {
   rtems_rtl_obj_cache* symbols;
@@ -464,6 +468,7 @@ rtems_rtl_elf_relocate_worker (rtems_rtl_obj*              obj,
     const char*        symname = NULL;
     off_t              off;
     Elf_Word           rel_type;
+    Elf_Word           symindex;
     Elf_Word           symvalue = 0;
     bool               resolved;
 
@@ -477,20 +482,38 @@ rtems_rtl_elf_relocate_worker (rtems_rtl_obj*              obj,
      * Read the symbol details.
      */
     if (is_rela)
-      off = (obj->ooffset + symsect->offset +
-             (ELF_R_SYM (rela->r_info) * sizeof (sym)));
+    {
+      symindex = ELF_R_SYM (rela->r_info);
+      rel_type = ELF_R_TYPE(rela->r_info);
+    }
     else
-      off = (obj->ooffset + symsect->offset +
-             (ELF_R_SYM (rel->r_info) * sizeof (sym)));
+    {
+      symindex = ELF_R_SYM (rel->r_info);
+      rel_type = ELF_R_TYPE(rel->r_info);
+    }
+
+    off = obj->ooffset + symsect->offset + (symindex * sizeof (sym));
 
     if (!rtems_rtl_obj_cache_read_byval (symbols, fd, off,
                                          &sym, sizeof (sym)))
       return false;
 
+    /*
+     * A symbol resolved to the base image on a previous load does not need
+     * the name or a search of the symbol tables.
+     */
+    if (rtems_rtl_elf_rel_resolve_sym (rel_type))
+      symbol = rtems_rtl_reloc_cache_find (&rd->cache, symindex);
+
+    if (symbol != NULL)
+    {
+      symname = symbol->name;
+      symvalue = (Elf_Addr) symbol->value;
+    }
     /*
      * Only need the name of the symbol if global or a common symbol.
      */
-    if (ELF_ST_TYPE (sym.st_info) == STT_OBJECT ||
+    else if (ELF_ST_TYPE (sym.st_info) == STT_OBJECT ||
         ELF_ST_TYPE (sym.st_info) == STT_COMMON ||
         ELF_ST_TYPE (sym.st_info) == STT_FUNC ||
         ELF_ST_TYPE (sym.st_info) == STT_NOTYPE ||
@@ -512,17 +535,16 @@ rtems_rtl_elf_relocate_worker (rtems_rtl_obj*              obj,
      * having unresolved externals and store the external. The load of an
      * object after this one may provide the unresolved externals.
      */
-    if (is_rela)
-      rel_type = ELF_R_TYPE(rela->r_info);
-    else
-      rel_type = ELF_R_TYPE(rel->r_info);
-
     resolved = true;
 
-    if (rtems_rtl_elf_rel_resolve_sym (rel_type))
+    if (symbol == NULL && rtems_rtl_elf_rel_resolve_sym (rel_type))
+    {
       resolved = rtems_rtl_elf_find_symbol (obj,
                                             &sym, symname,
                                             &symbol, &symvalue);
+      if (resolved && symbol != NULL)
+        rtems_rtl_reloc_cache_add (&rd->cache, symindex, symbol);
+    }
 
     if (!handler (obj,
                   is_rela, relbuf, targetsect,
@@ -547,7 +569,8 @@ rtems_rtl_elf_relocs_parser (rtems_rtl_obj*      obj,
                              void*               data)
 {
   bool r = rtems_rtl_elf_relocate_worker (obj, fd, sect,
-                                          rtems_rtl_elf_reloc_parser, data);
+                                          rtems_rtl_elf_reloc_parser,
+                                          data, data);
   return r;
 }
 
@@ -558,7 +581,8 @@ rtems_rtl_elf_relocs_locator (rtems_rtl_obj*      obj,
                               void*               data)
 {
   return rtems_rtl_elf_relocate_worker (obj, fd, sect,
-                                        rtems_rtl_elf_reloc_relocator, data);
+                                        rtems_rtl_elf_reloc_relocator,
+                                        data, data);
 }
 
 bool
@@ -1249,8 +1273,24 @@ rtems_rtl_elf_loader (rtems_rtl_obj*      obj,
                       rtems_rtl_obj_sect* sect,
                       void*               data)
 {
-  uint8_t* base_offset;
-  size_t   len;
+  rtems_rtl_obj_cache* sects;
+  const void*          image;
+  uint8_t*             base_offset;
+  size_t               len;
+
+  /*
+   * Copy the section from an object file held in memory without a seek and
+   * read.
+   */
+  rtems_rtl_obj_caches (&sects, NULL, NULL);
+
+  if (sects != NULL &&
+      rtems_rtl_obj_cache_mapped (sects, fd, obj->ooffset + sect->offset,
+                                  &image, sect->size))
+  {
+    memcpy (sect->base, image, sect->size);
+    return true;
+  }
 
   if (lseek (fd, obj->ooffset + sect->offset, SEEK_SET) < 0)
   {
@@ -1637,6 +1677,69 @@ rtems_rtl_elf_load_linkmap (rtems_rtl_obj* obj)
   return true;
 }
 
+static size_t
+rtems_rtl_elf_symbol_count (rtems_rtl_obj* obj)
+{
+  rtems_rtl_obj_sect* symsect = rtems_rtl_obj_find_section (obj, ".symtab");
+  if (!symsect)
+    return 0;
+  return symsect->size / sizeof (Elf_Sym);
+}
+
+static bool
+rtems_rtl_elf_relocate (rtems_rtl_obj*            obj,
+                        int                       fd,
+                        Elf_Ehdr*                 ehdr,
+                        rtems_rtl_elf_reloc_data* relocs)
+{
+  /*
+   * Parse the relocation records. It lets us know how many dependents
+   * and fixup trampolines there are.
+   */
+  if (!rtems_rtl_obj_relocate (obj, fd, rtems_rtl_elf_relocs_parser, relocs))
+    return false;
+
+  /*
+   * Lock the allocator so the section memory and the trampoline memory are as
+   * clock as possible.
+   */
+  rtems_rtl_alloc_lock ();
+
+  /*
+   * Allocate the sections.
+   */
+  if (!rtems_rtl_obj_alloc_sections (obj, fd, rtems_rtl_elf_arch_alloc, ehdr))
+    return false;
+
+  if (!rtems_rtl_obj_load_symbols (obj, fd, rtems_rtl_elf_symbols_locate, ehdr))
+    return false;
+
+  if (!rtems_rtl_elf_dependents (obj, relocs))
+    return false;
+
+  if (!rtems_rtl_elf_alloc_trampoline (obj, relocs->unresolved))
+    return false;
+
+  /*
+   * Unlock the allocator.
+   */
+  rtems_rtl_alloc_unlock ();
+
+  /*
+   * Load the sections and symbols and then relocation to the base address.
+   */
+  if (!rtems_rtl_obj_load_sections (obj, fd, rtems_rtl_elf_loader, ehdr))
+    return false;
+
+  /*
+   * Fix up the relocations.
+   */
+  if (!rtems_rtl_obj_relocate (obj, fd, rtems_rtl_elf_relocs_locator, relocs))
+    return false;
+
+  return true;
+}
+
 bool
 rtems_rtl_elf_file_load (rtems_rtl_obj* obj, int fd)
 {
@@ -1644,6 +1747,7 @@ rtems_rtl_elf_file_load (rtems_rtl_obj* obj, int fd)
   Elf_Ehdr                  ehdr;
   rtems_rtl_elf_reloc_data  relocs = { 0 };
   rtems_rtl_elf_common_data common = { 0 };
+  bool                      ok;
 
   rtems_rtl_obj_caches (&header, NULL, NULL);
 
@@ -1727,48 +1831,18 @@ rtems_rtl_elf_file_load (rtems_rtl_obj* obj, int fd)
     return false;
 
   /*
-   * Parse the relocation records. It lets us know how many dependents
-   * and fixup trampolines there are.
+   * Open the relocation cache, relocate and then update the cache file if
+   * the cache file was not valid.
    */
-  if (!rtems_rtl_obj_relocate (obj, fd, rtems_rtl_elf_relocs_parser, &relocs))
+  if (!rtems_rtl_reloc_cache_open (&relocs.cache, obj, fd,
+                                   rtems_rtl_elf_symbol_count (obj)))
     return false;
 
-  /*
-   * Lock the allocator so the section memory and the trampoline memory are as
-   * clock as possible.
-   */
-  rtems_rtl_alloc_lock ();
-
-  /*
-   * Allocate the sections.
-   */
-  if (!rtems_rtl_obj_alloc_sections (obj, fd, rtems_rtl_elf_arch_alloc, &ehdr))
-    return false;
-
-  if (!rtems_rtl_obj_load_symbols (obj, fd, rtems_rtl_elf_symbols_locate, &ehdr))
-    return false;
-
-  if (!rtems_rtl_elf_dependents (obj, &relocs))
-    return false;
-
-  if (!rtems_rtl_elf_alloc_trampoline (obj, relocs.unresolved))
-    return false;
+  ok = rtems_rtl_elf_relocate (obj, fd, &ehdr, &relocs);
 
-  /*
-   * Unlock the allocator.
-   */
-  rtems_rtl_alloc_unlock ();
+  rtems_rtl_reloc_cache_close (&relocs.cache, ok);
 
-  /*
-   * Load the sections and symbols and then relocation to the base address.
-   */
-  if (!rtems_rtl_obj_load_sections (obj, fd, rtems_rtl_elf_loader, &ehdr))
-    return false;
-
-  /*
-   * Fix up the relocations.
-   */
-  if (!rtems_rtl_obj_relocate (obj, fd, rtems_rtl_elf_relocs_locator, &ehdr))
+  if (!ok)
     return false;
 
   rtems_rtl_symbol_obj_erase_local (obj);
@@ -23,7 +23,10 @@
 #include <string.h>
 #include <unistd.h>
 #include <inttypes.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <rtems/inttypes.h>
+#include <rtems/libio_.h>
 
 #include <rtems/rtl/rtl-allocator.h>
 #include <rtems/rtl/rtl-obj-cache.h>
@@ -38,6 +41,7 @@ rtems_rtl_obj_cache_open (rtems_rtl_obj_cache* cache, size_t size)
   cache->offset    = 0;
   cache->size      = size;
   cache->level     = 0;
+  cache->mem       = NULL;
   cache->buffer    = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT, size, false);
   if (!cache->buffer)
   {
@@ -57,6 +61,7 @@ rtems_rtl_obj_cache_close (rtems_rtl_obj_cache* cache)
   cache->fd        = -1;
   cache->file_size = 0;
   cache->level     = 0;
+  cache->mem       = NULL;
 }
 
 void
@@ -68,6 +73,51 @@ rtems_rtl_obj_cache_flush (rtems_rtl_obj_cache* cache)
   cache->file_size = 0;
   cache->offset    = 0;
   cache->level     = 0;
+  cache->mem       = NULL;
+}
+
+static bool
+rtems_rtl_obj_cache_attach (rtems_rtl_obj_cache* cache, int fd)
+{
+  struct stat sb;
+
+  if (fstat (fd, &sb) < 0)
+  {
+    rtems_rtl_set_error (errno, "file stat failed");
+    return false;
+  }
+
+  cache->fd        = fd;
+  cache->file_size = sb.st_size;
+  cache->offset    = 0;
+  cache->level     = 0;
+  cache->mem       = NULL;
+
+  /*
+   * A file already held in memory, for example a file of a tar image loaded
+   * into the IMFS, is referenced in place if the file system can map it.
+   *
+   * The handler is called directly since mmap() rejects a mapping which
+   * reaches the end of a regular file (off + len >= st_size), so the whole
+   * file cannot be mapped. A file system without support sets errno, which
+   * is restored as the probe failing is not an error.
+   */
+  if (S_ISREG (sb.st_mode) && (sb.st_size > 0))
+  {
+    rtems_libio_t* iop = rtems_libio_iop (fd);
+    void*          addr = NULL;
+    int            saved_errno = errno;
+    if ((*iop->pathinfo.handlers->mmap_h) (iop, &addr, cache->file_size,
+                                           PROT_READ, 0) == 0)
+      cache->mem = addr;
+    errno = saved_errno;
+  }
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_CACHE))
+    printf ("rtl: cache: %2d: attach: size=%zu mem=%p\n",
+            fd, cache->file_size, cache->mem);
+
+  return true;
 }
 
 bool
@@ -77,8 +127,6 @@ rtems_rtl_obj_cache_read (rtems_rtl_obj_cache* cache,
                           void**               buffer,
                           size_t*              length)
 {
-  struct stat sb;
-
   if (rtems_rtl_trace (RTEMS_RTL_TRACE_CACHE))
     printf ("rtl: cache: %2d: fd=%d offset=%" PRIdoff_t " length=%zu area=[%"
             PRIdoff_t ",%" PRIdoff_t "] cache=[%" PRIdoff_t ",%" PRIdoff_t "] size=%zu\n",
@@ -87,31 +135,40 @@ rtems_rtl_obj_cache_read (rtems_rtl_obj_cache* cache,
             cache->offset, cache->offset + cache->level,
             cache->file_size);
 
-  if (*length > cache->size)
+  if ((cache->fd != fd) && !rtems_rtl_obj_cache_attach (cache, fd))
+    return false;
+
+  if ((cache->mem == NULL) && (*length > cache->size))
   {
     rtems_rtl_set_error (EINVAL, "read size larger than cache size");
     return false;
   }
 
-  if (cache->fd == fd)
+  if (offset >= cache->file_size)
   {
-    if (offset >= cache->file_size)
-    {
-      rtems_rtl_set_error (EINVAL, "offset past end of file: offset=%i size=%i",
-                           (int) offset, (int) cache->file_size);
-      return false;
-    }
+    rtems_rtl_set_error (EINVAL, "offset past end of file: offset=%i size=%i",
+                         (int) offset, (int) cache->file_size);
+    return false;
+  }
 
-    /*
-     * We sometimes are asked to read strings of a length we do not know.
-     */
-    if ((offset + *length) > cache->file_size)
-    {
-      *length = cache->file_size - offset;
-      if (rtems_rtl_trace (RTEMS_RTL_TRACE_CACHE))
-        printf ("rtl: cache: %2d: truncate length=%d\n", fd, (int) *length);
+  /*
+   * We sometimes are asked to read strings of a length we do not know.
+   */
+  if ((offset + *length) > cache->file_size)
+  {
+    *length = cache->file_size - offset;
+    if (rtems_rtl_trace (RTEMS_RTL_TRACE_CACHE))
+      printf ("rtl: cache: %2d: truncate length=%d\n", fd, (int) *length);
 
-    }
+  }
+
+  /*
+   * A memory resident file is referenced in place.
+   */
+  if (cache->mem != NULL)
+  {
+    *buffer = (void*) (cache->mem + offset);
+    return true;
   }
 
   while (true)
@@ -120,59 +177,53 @@ rtems_rtl_obj_cache_read (rtems_rtl_obj_cache* cache,
     size_t buffer_read = cache->size;
 
     /*
-     * Is the data in the cache for this file ?
+     * Do not read past the end of the file.
      */
-    if (fd == cache->fd)
+    if ((offset + buffer_read) > cache->file_size)
+      buffer_read = cache->file_size - offset;
+
+    /*
+     * Is any part of the data in the cache ?
+     */
+    if ((offset >= cache->offset) &&
+        (offset < (cache->offset + cache->level)))
     {
+      size_t size;
+
+      buffer_offset = offset - cache->offset;
+      size          = cache->level - buffer_offset;
+
       /*
-       * Do not read past the end of the file.
+       * Return the location of the data in the cache.
        */
-      if ((offset + buffer_read) > cache->file_size)
-        buffer_read = cache->file_size - offset;
+      *buffer = cache->buffer + buffer_offset;
 
       /*
-       * Is any part of the data in the cache ?
+       * Is all the data in the cache or just a part ?
        */
-      if ((offset >= cache->offset) &&
-          (offset < (cache->offset + cache->level)))
-      {
-        size_t size;
+      if (*length <= size)
+        return true;
 
-        buffer_offset = offset - cache->offset;
-        size          = cache->level - buffer_offset;
+      if (rtems_rtl_trace (RTEMS_RTL_TRACE_CACHE))
+        printf ("rtl: cache: %2d: copy-down: buffer_offset=%d size=%d level=%d\n",
+                fd, (int) buffer_offset, (int) size, (int) cache->level);
 
-        /*
-         * Return the location of the data in the cache.
-         */
-        *buffer = cache->buffer + buffer_offset;
+      /*
+       * Copy down the data in the buffer and then fill the remaining space
+       * with as much data we are able to read.
+       */
+      memmove (cache->buffer, cache->buffer + buffer_offset, size);
 
-        /*
-         * Is all the data in the cache or just a part ?
-         */
-        if (*length <= size)
-          return true;
+      cache->offset = offset;
+      cache->level  = size;
+      buffer_read   = cache->size - cache->level;
+      buffer_offset = size;
 
-        if (rtems_rtl_trace (RTEMS_RTL_TRACE_CACHE))
-          printf ("rtl: cache: %2d: copy-down: buffer_offset=%d size=%d level=%d\n",
-                  fd, (int) buffer_offset, (int) size, (int) cache->level);
-
-        /*
-         * Copy down the data in the buffer and then fill the remaining space
-         * with as much data we are able to read.
-         */
-        memmove (cache->buffer, cache->buffer + buffer_offset, size);
-
-        cache->offset = offset;
-        cache->level  = size;
-        buffer_read   = cache->size - cache->level;
-        buffer_offset = size;
-
-        /*
-         * Do not read past the end of the file.
-         */
-        if ((offset + buffer_offset + buffer_read) > cache->file_size)
-          buffer_read = cache->file_size - (offset + buffer_offset);
-      }
+      /*
+       * Do not read past the end of the file.
+       */
+      if ((offset + buffer_offset + buffer_read) > cache->file_size)
+        buffer_read = cache->file_size - (offset + buffer_offset);
     }
 
     if (rtems_rtl_trace (RTEMS_RTL_TRACE_CACHE))
@@ -220,19 +271,6 @@ rtems_rtl_obj_cache_read (rtems_rtl_obj_cache* cache,
     }
 
     cache->offset = offset;
-
-    if (cache->fd != fd)
-    {
-      cache->fd = fd;
-
-      if (fstat (cache->fd, &sb) < 0)
-      {
-        rtems_rtl_set_error (errno, "file stat failed");
-        return false;
-      }
-
-      cache->file_size = sb.st_size;
-    }
   }
 
   return false;
@@ -254,3 +292,19 @@ rtems_rtl_obj_cache_read_byval (rtems_rtl_obj_cache* cache,
     memcpy (buffer, cbuffer, length);
   return ok;
 }
+
+bool
+rtems_rtl_obj_cache_mapped (rtems_rtl_obj_cache* cache,
+                            int                  fd,
+                            off_t                offset,
+                            const void**         buffer,
+                            size_t               length)
+{
+  if ((cache->fd != fd) && !rtems_rtl_obj_cache_attach (cache, fd))
+    return false;
+  if ((cache->mem == NULL) ||
+      (offset > cache->file_size) || (length > (cache->file_size - offset)))
+    return false;
+  *buffer = cache->mem + offset;
+  return true;
+}
@@ -0,0 +1,319 @@
+/*
+ *  COPYRIGHT (c) 2026 agent <agent@local>
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+/**
+ * @file
+ *
+ * @ingroup rtems_rtl
+ *
+ * @brief RTEMS Run-Time Linker Object File Relocation Cache.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/rtl/rtl.h>
+#include "rtl-error.h"
+#include "rtl-reloc-cache.h"
+#include "rtl-string.h"
+#include <rtems/rtl/rtl-trace.h>
+
+/**
+ * The cache file's magic number, "RLC1".
+ */
+#define RTEMS_RTL_RELOC_CACHE_MAGIC (0x524c4331UL)
+
+/**
+ * The cache file's header. The table of symbol indexes follows the header.
+ */
+typedef struct
+{
+  uint32_t magic;     /**< The magic number. */
+  uint32_t count;     /**< The number of symbols in the table. */
+  uint64_t base_hash; /**< The hash of the base image's symbol table. */
+  uint64_t obj_hash;  /**< The hash of the object file. */
+} rtems_rtl_reloc_cache_header;
+
+#define RTEMS_RTL_RELOC_CACHE_HASH_INIT (0xcbf29ce484222325ULL)
+
+/*
+ * FNV-1a
+ */
+static uint64_t
+rtems_rtl_reloc_cache_hash (uint64_t hash, const void* data, size_t size)
+{
+  const uint8_t* p = data;
+  while (size-- > 0)
+  {
+    hash ^= *p++;
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+static uint64_t
+rtems_rtl_reloc_cache_base_hash (rtems_rtl_data* rtl)
+{
+  if (rtl->base_hash == 0)
+  {
+    uint64_t hash = RTEMS_RTL_RELOC_CACHE_HASH_INIT;
+    size_t   s;
+
+    for (s = 0; s < rtl->base->global_syms; ++s)
+    {
+      const rtems_rtl_obj_sym* sym = &rtl->base->global_table[s];
+      hash = rtems_rtl_reloc_cache_hash (hash, sym->name,
+                                         strlen (sym->name) + 1);
+      hash = rtems_rtl_reloc_cache_hash (hash, &sym->value,
+                                         sizeof (sym->value));
+    }
+
+    /*
+     * Zero means not computed.
+     */
+    if (hash == 0)
+      hash = 1;
+
+    rtl->base_hash = hash;
+  }
+
+  return rtl->base_hash;
+}
+
+static bool
+rtems_rtl_reloc_cache_obj_hash (rtems_rtl_obj* obj, int fd, uint64_t* hash)
+{
+  rtems_rtl_obj_cache* cache;
+  off_t                offset = 0;
+
+  rtems_rtl_obj_caches (&cache, NULL, NULL);
+
+  if (!cache)
+    return false;
+
+  *hash = rtems_rtl_reloc_cache_hash (RTEMS_RTL_RELOC_CACHE_HASH_INIT,
+                                      &obj->fsize, sizeof (obj->fsize));
+
+  while (offset < (off_t) obj->fsize)
+  {
+    void*  data;
+    size_t len = obj->fsize - offset;
+
+    if (len > cache->size)
+      len = cache->size;
+
+    if (!rtems_rtl_obj_cache_read (cache, fd, obj->ooffset + offset,
+                                   &data, &len))
+      return false;
+
+    *hash = rtems_rtl_reloc_cache_hash (*hash, data, len);
+    offset += len;
+  }
+
+  return true;
+}
+
+static void
+rtems_rtl_reloc_cache_name (const char*                  path,
+                            const rtems_rtl_reloc_cache* cache,
+                            char*                        name,
+                            size_t                       size)
+{
+  snprintf (name, size, "%s/%016" PRIx64 ".rlc", path, cache->hash);
+}
+
+static bool
+rtems_rtl_reloc_cache_load (rtems_rtl_reloc_cache* cache,
+                            const char*            name,
+                            uint64_t               base_hash)
+{
+  rtems_rtl_reloc_cache_header header;
+  size_t                       size;
+  size_t                       s;
+  ssize_t                      r;
+  int                          fd;
+
+  fd = open (name, O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  r = read (fd, &header, sizeof (header));
+  if (r != sizeof (header) ||
+      header.magic != RTEMS_RTL_RELOC_CACHE_MAGIC ||
+      header.count != cache->count ||
+      header.base_hash != base_hash ||
+      header.obj_hash != cache->hash)
+  {
+    close (fd);
+    return false;
+  }
+
+  size = cache->count * sizeof (cache->syms[0]);
+  r = read (fd, cache->syms, size);
+  close (fd);
+
+  if (r != (ssize_t) size)
+    return false;
+
+  for (s = 0; s < cache->count; ++s)
+  {
+    if (cache->syms[s] > cache->base_count)
+      return false;
+  }
+
+  return true;
+}
+
+bool
+rtems_rtl_reloc_cache_open (rtems_rtl_reloc_cache* cache,
+                            rtems_rtl_obj*         obj,
+                            int                    fd,
+                            size_t                 count)
+{
+  rtems_rtl_data* rtl = rtems_rtl_data_unprotected ();
+  char            name[PATH_MAX];
+  uint64_t        base_hash;
+
+  *cache = (rtems_rtl_reloc_cache) { 0 };
+
+  if (!rtl || !rtl->reloc_cache || !rtl->base->global_table || count == 0)
+    return true;
+
+  cache->base_syms = rtl->base->global_table;
+  cache->base_count = rtl->base->global_syms;
+  cache->count = count;
+
+  if (!rtems_rtl_reloc_cache_obj_hash (obj, fd, &cache->hash))
+    return false;
+
+  cache->syms = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT,
+                                     count * sizeof (cache->syms[0]), true);
+  if (!cache->syms)
+  {
+    rtems_rtl_set_error (ENOMEM, "no memory for relocation cache");
+    return false;
+  }
+
+  base_hash = rtems_rtl_reloc_cache_base_hash (rtl);
+
+  rtems_rtl_reloc_cache_name (rtl->reloc_cache, cache, name, sizeof (name));
+
+  cache->valid = rtems_rtl_reloc_cache_load (cache, name, base_hash);
+  if (!cache->valid)
+    memset (cache->syms, 0, count * sizeof (cache->syms[0]));
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_RELOC))
+    printf ("rtl: reloc cache: %s: %s %s\n",
+            rtems_rtl_obj_oname (obj), name, cache->valid ? "hit" : "miss");
+
+  return true;
+}
+
+void
+rtems_rtl_reloc_cache_close (rtems_rtl_reloc_cache* cache, bool loaded)
+{
+  rtems_rtl_data* rtl = rtems_rtl_data_unprotected ();
+
+  if (!cache->syms)
+    return;
+
+  if (loaded && !cache->valid && rtl->reloc_cache)
+  {
+    rtems_rtl_reloc_cache_header header;
+    char                         name[PATH_MAX];
+    size_t                       size;
+    bool                         ok = false;
+    int                          fd;
+
+    header.magic = RTEMS_RTL_RELOC_CACHE_MAGIC;
+    header.count = cache->count;
+    header.base_hash = rtems_rtl_reloc_cache_base_hash (rtl);
+    header.obj_hash = cache->hash;
+
+    size = cache->count * sizeof (cache->syms[0]);
+
+    rtems_rtl_reloc_cache_name (rtl->reloc_cache, cache, name, sizeof (name));
+
+    /*
+     * The cache is only an optimisation. A cache file that cannot be written
+     * is removed and the object file is loaded without it the next time.
+     */
+    fd = open (name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0)
+    {
+      ok = (write (fd, &header, sizeof (header)) == sizeof (header)) &&
+        (write (fd, cache->syms, size) == (ssize_t) size);
+      if (close (fd) < 0)
+        ok = false;
+      if (!ok)
+        unlink (name);
+    }
+
+    if (rtems_rtl_trace (RTEMS_RTL_TRACE_RELOC))
+      printf ("rtl: reloc cache: %s %s\n", name, ok ? "written" : "failed");
+  }
+
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, cache->syms);
+  cache->syms = NULL;
+}
+
+rtems_rtl_obj_sym*
+rtems_rtl_reloc_cache_find (const rtems_rtl_reloc_cache* cache, size_t index)
+{
+  if (!cache->valid || index >= cache->count || cache->syms[index] == 0)
+    return NULL;
+  return &cache->base_syms[cache->syms[index] - 1];
+}
+
+void
+rtems_rtl_reloc_cache_add (rtems_rtl_reloc_cache*   cache,
+                           size_t                   index,
+                           const rtems_rtl_obj_sym* symbol)
+{
+  if (cache->syms != NULL && !cache->valid && index < cache->count &&
+      symbol >= cache->base_syms &&
+      symbol < &cache->base_syms[cache->base_count])
+    cache->syms[index] = (symbol - cache->base_syms) + 1;
+}
+
+bool
+rtems_rtl_reloc_cache_set_path (const char* path)
+{
+  rtems_rtl_data* rtl;
+  char*           dup = NULL;
+
+  rtl = rtems_rtl_lock ();
+  if (!rtl)
+    return false;
+
+  if (path != NULL)
+  {
+    dup = rtems_rtl_strdup (path);
+    if (!dup)
+    {
+      rtems_rtl_set_error (ENOMEM, "no memory for relocation cache path");
+      rtems_rtl_unlock ();
+      return false;
+    }
+  }
+
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, (void*) rtl->reloc_cache);
+  rtl->reloc_cache = dup;
+
+  rtems_rtl_unlock ();
+
+  return true;
+}
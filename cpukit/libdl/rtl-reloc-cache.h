@@ -0,0 +1,112 @@
+/*
+ *  COPYRIGHT (c) 2026 agent <agent@local>
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+/**
+ * @file
+ *
+ * @ingroup rtems_rtl
+ *
+ * @brief RTEMS Run-Time Linker Object File Relocation Cache.
+ *
+ * The relocation records of an object file reference symbols by name. Each
+ * reference to a symbol the object file does not define is found by hashing
+ * the name and searching the global symbol table. An object file loaded
+ * with the same base image on every boot resolves the same references to the
+ * same base image symbols every time.
+ *
+ * The relocation cache holds the base image symbol each symbol of an object
+ * file resolves to in a cache file. The cache file's name is the hash of the
+ * object file's data and the cache file holds the hash of the base image's
+ * symbol table. An object file with a valid cache file resolves these
+ * symbols with a table lookup. A changed object file has a different cache
+ * file and a changed base image invalidates the cache file. References to
+ * symbols of other object files are resolved by name as the address of an
+ * object file can change between loads.
+ *
+ * The relocation cache is disabled until a directory for the cache files is
+ * set with @ref rtems_rtl_reloc_cache_set_path.
+ */
+
+#if !defined (_RTEMS_RTL_RELOC_CACHE_H_)
+#define _RTEMS_RTL_RELOC_CACHE_H_
+
+#include <rtems/rtl/rtl-obj.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * The relocation cache of an object file being loaded.
+ */
+typedef struct rtems_rtl_reloc_cache
+{
+  uint32_t*          syms;       /**< The base image symbol index plus one of
+                                  *   each symbol, 0 if not resolved to the
+                                  *   base image. NULL if disabled. */
+  size_t             count;      /**< The number of symbols. */
+  rtems_rtl_obj_sym* base_syms;  /**< The base image symbol table. */
+  size_t             base_count; /**< The number of base image symbols. */
+  uint64_t           hash;       /**< The hash of the object file. */
+  bool               valid;      /**< The table was read from the cache
+                                  *   file. */
+} rtems_rtl_reloc_cache;
+
+/**
+ * Open the relocation cache of an object file. The table is read from the
+ * cache file if it is valid for the object file and the base image else the
+ * table is empty and filled as the symbols are resolved. The cache is
+ * disabled if no cache directory is set.
+ *
+ * @param cache The relocation cache to open.
+ * @param obj The object file being loaded.
+ * @param fd The file descriptor of the object file.
+ * @param count The number of symbols in the object file's symbol table.
+ * @retval true The cache is open or disabled.
+ * @retval false The cache could not be opened. The RTL error is set.
+ */
+bool rtems_rtl_reloc_cache_open (rtems_rtl_reloc_cache* cache,
+                                 rtems_rtl_obj*         obj,
+                                 int                    fd,
+                                 size_t                 count);
+
+/**
+ * Close the relocation cache writing the cache file if the table was not
+ * read from it and the object file has been loaded.
+ *
+ * @param cache The relocation cache to close.
+ * @param loaded The object file has been loaded.
+ */
+void rtems_rtl_reloc_cache_close (rtems_rtl_reloc_cache* cache, bool loaded);
+
+/**
+ * Find the base image symbol a symbol of the object file resolves to.
+ *
+ * @param cache The relocation cache.
+ * @param index The index of the symbol in the object file's symbol table.
+ * @return rtems_rtl_obj_sym* The base image symbol. NULL if not known.
+ */
+rtems_rtl_obj_sym* rtems_rtl_reloc_cache_find (const rtems_rtl_reloc_cache* cache,
+                                               size_t                       index);
+
+/**
+ * Add the symbol a symbol of the object file resolves to. Only base image
+ * symbols are held in the cache.
+ *
+ * @param cache The relocation cache.
+ * @param index The index of the symbol in the object file's symbol table.
+ * @param symbol The symbol the object file's symbol resolves to.
+ */
+void rtems_rtl_reloc_cache_add (rtems_rtl_reloc_cache*   cache,
+                                size_t                   index,
+                                const rtems_rtl_obj_sym* symbol);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif
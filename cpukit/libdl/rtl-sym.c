@@ -38,7 +38,7 @@ static rtems_rtl_obj_sym global_sym_add =
   .value = (void*) rtems_rtl_base_sym_global_add
 };
 
-static uint_fast32_t
+uint_fast32_t
 rtems_rtl_symbol_hash (const char *s)
 {
   uint_fast32_t h = 5381;
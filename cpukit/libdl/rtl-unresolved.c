@@ -26,6 +26,7 @@
 #include <rtems/rtl/rtl.h>
 #include "rtl-error.h"
 #include <rtems/rtl/rtl-unresolved.h>
+#include <rtems/rtl/rtl-sym.h>
 #include <rtems/rtl/rtl-trace.h>
 #include "rtl-trampoline.h"
 
@@ -127,138 +128,192 @@ rtems_rtl_unresolved_rec_first_free (rtems_rtl_unresolv_block* block)
   return &block->rec[0] + block->recs;
 }
 
-/**
- * Name management iterator data.
+/*
+ * The symbol name index. The index is allocated when the first name is added
+ * and doubled in size when all the identifiers are used. The identifiers are
+ * 16bit values.
  */
-typedef struct
+#define RTEMS_RTL_UNRESOLVED_INDEX_MIN (64)
+#define RTEMS_RTL_UNRESOLVED_INDEX_MAX (UINT16_MAX + 1)
+
+static size_t
+rtems_rtl_unresolved_index_bucket (const rtems_rtl_unresolv_index* index,
+                                   const char*                     name)
 {
-  const char*             name;   /**< The name being searched for. */
-  size_t                  length; /**< The length of the name. */
-  rtems_rtl_unresolv_rec* rec;    /**< The record being searched for. */
-  int                     index;  /**< The name's index. */
-  int                     offset; /**< The offset to move the index. */
-} rtl_unresolved_name_data;
+  return rtems_rtl_symbol_hash (name) % index->size;
+}
 
-static bool
-rtems_rtl_unresolved_find_name_iterator (rtems_rtl_unresolv_rec* rec,
-                                         void*                   data)
+static void
+rtems_rtl_unresolved_index_link (rtems_rtl_unresolv_index* index,
+                                 uint16_t                  id)
 {
-  rtl_unresolved_name_data* nd = (rtl_unresolved_name_data*) data;
-  if (rec->type == rtems_rtl_unresolved_symbol)
+  size_t bucket;
+  bucket = rtems_rtl_unresolved_index_bucket (index,
+                                              index->names[id]->rec.name.name);
+  index->next[id] = index->buckets[bucket];
+  index->buckets[bucket] = id;
+}
+
+static void
+rtems_rtl_unresolved_index_unlink (rtems_rtl_unresolv_index* index,
+                                   rtems_rtl_unresolv_rec*   rec)
+{
+  uint16_t  id = rec->rec.name.id;
+  uint16_t* link;
+  size_t    bucket;
+  bucket = rtems_rtl_unresolved_index_bucket (index, rec->rec.name.name);
+  link = &index->buckets[bucket];
+  while (*link != 0)
   {
-    if ((rec->rec.name.length == nd->length)
-        && (strcmp (rec->rec.name.name, nd->name) == 0))
+    if (*link == id)
     {
-      ++rec->rec.name.refs;
-      return true;
+      *link = index->next[id];
+      break;
     }
-    ++nd->index;
+    link = &index->next[*link];
   }
-  return false;
+  index->names[id] = NULL;
+  index->syms[id] = NULL;
+  if (id < index->free)
+    index->free = id;
 }
 
-static int
-rtems_rtl_unresolved_find_name (const char* name)
-{
-  rtl_unresolved_name_data nd = {
-    .name = name,
-    .length = strlen (name) + 1,
-    .rec = NULL,
-    .index = 1,
-    .offset = 0
-  };
-  if (rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_find_name_iterator,
-                                    &nd))
-    return nd.index;
-  return -1;
+static bool
+rtems_rtl_unresolved_index_grow (rtems_rtl_unresolv_index* index)
+{
+  rtems_rtl_unresolv_index grown;
+  size_t                   id;
+
+  if (index->size >= RTEMS_RTL_UNRESOLVED_INDEX_MAX)
+  {
+    rtems_rtl_set_error (ENOMEM, "too many unresolved symbols");
+    return false;
+  }
+
+  grown.size = index->size * 2;
+  if (grown.size < RTEMS_RTL_UNRESOLVED_INDEX_MIN)
+    grown.size = RTEMS_RTL_UNRESOLVED_INDEX_MIN;
+  if (grown.size > RTEMS_RTL_UNRESOLVED_INDEX_MAX)
+    grown.size = RTEMS_RTL_UNRESOLVED_INDEX_MAX;
+
+  /*
+   * The tables are held in a single allocation.
+   */
+  grown.names =
+    rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_EXTERNAL,
+                         grown.size * (sizeof (grown.names[0]) +
+                                       sizeof (grown.syms[0]) +
+                                       sizeof (grown.buckets[0]) +
+                                       sizeof (grown.next[0])),
+                         true);
+  if (grown.names == NULL)
+  {
+    rtems_rtl_set_error (ENOMEM, "no memory for unresolved index");
+    return false;
+  }
+
+  grown.syms = (rtems_rtl_obj_sym**) &grown.names[grown.size];
+  grown.buckets = (uint16_t*) &grown.syms[grown.size];
+  grown.next = &grown.buckets[grown.size];
+  grown.free = index->size > 0 ? index->size : 1;
+
+  for (id = 1; id < index->size; ++id)
+  {
+    grown.names[id] = index->names[id];
+    grown.syms[id] = index->syms[id];
+    if (grown.names[id] != NULL)
+      rtems_rtl_unresolved_index_link (&grown, id);
+  }
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
+    printf ("rtl: unresolv: index: %zu -> %zu\n", index->size, grown.size);
+
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, index->names);
+
+  *index = grown;
+
+  return true;
 }
 
-static bool
-rtems_rtl_unresolved_find_index_iterator (rtems_rtl_unresolv_rec* rec,
-                                          void*                   data)
+static int
+rtems_rtl_unresolved_index_alloc (rtems_rtl_unresolv_index* index)
 {
-  rtl_unresolved_name_data* nd = (rtl_unresolved_name_data*) data;
-  if (rec == nd->rec)
-    return true;
-  if (rec->type == rtems_rtl_unresolved_symbol)
-    ++nd->index;
-  return false;
+  while (true)
+  {
+    size_t id;
+    for (id = index->free; id < index->size; ++id)
+    {
+      if (index->names[id] == NULL)
+      {
+        index->free = id + 1;
+        return id;
+      }
+    }
+    index->free = index->size;
+    if (!rtems_rtl_unresolved_index_grow (index))
+      return -1;
+  }
 }
 
 static int
-rtems_rtl_unresolved_find_index (rtems_rtl_unresolv_rec* rec)
-{
-  rtl_unresolved_name_data nd = {
-    .name = NULL,
-    .length = 0,
-    .rec = rec,
-    .index = 1,
-    .offset = 0
-  };
-  if (rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_find_index_iterator,
-                                    &nd))
-    return nd.index;
+rtems_rtl_unresolved_index_find (const rtems_rtl_unresolv_index* index,
+                                 const char*                     name)
+{
+  size_t   length = strlen (name) + 1;
+  uint16_t id;
+  if (index->size == 0)
+    return -1;
+  id = index->buckets[rtems_rtl_unresolved_index_bucket (index, name)];
+  while (id != 0)
+  {
+    const rtems_rtl_unresolv_rec* rec = index->names[id];
+    if ((rec->rec.name.length == length)
+        && (strcmp (rec->rec.name.name, name) == 0))
+      return id;
+    id = index->next[id];
+  }
   return -1;
 }
 
 static bool
-rtems_rtl_unresolved_reindex_iterator (rtems_rtl_unresolv_rec* rec,
-                                       void*                   data)
+rtems_rtl_unresolved_index_update_iterator (rtems_rtl_unresolv_rec* rec,
+                                            void*                   data)
 {
-  rtl_unresolved_name_data* nd = (rtl_unresolved_name_data*) data;
-  /*
-   * Reindexing only effects the reloc records.
-   */
-  if (rec->type == rtems_rtl_unresolved_reloc)
-  {
-    if (rec->rec.reloc.name >= nd->index)
-      rec->rec.reloc.name += nd->offset;
-  }
+  rtems_rtl_unresolv_index* index = (rtems_rtl_unresolv_index*) data;
+  if (rec->type == rtems_rtl_unresolved_symbol)
+    index->names[rec->rec.name.id] = rec;
   return false;
 }
 
+/*
+ * Cleaning a block moves the records so update the name records held in the
+ * index.
+ */
 static void
-rtems_rtl_unresolved_reindex_names (uint16_t index, int offset)
+rtems_rtl_unresolved_index_update (rtems_rtl_unresolved* unresolved)
 {
-  rtl_unresolved_name_data nd = {
-    .name = NULL,
-    .length = 0,
-    .rec = NULL,
-    .index = index,
-    .offset = offset
-  };
-  rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_reindex_iterator,
-                                &nd);
+  rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_index_update_iterator,
+                                &unresolved->index);
 }
 
-/**
- * Struct to pass relocation data in the iterator.
- */
-typedef struct rtems_rtl_unresolved_reloc_data
-{
-  uint16_t                name;     /**< Name index. */
-  rtems_rtl_unresolv_rec* name_rec; /**< Name record. */
-  rtems_rtl_obj_sym*      sym;      /**< The symbol record. */
-} rtems_rtl_unresolved_reloc_data;
-
 static bool
 rtems_rtl_unresolved_resolve_reloc (rtems_rtl_unresolv_rec* rec,
                                     void*                   data)
 {
-  if (rec->type == rtems_rtl_unresolved_reloc)
+  if (rec->type == rtems_rtl_unresolved_reloc && rec->rec.reloc.obj != NULL)
   {
-    rtems_chain_control*             pending;
-    rtems_rtl_unresolved_reloc_data* rd;
-
-    rd = (rtems_rtl_unresolved_reloc_data*) data;
+    rtems_rtl_unresolv_index* index = (rtems_rtl_unresolv_index*) data;
+    rtems_rtl_unresolv_rec*   name_rec = index->names[rec->rec.reloc.name];
+    rtems_rtl_obj_sym*        sym = index->syms[rec->rec.reloc.name];
 
-    if (rec->rec.reloc.name == rd->name && rec->rec.reloc.obj != NULL)
+    if (sym != NULL)
     {
+      rtems_chain_control* pending;
+
       if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
-        printf ("rtl: unresolv: resolve reloc: %s\n",
-                rd->name_rec->rec.name.name);
+        printf ("rtl: unresolv: resolve reloc: %s\n", name_rec->rec.name.name);
 
-      if (rtems_rtl_obj_relocate_unresolved (&rec->rec.reloc, rd->sym))
+      if (rtems_rtl_obj_relocate_unresolved (&rec->rec.reloc, sym))
       {
         /*
          * If all unresolved externals are resolved add the obj module
@@ -280,97 +335,87 @@ rtems_rtl_unresolved_resolve_reloc (rtems_rtl_unresolv_rec* rec,
          * NULL and names with a reference count of 0.
          */
         rec->rec.reloc.obj = NULL;
-        if (rd->name_rec != NULL && rd->name_rec->rec.name.refs > 0)
-          --rd->name_rec->rec.name.refs;
+        if (name_rec != NULL && name_rec->rec.name.refs > 0)
+          --name_rec->rec.name.refs;
       }
     }
   }
   return false;
 }
 
-static bool
-rtems_rtl_unresolved_resolve_iterator (rtems_rtl_unresolv_rec* rec,
-                                       void*                   data)
+/*
+ * Look up each name in the global symbol table. If any are found fix up the
+ * relocation records referencing them in a single scan of the table.
+ */
+static void
+rtems_rtl_unresolved_resolve_names (rtems_rtl_unresolved* unresolved)
 {
-  if (rec->type == rtems_rtl_unresolved_symbol)
-  {
-    rtems_rtl_unresolved_reloc_data* rd;
-    rd = (rtems_rtl_unresolved_reloc_data*) data;
-
-    ++rd->name;
+  rtems_rtl_unresolv_index* index = &unresolved->index;
+  bool                      found = false;
+  size_t                    id;
 
-    if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
-      printf ("rtl: unresolv: lookup: %d: %s\n", rd->name, rec->rec.name.name);
+  for (id = 1; id < index->size; ++id)
+  {
+    rtems_rtl_unresolv_rec* rec = index->names[id];
 
-    rd->sym = rtems_rtl_symbol_global_find (rec->rec.name.name);
+    index->syms[id] = NULL;
 
-    if (rd->sym)
+    if (rec != NULL)
     {
       if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
-        printf ("rtl: unresolv: found: %s\n", rec->rec.name.name);
-
-      rd->name_rec = rec;
+        printf ("rtl: unresolv: lookup: %zu: %s\n", id, rec->rec.name.name);
 
-      rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_resolve_reloc, rd);
+      index->syms[id] = rtems_rtl_symbol_global_find (rec->rec.name.name);
 
-      rd->name_rec = NULL;
-      rd->sym = NULL;
+      if (index->syms[id] != NULL)
+      {
+        if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
+          printf ("rtl: unresolv: found: %s\n", rec->rec.name.name);
+        found = true;
+      }
     }
   }
 
-  return false;
+  if (found)
+    rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_resolve_reloc, index);
 }
 
-/**
- * Struct to pass archive relocation data in the iterator.
+/*
+ * Search the archives for the names not searched for before. Loading an
+ * object file adds names to the index so stop the search when an object file
+ * is loaded.
  */
-typedef struct rtems_rtl_unresolved_archive_reloc_data
+static rtems_rtl_archive_search
+rtems_rtl_unresolved_archive_search (rtems_rtl_unresolved* unresolved,
+                                     rtems_rtl_archives*   archives)
 {
-  uint16_t                 name;     /**< Name index. */
-  rtems_rtl_archive_search result;   /**< The result of the load. */
-  rtems_rtl_archives*      archives; /**< The archives to search. */
-} rtems_rtl_unresolved_archive_reloc_data;
+  rtems_rtl_unresolv_index* index = &unresolved->index;
+  size_t                    id;
 
-static bool
-rtems_rtl_unresolved_archive_iterator (rtems_rtl_unresolv_rec* rec,
-                                       void*                   data)
-{
-  if (rec->type == rtems_rtl_unresolved_symbol)
+  for (id = 1; id < index->size; ++id)
   {
-    rtems_rtl_unresolved_archive_reloc_data* ard;
-    ard = (rtems_rtl_unresolved_archive_reloc_data*) data;
-
-    ++ard->name;
+    rtems_rtl_unresolv_rec* rec = index->names[id];
 
-    if ((rec->rec.name.flags & RTEMS_RTL_UNRESOLV_SYM_SEARCH_ARCHIVE) != 0)
+    if (rec != NULL &&
+        (rec->rec.name.flags & RTEMS_RTL_UNRESOLV_SYM_SEARCH_ARCHIVE) != 0)
     {
       rtems_rtl_archive_search result;
 
       if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
-        printf ("rtl: unresolv: archive lookup: %d: %s\n",
-                ard->name, rec->rec.name.name);
+        printf ("rtl: unresolv: archive lookup: %zu: %s\n",
+                id, rec->rec.name.name);
 
-      result = rtems_rtl_archive_obj_load (ard->archives,
+      result = rtems_rtl_archive_obj_load (archives,
                                            rec->rec.name.name, true);
       if (result != rtems_rtl_archive_search_not_found)
       {
         rec->rec.name.flags &= ~RTEMS_RTL_UNRESOLV_SYM_SEARCH_ARCHIVE;
-        ard->result = result;
-        return true;
+        return result;
       }
     }
   }
 
-  return false;
-}
-
-static bool
-rtems_rtl_unresolved_archive_search_iterator (rtems_rtl_unresolv_rec* rec,
-                                              void*                   data)
-{
-  if (rec->type == rtems_rtl_unresolved_symbol)
-    rec->rec.name.flags |= RTEMS_RTL_UNRESOLV_SYM_SEARCH_ARCHIVE;
-  return false;
+  return rtems_rtl_archive_search_not_found;
 }
 
 static rtems_rtl_unresolv_block*
@@ -432,10 +477,10 @@ rtems_rtl_unresolved_compact (void)
   {
     /*
      * Iterate over the blocks removing any empty strings. If a string is
-     * removed update the indexes of all strings above this level.
+     * removed the name is removed from the index. The records move as the
+     * blocks are cleaned so the index is updated after the blocks are clean.
      */
     rtems_chain_node* node = rtems_chain_first (&unresolved->blocks);
-    uint16_t          index = 0;
     while (!rtems_chain_is_tail (&unresolved->blocks, node))
     {
       rtems_rtl_unresolv_block* block = (rtems_rtl_unresolv_block*) node;
@@ -446,20 +491,18 @@ rtems_rtl_unresolved_compact (void)
 
         if (rec->type == rtems_rtl_unresolved_symbol)
         {
-          ++index;
           if (rec->rec.name.refs == 0)
           {
             size_t name_recs;
             if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
               printf ("rtl: unresolv: remove name: %s\n", rec->rec.name.name);
-            rtems_rtl_unresolved_reindex_names (index, -1);
+            rtems_rtl_unresolved_index_unlink (&unresolved->index, rec);
             /*
              * Compact the block removing the name record.
              */
             name_recs = rtems_rtl_unresolved_symbol_recs (rec->rec.name.name);
             rtems_rtl_unresolved_clean_block (block, rec, name_recs,
                                               unresolved->block_recs);
-            --index;
             next_rec = false;
           }
         }
@@ -480,6 +523,8 @@ rtems_rtl_unresolved_compact (void)
       node = rtems_rtl_unresolved_delete_block_if_empty (&unresolved->blocks,
                                                          block);
     }
+
+    rtems_rtl_unresolved_index_update (unresolved);
   }
 }
 
@@ -490,6 +535,7 @@ rtems_rtl_unresolved_table_open (rtems_rtl_unresolved* unresolved,
   unresolved->marker = 0xdeadf00d;
   unresolved->block_recs = block_recs;
   rtems_chain_initialize_empty (&unresolved->blocks);
+  memset (&unresolved->index, 0, sizeof (unresolved->index));
   return rtems_rtl_unresolved_block_alloc (unresolved);
 }
 
@@ -503,6 +549,8 @@ rtems_rtl_unresolved_table_close (rtems_rtl_unresolved* unresolved)
     rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, node);
     node = next;
   }
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, unresolved->index.names);
+  memset (&unresolved->index, 0, sizeof (unresolved->index));
 }
 
 bool
@@ -554,15 +602,27 @@ rtems_rtl_unresolved_add (rtems_rtl_obj*        obj,
   /*
    * Is the name present?
    */
-  name_index = rtems_rtl_unresolved_find_name (name);
+  name_index = rtems_rtl_unresolved_index_find (&unresolved->index, name);
 
   /*
    * An index less than 0 means the name was not found.
    */
-  if (name_index < 0)
+  if (name_index >= 0)
+  {
+    ++unresolved->index.names[name_index]->rec.name.refs;
+  }
+  else
   {
     size_t name_recs;
 
+    /*
+     * Allocate the identifier first so there is nothing to undo if the index
+     * cannot grow.
+     */
+    name_index = rtems_rtl_unresolved_index_alloc (&unresolved->index);
+    if (name_index < 0)
+      return false;
+
     name_recs = rtems_rtl_unresolved_symbol_recs (name);
 
     /*
@@ -582,28 +642,18 @@ rtems_rtl_unresolved_add (rtems_rtl_obj*        obj,
     rec = rtems_rtl_unresolved_rec_first_free (block);
 
     /*
-     * Enter the new record before reindexing so the iterator can see
-     * it and the iterator is called.
+     * Enter the new record and add it to the index.
      */
     rec->type = rtems_rtl_unresolved_symbol;
     rec->rec.name.refs = 1;
     rec->rec.name.flags = RTEMS_RTL_UNRESOLV_SYM_SEARCH_ARCHIVE;
     rec->rec.name.length = strlen (name) + 1;
+    rec->rec.name.id = name_index;
     memcpy ((void*) &rec->rec.name.name[0], name, rec->rec.name.length);
     block->recs += name_recs;
 
-    /*
-     * Find the name index for the name and then reindex the names which
-     * are moved up because of the insertion.
-     */
-    name_index = rtems_rtl_unresolved_find_index (rec);
-    if (name_index < 0)
-    {
-      rtems_rtl_set_error (ENOMEM, "internal unresolved block error");
-      return false;
-    }
-
-    rtems_rtl_unresolved_reindex_names (name_index, 1);
+    unresolved->index.names[name_index] = rec;
+    rtems_rtl_unresolved_index_link (&unresolved->index, name_index);
   }
 
   /*
@@ -635,7 +685,8 @@ rtems_rtl_unresolved_add (rtems_rtl_obj*        obj,
 void
 rtems_rtl_unresolved_resolve (void)
 {
-  bool resolving = true;
+  rtems_rtl_unresolved* unresolved;
+  bool                  resolving = true;
 
   if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
     printf ("rtl: unresolv: global resolve\n");
@@ -650,24 +701,21 @@ rtems_rtl_unresolved_resolve (void)
    * search of the archives for symbols and stage one is performed again. The
    * process repeats until no more symbols are resolved or there is an error.
    */
+  unresolved = rtems_rtl_unresolved_unprotected ();
+  if (!unresolved)
+    return;
+
   while (resolving)
   {
-    rtems_rtl_unresolved_reloc_data rd = {
-      .name = 0,
-      .name_rec = NULL,
-      .sym = NULL
-    };
-    rtems_rtl_unresolved_archive_reloc_data ard = {
-      .name = 0,
-      .result = rtems_rtl_archive_search_not_found,
-      .archives = rtems_rtl_archives_unprotected ()
-    };
-
-    rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_resolve_iterator, &rd);
+    rtems_rtl_archive_search result;
+
+    rtems_rtl_unresolved_resolve_names (unresolved);
     rtems_rtl_unresolved_compact ();
-    rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_archive_iterator, &ard);
+    result =
+      rtems_rtl_unresolved_archive_search (unresolved,
+                                           rtems_rtl_archives_unprotected ());
 
-    resolving = ard.result == rtems_rtl_archive_search_loaded;
+    resolving = result == rtems_rtl_archive_search_loaded;
   }
 
   if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
@@ -753,6 +801,8 @@ rtems_rtl_trampoline_remove (rtems_rtl_obj* obj)
       node = rtems_rtl_unresolved_delete_block_if_empty (&unresolved->blocks,
                                                          block);
     }
+
+    rtems_rtl_unresolved_index_update (unresolved);
   }
 }
 
@@ -762,7 +812,6 @@ rtems_rtl_trampoline_remove (rtems_rtl_obj* obj)
 typedef struct rtems_rtl_unresolved_dump_data
 {
   size_t rec;
-  size_t names;
   bool   show_relocs;
 } rtems_rtl_unresolved_dump_data;
 
@@ -778,9 +827,8 @@ rtems_rtl_unresolved_dump_iterator (rtems_rtl_unresolv_rec* rec,
     printf (" %03zu: 0: empty\n", dd->rec);
     break;
   case rtems_rtl_unresolved_symbol:
-    ++dd->names;
-    printf (" %3zu: 1:  name: %3zu refs:%4d: flags:%04x %s (%d)\n",
-            dd->rec, dd->names,
+    printf (" %3zu: 1:  name: %3d refs:%4d: flags:%04x %s (%d)\n",
+            dd->rec, rec->rec.name.id,
             rec->rec.name.refs,
             rec->rec.name.flags,
             rec->rec.name.name,
@@ -815,6 +863,15 @@ rtems_rtl_unresolved_dump (void)
 void
 rtems_rtl_unresolved_set_archive_search (void)
 {
-  rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_archive_search_iterator,
-                                NULL);
+  rtems_rtl_unresolved* unresolved = rtems_rtl_unresolved_unprotected ();
+  if (unresolved)
+  {
+    size_t id;
+    for (id = 1; id < unresolved->index.size; ++id)
+    {
+      rtems_rtl_unresolv_rec* rec = unresolved->index.names[id];
+      if (rec != NULL)
+        rec->rec.name.flags |= RTEMS_RTL_UNRESOLV_SYM_SEARCH_ARCHIVE;
+    }
+  }
 }
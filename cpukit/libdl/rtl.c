@@ -851,6 +851,11 @@ rtems_rtl_base_sym_global_add (const unsigned char* esyms,
 
   rtems_rtl_symbol_global_add (rtl->base, esyms, size);
 
+  /*
+   * The relocation cache files depend on the base image's symbols.
+   */
+  rtl->base_hash = 0;
+
   rtems_rtl_unlock ();
 }
 
@@ -27,6 +27,7 @@
 
 #include "fat.h"
 #include "fat_fat_operations.h"
+#include "fat_file.h"
 
 static int
  _fat_block_release(fat_fs_info_t *fs_info);
@@ -450,6 +451,86 @@ fat_cluster_write(
       return bytes_written;
 }
 
+/* fat_cluster_read_direct --
+ *     This function reads 'cls' consecutive clusters starting at cluster
+ *     'start_cln' directly into the user buffer. The transfer bypasses the
+ *     block device buffer cache.
+ *
+ * PARAMETERS:
+ *     fs_info   - FS info
+ *     start_cln - first cluster to read
+ *     cls       - count of clusters to read
+ *     buff      - buffer provided by user
+ *
+ * RETURNS:
+ *     bytes read on success, or -1 if error occured
+ *     and errno set appropriately
+ */
+ssize_t
+fat_cluster_read_direct(
+    fat_fs_info_t                        *fs_info,
+    const uint32_t                        start_cln,
+    const uint32_t                        cls,
+    void                                 *buff)
+{
+    rtems_status_code   sc = RTEMS_SUCCESSFUL;
+    int                 rc = RC_OK;
+    uint32_t            blk = fat_cluster_num_to_block_num(fs_info, start_cln);
+    uint32_t            blks = cls << (fs_info->vol.bpc_log2 -
+                                       fs_info->vol.bytes_per_block_log2);
+
+    /* the direct transfer waits for buffers in use, so release ours */
+    rc = fat_buf_release(fs_info);
+    if (rc != RC_OK)
+        return -1;
+
+    sc = rtems_bdbuf_read_direct(fs_info->vol.dd, blk, blks, buff);
+    if (sc != RTEMS_SUCCESSFUL)
+        rtems_set_errno_and_return_minus_one(EIO);
+
+    return cls << fs_info->vol.bpc_log2;
+}
+
+/* fat_cluster_write_direct --
+ *     This function writes 'cls' consecutive clusters starting at cluster
+ *     'start_cln' directly from the user buffer. The transfer bypasses the
+ *     block device buffer cache.
+ *
+ * PARAMETERS:
+ *     fs_info   - FS info
+ *     start_cln - first cluster to write
+ *     cls       - count of clusters to write
+ *     buff      - buffer provided by user
+ *
+ * RETURNS:
+ *     bytes written on success, or -1 if error occured
+ *     and errno set appropriately
+ */
+ssize_t
+fat_cluster_write_direct(
+    fat_fs_info_t                        *fs_info,
+    const uint32_t                        start_cln,
+    const uint32_t                        cls,
+    const void                           *buff)
+{
+    rtems_status_code   sc = RTEMS_SUCCESSFUL;
+    int                 rc = RC_OK;
+    uint32_t            blk = fat_cluster_num_to_block_num(fs_info, start_cln);
+    uint32_t            blks = cls << (fs_info->vol.bpc_log2 -
+                                       fs_info->vol.bytes_per_block_log2);
+
+    /* the direct transfer waits for buffers in use, so release ours */
+    rc = fat_buf_release(fs_info);
+    if (rc != RC_OK)
+        return -1;
+
+    sc = rtems_bdbuf_write_direct(fs_info->vol.dd, blk, blks, buff);
+    if (sc != RTEMS_SUCCESSFUL)
+        rtems_set_errno_and_return_minus_one(EIO);
+
+    return cls << fs_info->vol.bpc_log2;
+}
+
 static bool is_cluster_aligned(const fat_vol_t *vol, uint32_t sec_num)
 {
     return (sec_num & (vol->spc - 1)) == 0;
@@ -863,7 +944,10 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
         rtems_chain_control *the_chain = fs_info->vhash + i;
 
         while ( (node = rtems_chain_get_unprotected(the_chain)) != NULL )
+        {
+            free(((fat_file_fd_t *) node)->extents);
             free(node);
+        }
     }
 
     for (i = 0; i < FAT_HASH_SIZE; i++)
@@ -872,7 +956,10 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
         rtems_chain_control *the_chain = fs_info->rhash + i;
 
         while ( (node = rtems_chain_get_unprotected(the_chain)) != NULL )
+        {
+            free(((fat_file_fd_t *) node)->extents);
             free(node);
+        }
     }
 
     free(fs_info->vhash);
@@ -359,6 +359,7 @@ typedef struct fat_fs_info_s
     uint32_t             uino_base;
     fat_cache_t          c;             /* cache */
     uint8_t             *sec_buf; /* just placeholder for anything */
+    uint32_t             direct_io_threshold; /* min bytes of direct I/O */
 } fat_fs_info_t;
 
 /*
@@ -506,6 +507,18 @@ fat_cluster_write(fat_fs_info_t                    *fs_info,
                     uint32_t                          count,
                     const void                       *buff);
 
+ssize_t
+fat_cluster_read_direct(fat_fs_info_t                *fs_info,
+                        uint32_t                      start_cln,
+                        uint32_t                      cls,
+                        void                         *buff);
+
+ssize_t
+fat_cluster_write_direct(fat_fs_info_t               *fs_info,
+                         uint32_t                     start_cln,
+                         uint32_t                     cls,
+                         const void                  *buff);
+
 ssize_t
 fat_sector_write(fat_fs_info_t                        *fs_info,
                  uint32_t                              start,
@@ -59,6 +59,32 @@ fat_file_lseek(
     uint32_t                              *disk_cln
 );
 
+static void
+fat_file_extents_add(
+    const fat_fs_info_t                   *fs_info,
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln,
+    uint32_t                               disk_cln
+);
+
+static void
+fat_file_extents_trim(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               cls
+);
+
+static int
+fat_file_direct_run(
+    fat_fs_info_t                         *fs_info,
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln,
+    uint32_t                               cln,
+    uint32_t                               count,
+    const void                            *buf,
+    uint32_t                              *cls,
+    uint32_t                              *next_cln
+);
+
 /* fat_file_open --
  *     Open fat-file. Two hash tables are accessed by key
  *     constructed from cluster num and offset of the node (i.e.
@@ -242,6 +268,7 @@ fat_file_close(
                 if (fat_ino_is_unique(fs_info, fat_fd->ino))
                     fat_free_unique_ino(fs_info, fat_fd->ino);
 
+                free(fat_fd->extents);
                 free(fat_fd);
             }
         }
@@ -254,6 +281,7 @@ fat_file_close(
             else
             {
                 _hash_delete(fs_info->vhash, key, fat_fd->ino, fat_fd);
+                free(fat_fd->extents);
                 free(fat_fd);
             }
         }
@@ -297,6 +325,7 @@ fat_file_read(
     uint32_t       cmpltd = 0;
     uint32_t       cur_cln = 0;
     uint32_t       cl_start = 0;
+    uint32_t       file_cln = 0;
     uint32_t       save_cln = 0;
     uint32_t       ofs = 0;
     uint32_t       save_ofs;
@@ -340,8 +369,36 @@ fat_file_read(
     if (rc != RC_OK)
         return rc;
 
+    file_cln = cl_start;
+
     while (count > 0)
     {
+        if (ofs == 0)
+        {
+            uint32_t cls = 0;
+            uint32_t next_cln = 0;
+
+            rc = fat_file_direct_run(fs_info, fat_fd, file_cln, cur_cln,
+                                     count, buf + cmpltd, &cls, &next_cln);
+            if ( rc != RC_OK )
+                return rc;
+
+            if (cls > 0)
+            {
+                ret = fat_cluster_read_direct(fs_info, cur_cln, cls,
+                                              buf + cmpltd);
+                if ( ret < 0 )
+                    return -1;
+
+                count -= ret;
+                cmpltd += ret;
+                save_cln = cur_cln + cls - 1;
+                cur_cln = next_cln;
+                file_cln += cls;
+                continue;
+            }
+        }
+
         c = MIN(count, (fs_info->vol.bpc - ofs));
 
         sec = fat_cluster_num_to_sector_num(fs_info, cur_cln);
@@ -359,6 +416,8 @@ fat_file_read(
         if ( rc != RC_OK )
             return rc;
 
+        fat_file_extents_add(fs_info, fat_fd, ++file_cln, cur_cln);
+
         ofs = 0;
     }
 
@@ -418,6 +477,7 @@ fat_file_write_fat32_or_non_root_dir(
     uint32_t       cur_cln = 0;
     uint32_t       save_cln = 0; /* FIXME: This might be incorrect, cf. below */
     uint32_t       start_cln = start >> fs_info->vol.bpc_log2;
+    uint32_t       file_cln = start_cln;
     uint32_t       ofs_cln = start - (start_cln << fs_info->vol.bpc_log2);
     uint32_t       ofs_cln_save = ofs_cln;
     uint32_t       bytes_to_write = count;
@@ -430,6 +490,34 @@ fat_file_write_fat32_or_non_root_dir(
         while (   (RC_OK == rc)
                && (bytes_to_write > 0))
         {
+            if (0 == ofs_cln)
+            {
+                uint32_t cls = 0;
+                uint32_t next_cln = 0;
+
+                rc = fat_file_direct_run(fs_info, fat_fd, file_cln, cur_cln,
+                                         bytes_to_write, &buf[cmpltd], &cls,
+                                         &next_cln);
+                if ((RC_OK == rc) && (0 < cls))
+                {
+                    ret = fat_cluster_write_direct(fs_info, cur_cln, cls,
+                                                   &buf[cmpltd]);
+                    if (0 > ret)
+                      rc = -1;
+                    else
+                    {
+                      bytes_to_write -= ret;
+                      cmpltd += ret;
+                      save_cln = cur_cln + cls - 1;
+                      cur_cln = next_cln;
+                      file_cln += cls;
+                    }
+                    continue;
+                }
+                if (RC_OK != rc)
+                    break;
+            }
+
             c = MIN(bytes_to_write, (fs_info->vol.bpc - ofs_cln));
 
             ret = fat_cluster_write(fs_info,
@@ -446,7 +534,11 @@ fat_file_write_fat32_or_non_root_dir(
                 cmpltd += ret;
                 save_cln = cur_cln;
                 if (0 < bytes_to_write)
+                {
                   rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
+                  if (RC_OK == rc)
+                    fat_file_extents_add(fs_info, fat_fd, ++file_cln, cur_cln);
+                }
 
                 ofs_cln = 0;
             }
@@ -756,6 +848,8 @@ fat_file_truncate(
     if (rc != RC_OK)
         return rc;
 
+    fat_file_extents_trim(fat_fd, cl_start);
+
     rc = fat_free_fat_clusters_chain(fs_info, cur_cln);
     if (rc != RC_OK)
         return rc;
@@ -1003,6 +1097,225 @@ _hash_search(
     return -1;
 }
 
+/* fat_file_extents_trim --
+ *     Drop the extents of all clusters starting with file cluster 'cls'.
+ *
+ * PARAMETERS:
+ *     fat_fd   - fat-file descriptor
+ *     cls      - count of clusters to keep
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_extents_trim(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               cls
+    )
+{
+    while (fat_fd->extents_count > 0)
+    {
+        fat_file_extent_t *last = &fat_fd->extents[fat_fd->extents_count - 1];
+
+        if (last->file_cln < cls)
+        {
+            if (last->file_cln + last->count > cls)
+                last->count = cls - last->file_cln;
+
+            break;
+        }
+
+        --fat_fd->extents_count;
+    }
+
+    if (fat_fd->extents_cls > cls)
+        fat_fd->extents_cls = cls;
+}
+
+/* fat_file_extents_add --
+ *     Add the mapping of a file cluster to a disk cluster to the extents if
+ *     it directly follows the clusters already covered by the extents.  The
+ *     extents are a cache, so failed allocations just stop their growth.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     fat_fd   - fat-file descriptor
+ *     file_cln - serial number of the cluster in fat-file
+ *     disk_cln - real number of the cluster on the volume
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_extents_add(
+    const fat_fs_info_t                   *fs_info,
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln,
+    uint32_t                               disk_cln
+    )
+{
+    fat_file_extent_t *extent;
+
+    if ((file_cln != fat_fd->extents_cls) ||
+        (disk_cln < FAT_RSRVD_CLN) ||
+        ((disk_cln & fs_info->vol.mask) >= fs_info->vol.eoc_val))
+        return;
+
+    if (fat_fd->extents_count > 0)
+    {
+        extent = &fat_fd->extents[fat_fd->extents_count - 1];
+
+        if (extent->disk_cln + extent->count == disk_cln)
+        {
+            ++extent->count;
+            ++fat_fd->extents_cls;
+            return;
+        }
+    }
+
+    if (fat_fd->extents_count == fat_fd->extents_size)
+    {
+        uint32_t size;
+
+        if (fat_fd->extents_size >= FAT_FILE_EXTENTS_MAX)
+            return;
+
+        size = fat_fd->extents_size > 0 ? 2 * fat_fd->extents_size : 4;
+        extent = realloc(fat_fd->extents, size * sizeof(*extent));
+        if (extent == NULL)
+            return;
+
+        fat_fd->extents = extent;
+        fat_fd->extents_size = size;
+    }
+
+    extent = &fat_fd->extents[fat_fd->extents_count];
+    extent->file_cln = file_cln;
+    extent->disk_cln = disk_cln;
+    extent->count = 1;
+    ++fat_fd->extents_count;
+    ++fat_fd->extents_cls;
+}
+
+/* fat_file_extents_find --
+ *     Binary search for the disk cluster of a file cluster covered by the
+ *     extents.
+ *
+ * PARAMETERS:
+ *     fat_fd   - fat-file descriptor
+ *     file_cln - serial number of the cluster in fat-file, must be less than
+ *                the count of clusters covered by the extents
+ *
+ * RETURNS:
+ *     real number of the cluster on the volume
+ */
+static uint32_t
+fat_file_extents_find(
+    const fat_file_fd_t                   *fat_fd,
+    uint32_t                               file_cln
+    )
+{
+    uint32_t lo = 0;
+    uint32_t hi = fat_fd->extents_count - 1;
+
+    while (lo < hi)
+    {
+        uint32_t mid = lo + (hi - lo + 1) / 2;
+
+        if (fat_fd->extents[mid].file_cln <= file_cln)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    return fat_fd->extents[lo].disk_cln +
+           (file_cln - fat_fd->extents[lo].file_cln);
+}
+
+/* fat_file_direct_run --
+ *     Determine the run of consecutive clusters starting at the current
+ *     cluster of a sequential transfer which is done directly between the
+ *     device and the user buffer.  Direct I/O is used for file transfers of
+ *     at least the direct I/O threshold of the volume with a user buffer
+ *     aligned for direct transfers and covers whole clusters only.  The
+ *     clusters passed are added to the extents.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     fat_fd   - fat-file descriptor
+ *     file_cln - serial number of the current cluster in fat-file
+ *     cln      - real number of the current cluster on the volume
+ *     count    - count of bytes left to transfer
+ *     buf      - user buffer of the transfer
+ *     cls      - placeholder for the count of clusters in the run, zero if
+ *                the transfer should use the cache
+ *     next_cln - placeholder for the cluster following the run
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occured (errno set appropriately)
+ */
+static int
+fat_file_direct_run(
+    fat_fs_info_t                         *fs_info,
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln,
+    uint32_t                               cln,
+    uint32_t                               count,
+    const void                            *buf,
+    uint32_t                              *cls,
+    uint32_t                              *next_cln
+    )
+{
+    int      rc = RC_OK;
+    uint32_t max_cls = count >> fs_info->vol.bpc_log2;
+    uint32_t n = 0;
+
+    *cls = 0;
+
+    if ((fs_info->direct_io_threshold == 0) ||
+        (fat_fd->fat_file_type != FAT_FILE) ||
+        (count < fs_info->direct_io_threshold) ||
+        (max_cls == 0) ||
+        !rtems_bdbuf_is_direct_aligned(buf))
+        return RC_OK;
+
+    while (true)
+    {
+        uint32_t next;
+
+        rc = fat_get_fat_cluster(fs_info, cln + n, &next);
+        if ( rc != RC_OK )
+            return rc;
+
+        ++n;
+        fat_file_extents_add(fs_info, fat_fd, file_cln + n, next);
+
+        if ((n == max_cls) || (next != cln + n))
+        {
+            *next_cln = next;
+            break;
+        }
+    }
+
+    *cls = n;
+    return RC_OK;
+}
+
+/* fat_file_lseek --
+ *     Map a file cluster to a disk cluster.  The clusters covered by the
+ *     extents are found by a binary search, all others by a walk along the
+ *     cluster chain starting at the nearest known cluster.  The clusters
+ *     passed during the walk are added to the extents.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     fat_fd   - fat-file descriptor
+ *     file_cln - serial number of the cluster in fat-file
+ *     disk_cln - placeholder for the real number of the cluster on the volume
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occured (errno set appropriately)
+ */
 static off_t
 fat_file_lseek(
     fat_fs_info_t                         *fs_info,
@@ -1018,26 +1331,53 @@ fat_file_lseek(
     else
     {
         uint32_t   cur_cln;
-        uint32_t   count;
-        uint32_t   i;
 
-        if (file_cln > fat_fd->map.file_cln)
+        /*
+         * The first cluster changes if the file was truncated to zero length
+         * and extended again or if the descriptor was reopened.
+         */
+        if ((fat_fd->extents_count > 0) &&
+            (fat_fd->extents[0].disk_cln != fat_fd->cln))
+            fat_file_extents_trim(fat_fd, 0);
+
+        if (fat_fd->extents_cls == 0)
+            fat_file_extents_add(fs_info, fat_fd, 0, fat_fd->cln);
+
+        if (file_cln < fat_fd->extents_cls)
         {
-            cur_cln = fat_fd->map.disk_cln;
-            count = file_cln - fat_fd->map.file_cln;
+            cur_cln = fat_file_extents_find(fat_fd, file_cln);
         }
         else
         {
-            cur_cln = fat_fd->cln;
-            count = file_cln;
-        }
+            uint32_t   cur_file_cln;
 
-        /* skip over the clusters */
-        for (i = 0; i < count; i++)
-        {
-            rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
-            if ( rc != RC_OK )
-                return rc;
+            if (fat_fd->extents_cls > 0)
+            {
+                cur_file_cln = fat_fd->extents_cls - 1;
+                cur_cln = fat_file_extents_find(fat_fd, cur_file_cln);
+            }
+            else
+            {
+                cur_file_cln = 0;
+                cur_cln = fat_fd->cln;
+            }
+
+            if ((file_cln > fat_fd->map.file_cln) &&
+                (fat_fd->map.file_cln > cur_file_cln))
+            {
+                cur_file_cln = fat_fd->map.file_cln;
+                cur_cln = fat_fd->map.disk_cln;
+            }
+
+            /* skip over the clusters */
+            while (cur_file_cln < file_cln)
+            {
+                rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
+                if ( rc != RC_OK )
+                    return rc;
+
+                fat_file_extents_add(fs_info, fat_fd, ++cur_file_cln, cur_cln);
+            }
         }
 
         /* update cache */
@@ -65,6 +65,24 @@ typedef struct fat_file_map_s
     uint32_t   last_cln;
 } fat_file_map_t;
 
+/**
+ * @brief Run of contiguous clusters of a fat-file.
+ */
+typedef struct fat_file_extent_s
+{
+    uint32_t   file_cln;
+    uint32_t   disk_cln;
+    uint32_t   count;
+} fat_file_extent_t;
+
+/**
+ * @brief Maximum count of extents cached for a fat-file.
+ *
+ * Clusters of heavily fragmented files beyond the cached extents are found by
+ * a walk along the cluster chain.
+ */
+#define FAT_FILE_EXTENTS_MAX 4096
+
 /**
  * @brief Descriptor of a fat-file.
  *
@@ -89,6 +107,14 @@ typedef struct fat_file_fd_s
     fat_dir_pos_t    dir_pos;
     uint8_t          flags;
     fat_file_map_t   map;
+    fat_file_extent_t *extents;     /*
+                                     * runs of contiguous clusters of the
+                                     * cluster chain starting with the first
+                                     * cluster, sorted by file cluster
+                                     */
+    uint32_t         extents_count;
+    uint32_t         extents_size;  /* allocated count of extents */
+    uint32_t         extents_cls;   /* count of clusters covered by extents */
     time_t           ctime;
     time_t           mtime;
 
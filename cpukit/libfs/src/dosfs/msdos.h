@@ -41,6 +41,22 @@ extern "C" {
 
 #define MSDOS_NAME_NOT_FOUND_ERR  0x7D01
 
+/*
+ * Index of the normalized names of one directory.  The names are hashed into
+ * the name buckets to find entries and the short name positions are hashed
+ * into the position buckets to remove entries.
+ */
+typedef struct msdos_name_index_s
+{
+    rtems_chain_node                  lru_node;
+    uint32_t                          cln;          /* first cluster of the
+                                                     * directory
+                                                     */
+    uint32_t                          bucket_mask;
+    rtems_chain_control              *name_buckets;
+    rtems_chain_control              *pos_buckets;
+} msdos_name_index_t;
+
 /*
  * This structure identifies the instance of the filesystem on the MSDOS
  * level.
@@ -70,6 +86,20 @@ typedef struct msdos_fs_info_s
                                                             */
 
     rtems_dosfs_convert_control      *converter;
+
+    rtems_chain_control               name_index_lru;      /*
+                                                            * directory name
+                                                            * indices, most
+                                                            * recently used
+                                                            * first
+                                                            */
+    uint32_t                          name_index_count;
+    uint32_t                          name_index_max;
+    uint8_t                          *name_index_key;      /*
+                                                            * buffer to
+                                                            * assemble long
+                                                            * names
+                                                            */
 } msdos_fs_info_t;
 
 RTEMS_INLINE_ROUTINE void msdos_fs_lock(msdos_fs_info_t *fs_info)
@@ -318,7 +348,8 @@ int msdos_initialize_support(
   const rtems_filesystem_operations_table *op_table,
   const rtems_filesystem_file_handlers_r  *file_handlers,
   const rtems_filesystem_file_handlers_r  *directory_handlers,
-  rtems_dosfs_convert_control             *converter
+  rtems_dosfs_convert_control             *converter,
+  uint32_t                                 name_index_max
 );
 
 ssize_t msdos_file_read(
@@ -487,6 +518,46 @@ int msdos_sync(rtems_libio_t *iop);
 
 uint8_t msdos_lfn_checksum(const void *entry);
 
+/* Directory name index prototypes */
+
+msdos_name_index_t *msdos_name_index_get(
+    msdos_fs_info_t *fs_info,
+    uint32_t         cln
+);
+
+msdos_name_index_t *msdos_name_index_create(
+    msdos_fs_info_t *fs_info,
+    uint32_t         cln,
+    uint32_t         dir_size
+);
+
+int msdos_name_index_insert(
+    msdos_name_index_t *index,
+    const uint8_t      *key,
+    size_t              key_size,
+    uint32_t            file_offset,
+    const fat_pos_t    *sname
+);
+
+bool msdos_name_index_find(
+    const msdos_name_index_t *index,
+    const uint8_t            *key,
+    size_t                    key_size,
+    uint32_t                 *file_offset
+);
+
+void msdos_name_index_remove(
+    msdos_fs_info_t *fs_info,
+    const fat_pos_t *sname
+);
+
+void msdos_name_index_invalidate(
+    msdos_fs_info_t *fs_info,
+    uint32_t         cln
+);
+
+void msdos_name_index_destroy(msdos_fs_info_t *fs_info);
+
 #ifdef __cplusplus
 }
 #endif
@@ -55,6 +55,7 @@ msdos_shut_down(rtems_filesystem_mount_table_entry_t *temp_mt_entry)
 
     fat_shutdown_drive(&fs_info->fat);
 
+    msdos_name_index_destroy(fs_info);
     rtems_recursive_mutex_destroy(&fs_info->vol_mutex);
     (*converter->handler->destroy)( converter );
     free(fs_info->cl_buf);
@@ -104,6 +104,7 @@ int rtems_dosfs_initialize(
     const rtems_dosfs_mount_options   *mount_options = data;
     rtems_dosfs_convert_control       *converter;
     bool                               converter_created = false;
+    uint32_t                           name_index_max = 0;
 
 
     if (mount_options == NULL || mount_options->converter == NULL) {
@@ -113,12 +114,23 @@ int rtems_dosfs_initialize(
         converter = mount_options->converter;
     }
 
+    if (mount_options != NULL) {
+        name_index_max = mount_options->name_index_directories;
+    }
+
     if (converter != NULL) {
         rc = msdos_initialize_support(mt_entry,
                                       &msdos_ops,
                                       &msdos_file_handlers,
                                       &msdos_dir_handlers,
-                                      converter);
+                                      converter,
+                                      name_index_max);
+        if (rc == 0 && mount_options != NULL) {
+            msdos_fs_info_t *fs_info = mt_entry->fs_info;
+
+            fs_info->fat.direct_io_threshold =
+                mount_options->direct_io_threshold;
+        }
         if (rc != 0 && converter_created) {
             (*converter->handler->destroy)(converter);
         }
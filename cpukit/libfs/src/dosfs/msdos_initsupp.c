@@ -42,6 +42,8 @@
  *     op_table           - filesystem operations table
  *     file_handlers      - file operations table
  *     directory_handlers - directory operations table
+ *     converter          - name converter
+ *     name_index_max     - maximum count of directory name indices
  *
  * RETURNS:
  *     RC_OK and filled temp_mt_entry on success, or -1 if error occured
@@ -54,7 +56,8 @@ msdos_initialize_support(
     const rtems_filesystem_operations_table *op_table,
     const rtems_filesystem_file_handlers_r  *file_handlers,
     const rtems_filesystem_file_handlers_r  *directory_handlers,
-    rtems_dosfs_convert_control             *converter
+    rtems_dosfs_convert_control             *converter,
+    uint32_t                                 name_index_max
     )
 {
     int                rc = RC_OK;
@@ -71,6 +74,9 @@ msdos_initialize_support(
 
     fs_info->converter = converter;
 
+    rtems_chain_initialize_empty(&fs_info->name_index_lru);
+    fs_info->name_index_max = name_index_max;
+
     rc = fat_init_volume_info(&fs_info->fat, temp_mt_entry->dev);
     if (rc != RC_OK)
     {
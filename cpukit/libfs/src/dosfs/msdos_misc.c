@@ -926,6 +926,9 @@ msdos_set_first_char4file_name(
       }
     }
 
+    if (fchar == MSDOS_THIS_DIR_ENTRY_EMPTY)
+      msdos_name_index_remove(fs_info, &dir_pos->sname);
+
     return  RC_OK;
 }
 
@@ -1314,7 +1317,8 @@ msdos_find_file_in_directory (
     char                                 *name_dir_entry,
     fat_dir_pos_t                        *dir_pos,
     uint32_t                             *empty_file_offset,
-    uint32_t                             *empty_entry_count)
+    uint32_t                             *empty_entry_count,
+    const uint32_t                        start_dir_offset)
 {
     int               rc                = RC_OK;
     ssize_t           bytes_read;
@@ -1330,7 +1334,7 @@ msdos_find_file_in_directory (
     bool              filename_matched  = false;
     ssize_t           name_len_remaining;
     rtems_dosfs_convert_control *converter = fs_info->converter;
-    uint32_t          dir_offset = 0;
+    uint32_t          dir_offset = start_dir_offset;
 
     /*
      * Scan the directory seeing if the file is present. While
@@ -1658,6 +1662,295 @@ msdos_find_file_in_directory (
     return rc;
 }
 
+/*
+ * State of a directory scan which adds the names of the directory entries to
+ * a name index.  It follows the long file name entries in the same way as
+ * msdos_find_file_in_directory() does.
+ */
+typedef struct
+{
+    bool     lfn_valid;
+    int      lfn_entry;
+    uint8_t  lfn_checksum;
+    uint32_t lfn_offset;
+    size_t   key_pos;
+} msdos_name_index_scan_t;
+
+static int
+msdos_name_index_add_entry(
+    msdos_fs_info_t                      *fs_info,
+    msdos_name_index_t                   *index,
+    msdos_name_index_scan_t              *scan,
+    const char                           *entry,
+    const uint32_t                        file_offset,
+    const fat_pos_t                      *sname)
+{
+    int               rc = RC_OK;
+    int               eno;
+    ssize_t           bytes_in_entry;
+    uint8_t           entry_utf8[MSDOS_LFN_ENTRY_SIZE_UTF8];
+    uint8_t           entry_normalized[MSDOS_LFN_ENTRY_SIZE_UTF8];
+    size_t            bytes_in_entry_normalized = sizeof(entry_normalized);
+    uint8_t          *key = fs_info->name_index_key;
+    rtems_dosfs_convert_control *converter = fs_info->converter;
+
+    if (*MSDOS_DIR_ENTRY_TYPE(entry) == MSDOS_THIS_DIR_ENTRY_EMPTY)
+    {
+        scan->lfn_valid = false;
+        return RC_OK;
+    }
+
+    if ((*MSDOS_DIR_ATTR(entry) & MSDOS_ATTR_LFN_MASK) == MSDOS_ATTR_LFN)
+    {
+        bool is_first_lfn_entry =
+            !scan->lfn_valid ||
+            scan->lfn_entry != (*MSDOS_DIR_ENTRY_TYPE(entry) &
+                                MSDOS_LAST_LONG_ENTRY_MASK) ||
+            scan->lfn_checksum != *MSDOS_DIR_LFN_CHECKSUM(entry);
+
+        /*
+         * Start a new long file name if the entry does not continue the
+         * current one.  Orphaned long file name entries are ignored.
+         */
+        if (is_first_lfn_entry)
+        {
+            scan->lfn_valid = false;
+
+            if ((*MSDOS_DIR_ENTRY_TYPE(entry) & MSDOS_LAST_LONG_ENTRY) == 0)
+                return RC_OK;
+
+            scan->lfn_valid = true;
+            scan->lfn_entry = (*MSDOS_DIR_ENTRY_TYPE(entry)
+                & MSDOS_LAST_LONG_ENTRY_MASK);
+            scan->lfn_checksum = *MSDOS_DIR_LFN_CHECKSUM(entry);
+            scan->lfn_offset = file_offset;
+            scan->key_pos = MSDOS_NAME_MAX_UTF8_LFN_BYTES;
+        }
+
+        scan->lfn_entry--;
+
+        /*
+         * The long file name entries are in reverse order, so the name is
+         * assembled from the end of the key buffer.  Each part is normalized
+         * on its own like in msdos_compare_entry_against_filename().
+         */
+        bytes_in_entry = msdos_long_entry_to_utf8_name (
+            converter,
+            entry,
+            is_first_lfn_entry,
+            &entry_utf8[0],
+            sizeof (entry_utf8));
+        if (bytes_in_entry > 0) {
+            eno = (*converter->handler->utf8_normalize_and_fold) (
+                converter,
+                &entry_utf8[0],
+                bytes_in_entry,
+                &entry_normalized[0],
+                &bytes_in_entry_normalized);
+            if (eno == 0 && bytes_in_entry_normalized <= scan->key_pos) {
+                scan->key_pos -= bytes_in_entry_normalized;
+                memcpy(&key[scan->key_pos], &entry_normalized[0],
+                       bytes_in_entry_normalized);
+            } else {
+                scan->lfn_valid = false;
+            }
+        } else {
+            scan->lfn_valid = false;
+        }
+    }
+    else
+    {
+        uint32_t first_offset = file_offset;
+
+        if (scan->lfn_valid &&
+            scan->lfn_entry == 0 &&
+            scan->lfn_checksum == msdos_lfn_checksum(entry))
+        {
+            first_offset = scan->lfn_offset;
+            rc = msdos_name_index_insert(index,
+                                         &key[scan->key_pos],
+                                         MSDOS_NAME_MAX_UTF8_LFN_BYTES -
+                                         scan->key_pos,
+                                         first_offset,
+                                         sname);
+        }
+
+        scan->lfn_valid = false;
+
+        if (rc == RC_OK &&
+            (*MSDOS_DIR_ATTR(entry) & MSDOS_ATTR_VOLUME_ID) == 0)
+        {
+            bytes_in_entry = msdos_short_entry_to_utf8_name (
+                converter,
+                MSDOS_DIR_NAME (entry),
+                &entry_utf8[0],
+                MSDOS_SHORT_NAME_LEN + 1);
+            if (bytes_in_entry > 0) {
+                eno = (*converter->handler->utf8_normalize_and_fold) (
+                    converter,
+                    &entry_utf8[0],
+                    bytes_in_entry,
+                    &entry_normalized[0],
+                    &bytes_in_entry_normalized);
+                if (eno == 0)
+                    rc = msdos_name_index_insert(index,
+                                                 &entry_normalized[0],
+                                                 bytes_in_entry_normalized,
+                                                 first_offset,
+                                                 sname);
+            }
+        }
+    }
+
+    return rc;
+}
+
+/* msdos_name_index_build --
+ *     Add the names of all entries of a directory to its name index.
+ *
+ * PARAMETERS:
+ *     fs_info - file system info
+ *     fat_fd  - fat-file descriptor of the directory
+ *     bts2rd  - bytes to read at once
+ *     index   - name index of the directory
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occured (errno set apropriately)
+ */
+static int
+msdos_name_index_build(
+    msdos_fs_info_t                      *fs_info,
+    fat_file_fd_t                        *fat_fd,
+    const uint32_t                        bts2rd,
+    msdos_name_index_t                   *index)
+{
+    int                     rc = RC_OK;
+    ssize_t                 bytes_read;
+    uint32_t                dir_offset = 0;
+    uint32_t                dir_entry;
+    fat_pos_t               sname;
+    msdos_name_index_scan_t scan = { .lfn_valid = false };
+
+    while (   rc == RC_OK
+           && (bytes_read = fat_file_read (&fs_info->fat, fat_fd,
+                                           (dir_offset * bts2rd),
+                                           bts2rd, fs_info->cl_buf)) != FAT_EOF)
+    {
+        if (bytes_read < MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE)
+            rtems_set_errno_and_return_minus_one(EIO);
+
+        rc = fat_file_ioctl(&fs_info->fat, fat_fd, F_CLU_NUM,
+                            dir_offset * bts2rd, &sname.cln);
+
+        for (dir_entry = 0;
+             dir_entry < (uint32_t) bytes_read && rc == RC_OK;
+             dir_entry += MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE)
+        {
+            const char *entry = (const char *) fs_info->cl_buf + dir_entry;
+
+            if (*MSDOS_DIR_ENTRY_TYPE(entry) ==
+                MSDOS_THIS_DIR_ENTRY_AND_REST_EMPTY)
+                return RC_OK;
+
+            sname.ofs = dir_entry;
+            rc = msdos_name_index_add_entry(fs_info, index, &scan, entry,
+                                            dir_offset * bts2rd + dir_entry,
+                                            &sname);
+        }
+
+        dir_offset++;
+    }
+
+    return rc;
+}
+
+/* msdos_find_name_in_index --
+ *     Look up a name in the name index of a directory.  The index is built
+ *     by the first lookup in the directory.
+ *
+ * PARAMETERS:
+ *     fs_info              - file system info
+ *     fat_fd               - fat-file descriptor of the directory
+ *     bts2rd               - bytes to read at once
+ *     name_for_compare     - normalized name
+ *     name_len_for_compare - size of the normalized name in bytes
+ *     file_offset          - placeholder for the offset of the first
+ *                            directory entry of the name
+ *
+ * RETURNS:
+ *     RC_OK if the name is present, MSDOS_NAME_NOT_FOUND_ERR if the name is
+ *     not present, or -1 if no name index is available
+ */
+static int
+msdos_find_name_in_index(
+    msdos_fs_info_t                      *fs_info,
+    fat_file_fd_t                        *fat_fd,
+    const uint32_t                        bts2rd,
+    const uint8_t                        *name_for_compare,
+    const size_t                          name_len_for_compare,
+    uint32_t                             *file_offset)
+{
+    msdos_name_index_t *index;
+
+    index = msdos_name_index_get(fs_info, fat_fd->cln);
+    if (index == NULL)
+    {
+        index = msdos_name_index_create(fs_info, fat_fd->cln,
+                                        fat_fd->fat_file_size);
+        if (index == NULL)
+            return -1;
+
+        if (msdos_name_index_build(fs_info, fat_fd, bts2rd, index) != RC_OK)
+        {
+            msdos_name_index_invalidate(fs_info, fat_fd->cln);
+            return -1;
+        }
+    }
+
+    if (msdos_name_index_find(index, name_for_compare, name_len_for_compare,
+                              file_offset))
+        return RC_OK;
+
+    return MSDOS_NAME_NOT_FOUND_ERR;
+}
+
+/* msdos_name_index_add_file --
+ *     Add the names of the directory entries just written by
+ *     msdos_add_file() to the name index of the directory if one exists.
+ */
+static void
+msdos_name_index_add_file(
+    msdos_fs_info_t                      *fs_info,
+    fat_file_fd_t                        *fat_fd,
+    const unsigned int                    lfn_entries,
+    uint32_t                              file_offset,
+    const fat_pos_t                      *sname)
+{
+    msdos_name_index_t *index = msdos_name_index_get(fs_info, fat_fd->cln);
+
+    if (index != NULL)
+    {
+        msdos_name_index_scan_t scan = { .lfn_valid = false };
+        const char             *entry = (const char *) fs_info->cl_buf;
+        unsigned int            i;
+        int                     rc = RC_OK;
+
+        for (i = 0; i <= lfn_entries && rc == RC_OK; ++i)
+        {
+            rc = msdos_name_index_add_entry(fs_info, index, &scan, entry,
+                                            file_offset, sname);
+            entry += MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE;
+            file_offset += MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE;
+        }
+
+        /*
+         * An incomplete index would hide names, so drop it.
+         */
+        if (rc != RC_OK)
+            msdos_name_index_invalidate(fs_info, fat_fd->cln);
+    }
+}
+
 static int
 msdos_get_pos(
     msdos_fs_info_t *fs_info,
@@ -1829,7 +2122,11 @@ msdos_add_file (
                                    empty_file_offset,
                                    length, fs_info->cl_buf);
     if (bytes_written == (ssize_t) length)
+    {
+        msdos_name_index_add_file(fs_info, fat_fd, lfn_entries,
+                                  empty_file_offset, &dir_pos->sname);
         return 0;
+    }
     else if (bytes_written == -1)
         return -1;
     else
@@ -1914,21 +2211,65 @@ msdos_find_name_in_fat_file (
         break;
     }
     if (retval == RC_OK) {
-      /* See if the file/directory does already exist */
-      retval = msdos_find_file_in_directory (
-          buffer,
-          name_len_for_compare,
-          name_len_for_save,
-          name_type,
-          fs_info,
-          fat_fd,
-          bts2rd,
-          create_node,
-          lfn_entries,
-          name_dir_entry,
-          dir_pos,
-          &empty_file_offset,
-          &empty_entry_count);
+      int      index_rc = -1;
+      uint32_t file_offset = 0;
+
+      /*
+       * The name index tells us if the name is not present at all or where
+       * to start the directory scan.  The creation of a node needs a full
+       * scan to find the empty entries.
+       */
+      if (!create_node)
+          index_rc = msdos_find_name_in_index (
+              fs_info,
+              fat_fd,
+              bts2rd,
+              buffer,
+              name_len_for_compare,
+              &file_offset);
+
+      if (index_rc == MSDOS_NAME_NOT_FOUND_ERR) {
+          retval = MSDOS_NAME_NOT_FOUND_ERR;
+      } else {
+          /* See if the file/directory does already exist */
+          retval = msdos_find_file_in_directory (
+              buffer,
+              name_len_for_compare,
+              name_len_for_save,
+              name_type,
+              fs_info,
+              fat_fd,
+              bts2rd,
+              create_node,
+              lfn_entries,
+              name_dir_entry,
+              dir_pos,
+              &empty_file_offset,
+              &empty_entry_count,
+              file_offset / bts2rd);
+
+          /*
+           * The index is out of date, drop it and scan the whole directory.
+           */
+          if (index_rc == RC_OK && retval == MSDOS_NAME_NOT_FOUND_ERR) {
+              msdos_name_index_invalidate(fs_info, fat_fd->cln);
+              retval = msdos_find_file_in_directory (
+                  buffer,
+                  name_len_for_compare,
+                  name_len_for_save,
+                  name_type,
+                  fs_info,
+                  fat_fd,
+                  bts2rd,
+                  create_node,
+                  lfn_entries,
+                  name_dir_entry,
+                  dir_pos,
+                  &empty_file_offset,
+                  &empty_entry_count,
+                  0);
+          }
+      }
     }
     /* Create a non-existing file/directory if requested */
     if (   retval == RC_OK
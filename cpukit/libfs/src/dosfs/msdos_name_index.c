@@ -0,0 +1,413 @@
+/**
+ * @file
+ *
+ * @ingroup libfs_msdos MSDOS FileSystem
+ *
+ * @brief Directory Name Index for the MSDOS FileSystem
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "fat.h"
+#include "fat_file.h"
+
+#include "msdos.h"
+
+/*
+ * The index of a directory maps the normalized and case folded names, as
+ * they are compared by msdos_find_name_in_fat_file(), to the offset of the
+ * first directory entry of the name within the directory.  Each name of a
+ * directory entry (the long name and the short name) has its own index
+ * entry.  Both entries share the position of the short name entry which
+ * identifies the node on the volume.
+ *
+ * The index is only a hint for the lookup.  A name found in the index is
+ * verified by a directory scan starting at the indexed position.  A name not
+ * found in the index does not exist in the directory, so the index must be
+ * kept up to date by all routines which add or remove directory entries.
+ */
+typedef struct
+{
+    rtems_chain_node    name_node;
+    rtems_chain_node    pos_node;
+    uint32_t            hash;
+    uint32_t            file_offset;
+    fat_pos_t           sname;
+    size_t              key_size;
+    uint8_t             key[RTEMS_ZERO_LENGTH_ARRAY];
+} msdos_name_index_entry_t;
+
+#define MSDOS_NAME_INDEX_MIN_BUCKETS 16
+
+#define MSDOS_NAME_INDEX_MAX_BUCKETS 8192
+
+static uint32_t
+msdos_name_index_hash(const uint8_t *key, size_t key_size)
+{
+    uint32_t hash = 2166136261U;
+    size_t   i;
+
+    for (i = 0; i < key_size; ++i) {
+        hash ^= key[i];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+static uint32_t
+msdos_name_index_pos_hash(const fat_pos_t *sname)
+{
+    return (sname->cln * 31) + (sname->ofs / MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE);
+}
+
+static msdos_name_index_entry_t *
+msdos_name_index_entry_of_pos_node(rtems_chain_node *node)
+{
+    return RTEMS_CONTAINER_OF(node, msdos_name_index_entry_t, pos_node);
+}
+
+static void
+msdos_name_index_free(msdos_name_index_t *index)
+{
+    uint32_t i;
+
+    for (i = 0; i <= index->bucket_mask; ++i) {
+        rtems_chain_control *bucket = &index->pos_buckets[i];
+
+        while (!rtems_chain_is_empty(bucket)) {
+            rtems_chain_node *node = rtems_chain_get_first_unprotected(bucket);
+
+            free(msdos_name_index_entry_of_pos_node(node));
+        }
+    }
+
+    free(index->name_buckets);
+    free(index->pos_buckets);
+    free(index);
+}
+
+static void
+msdos_name_index_discard(msdos_fs_info_t *fs_info, msdos_name_index_t *index)
+{
+    rtems_chain_extract_unprotected(&index->lru_node);
+    --fs_info->name_index_count;
+    msdos_name_index_free(index);
+}
+
+/* msdos_name_index_get --
+ *     Get the name index of a directory and make it the most recently used
+ *     one.
+ *
+ * PARAMETERS:
+ *     fs_info - file system info
+ *     cln     - first cluster of the directory
+ *
+ * RETURNS:
+ *     the name index, or NULL if no index exists for this directory
+ */
+msdos_name_index_t *
+msdos_name_index_get(msdos_fs_info_t *fs_info, uint32_t cln)
+{
+    rtems_chain_node *node;
+
+    node = rtems_chain_first(&fs_info->name_index_lru);
+    while (!rtems_chain_is_tail(&fs_info->name_index_lru, node)) {
+        msdos_name_index_t *index = (msdos_name_index_t *) node;
+
+        if (index->cln == cln) {
+            if (!rtems_chain_is_first(node)) {
+                rtems_chain_extract_unprotected(node);
+                rtems_chain_prepend_unprotected(&fs_info->name_index_lru, node);
+            }
+
+            return index;
+        }
+
+        node = rtems_chain_next(node);
+    }
+
+    return NULL;
+}
+
+/* msdos_name_index_create --
+ *     Create an empty name index for a directory.  The least recently used
+ *     index is discarded if the maximum count of indices is reached.
+ *
+ * PARAMETERS:
+ *     fs_info  - file system info
+ *     cln      - first cluster of the directory
+ *     dir_size - size of the directory in bytes
+ *
+ * RETURNS:
+ *     the name index, or NULL if the name index is disabled or no memory
+ *     is available
+ */
+msdos_name_index_t *
+msdos_name_index_create(
+    msdos_fs_info_t *fs_info,
+    uint32_t         cln,
+    uint32_t         dir_size
+    )
+{
+    msdos_name_index_t *index;
+    uint32_t            bucket_count;
+    uint32_t            entry_count;
+    uint32_t            i;
+
+    if (fs_info->name_index_max == 0)
+        return NULL;
+
+    if (fs_info->name_index_key == NULL) {
+        fs_info->name_index_key = malloc(MSDOS_NAME_MAX_UTF8_LFN_BYTES);
+        if (fs_info->name_index_key == NULL)
+            return NULL;
+    }
+
+    while (fs_info->name_index_count >= fs_info->name_index_max) {
+        msdos_name_index_discard(fs_info, (msdos_name_index_t *)
+            rtems_chain_last(&fs_info->name_index_lru));
+    }
+
+    /*
+     * Use about one bucket for two directory entries.  Each name uses at
+     * least one entry for the short name and the long names use more.
+     */
+    entry_count = dir_size / MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE;
+    bucket_count = MSDOS_NAME_INDEX_MIN_BUCKETS;
+    while (bucket_count < MSDOS_NAME_INDEX_MAX_BUCKETS &&
+           bucket_count < entry_count / 2)
+        bucket_count *= 2;
+
+    index = calloc(1, sizeof(*index));
+    if (index == NULL)
+        return NULL;
+
+    index->name_buckets = malloc(bucket_count * sizeof(rtems_chain_control));
+    index->pos_buckets = malloc(bucket_count * sizeof(rtems_chain_control));
+    if (index->name_buckets == NULL || index->pos_buckets == NULL) {
+        free(index->name_buckets);
+        free(index->pos_buckets);
+        free(index);
+        return NULL;
+    }
+
+    for (i = 0; i < bucket_count; ++i) {
+        rtems_chain_initialize_empty(&index->name_buckets[i]);
+        rtems_chain_initialize_empty(&index->pos_buckets[i]);
+    }
+
+    index->cln = cln;
+    index->bucket_mask = bucket_count - 1;
+    rtems_chain_prepend_unprotected(&fs_info->name_index_lru, &index->lru_node);
+    ++fs_info->name_index_count;
+
+    return index;
+}
+
+/* msdos_name_index_insert --
+ *     Insert a name into the name index of a directory.
+ *
+ * PARAMETERS:
+ *     index       - name index of the directory
+ *     key         - normalized name
+ *     key_size    - size of the normalized name in bytes
+ *     file_offset - offset of the first directory entry of the name within
+ *                   the directory
+ *     sname       - position of the short name entry on the volume
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if no memory is available (errno set
+ *     appropriately)
+ */
+int
+msdos_name_index_insert(
+    msdos_name_index_t *index,
+    const uint8_t      *key,
+    size_t              key_size,
+    uint32_t            file_offset,
+    const fat_pos_t    *sname
+    )
+{
+    msdos_name_index_entry_t *entry;
+    uint32_t                  pos_hash;
+
+    entry = malloc(sizeof(*entry) + key_size);
+    if (entry == NULL)
+        rtems_set_errno_and_return_minus_one(ENOMEM);
+
+    entry->hash = msdos_name_index_hash(key, key_size);
+    entry->file_offset = file_offset;
+    entry->sname = *sname;
+    entry->key_size = key_size;
+    memcpy(entry->key, key, key_size);
+
+    pos_hash = msdos_name_index_pos_hash(sname);
+    rtems_chain_append_unprotected(
+        &index->name_buckets[entry->hash & index->bucket_mask],
+        &entry->name_node);
+    rtems_chain_append_unprotected(
+        &index->pos_buckets[pos_hash & index->bucket_mask],
+        &entry->pos_node);
+
+    return RC_OK;
+}
+
+/* msdos_name_index_find --
+ *     Find a name in the name index of a directory.  In case the name is
+ *     present more than once, then the first one in directory order is
+ *     returned, since this is the one a directory scan would find.
+ *
+ * PARAMETERS:
+ *     index       - name index of the directory
+ *     key         - normalized name
+ *     key_size    - size of the normalized name in bytes
+ *     file_offset - placeholder for the offset of the first directory entry
+ *                   of the name within the directory
+ *
+ * RETURNS:
+ *     true if the name was found, otherwise false
+ */
+bool
+msdos_name_index_find(
+    const msdos_name_index_t *index,
+    const uint8_t            *key,
+    size_t                    key_size,
+    uint32_t                 *file_offset
+    )
+{
+    const rtems_chain_control *bucket;
+    const rtems_chain_node    *node;
+    uint32_t                   hash;
+    bool                       found = false;
+
+    hash = msdos_name_index_hash(key, key_size);
+    bucket = &index->name_buckets[hash & index->bucket_mask];
+
+    node = rtems_chain_immutable_first(bucket);
+    while (!rtems_chain_is_tail(bucket, node)) {
+        const msdos_name_index_entry_t *entry = RTEMS_CONTAINER_OF(
+            node, msdos_name_index_entry_t, name_node);
+
+        if (entry->hash == hash && entry->key_size == key_size &&
+            memcmp(entry->key, key, key_size) == 0 &&
+            (!found || entry->file_offset < *file_offset)) {
+            *file_offset = entry->file_offset;
+            found = true;
+        }
+
+        node = rtems_chain_immutable_next(node);
+    }
+
+    return found;
+}
+
+/* msdos_name_index_remove --
+ *     Remove the names of a node from all name indices.  The directory of the
+ *     node is not known, however, the short name position is unique on the
+ *     volume.
+ *
+ * PARAMETERS:
+ *     fs_info - file system info
+ *     sname   - position of the short name entry on the volume
+ */
+void
+msdos_name_index_remove(msdos_fs_info_t *fs_info, const fat_pos_t *sname)
+{
+    rtems_chain_node *node;
+    uint32_t          pos_hash;
+
+    pos_hash = msdos_name_index_pos_hash(sname);
+
+    node = rtems_chain_first(&fs_info->name_index_lru);
+    while (!rtems_chain_is_tail(&fs_info->name_index_lru, node)) {
+        msdos_name_index_t  *index = (msdos_name_index_t *) node;
+        rtems_chain_control *bucket;
+        rtems_chain_node    *pos_node;
+
+        bucket = &index->pos_buckets[pos_hash & index->bucket_mask];
+        pos_node = rtems_chain_first(bucket);
+        while (!rtems_chain_is_tail(bucket, pos_node)) {
+            msdos_name_index_entry_t *entry =
+                msdos_name_index_entry_of_pos_node(pos_node);
+
+            pos_node = rtems_chain_next(pos_node);
+
+            if (entry->sname.cln == sname->cln &&
+                entry->sname.ofs == sname->ofs) {
+                rtems_chain_extract_unprotected(&entry->name_node);
+                rtems_chain_extract_unprotected(&entry->pos_node);
+                free(entry);
+            }
+        }
+
+        node = rtems_chain_next(node);
+    }
+}
+
+/* msdos_name_index_invalidate --
+ *     Discard the name index of a directory if one exists.
+ *
+ * PARAMETERS:
+ *     fs_info - file system info
+ *     cln     - first cluster of the directory
+ */
+void
+msdos_name_index_invalidate(msdos_fs_info_t *fs_info, uint32_t cln)
+{
+    msdos_name_index_t *index = msdos_name_index_get(fs_info, cln);
+
+    if (index != NULL)
+        msdos_name_index_discard(fs_info, index);
+}
+
+/* msdos_name_index_destroy --
+ *     Discard all name indices of the file system.
+ *
+ * PARAMETERS:
+ *     fs_info - file system info
+ */
+void
+msdos_name_index_destroy(msdos_fs_info_t *fs_info)
+{
+    while (!rtems_chain_is_empty(&fs_info->name_index_lru)) {
+        msdos_name_index_discard(fs_info, (msdos_name_index_t *)
+            rtems_chain_first(&fs_info->name_index_lru));
+    }
+
+    free(fs_info->name_index_key);
+    fs_info->name_index_key = NULL;
+}
@@ -70,6 +70,12 @@ msdos_rmnod(const rtems_filesystem_location_info_t *parent_pathloc,
         return rc;
     }
 
+    /*
+     * The clusters of a removed directory may be used by a new directory.
+     */
+    if (fat_fd->fat_file_type == FAT_DIRECTORY)
+        msdos_name_index_invalidate(fs_info, fat_fd->cln);
+
     fat_file_mark_removed(&fs_info->fat, fat_fd);
 
     return rc;
@@ -0,0 +1,302 @@
+#include "rtems-jffs2-config.h"
+
+/*
+ * JFFS2 -- Journalling Flash File System, Version 2.
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * LZ4 compressor for the RTEMS port.
+ *
+ * The compressed data uses the LZ4 block format.  A block is a sequence of
+ * tokens.  The high nibble of the token is the literal length, the low nibble
+ * is the match length minus four.  The value 15 of a nibble indicates that
+ * bytes with the remaining length follow, each 255 byte indicates that
+ * another length byte follows.  The literals follow the literal length.  The
+ * two byte little-endian match offset and the match length bytes follow the
+ * literals.  The last sequence contains only literals.  The last match starts
+ * at least twelve bytes before the end of the block and the last five bytes
+ * are always literals.
+ *
+ * The compressor uses a greedy match search with a hash table of recent
+ * positions.  Since the input is at most one page, all positions and offsets
+ * fit into 16 bits.
+ *
+ * For licensing information, see the file 'LICENCE' in this directory.
+ *
+ */
+
+#include <linux/kernel.h>
+#include <linux/types.h>
+#include <linux/errno.h>
+#include <linux/string.h>
+#include <linux/jffs2.h>
+#include "compr.h"
+
+#define LZ4_MIN_MATCH 4
+
+#define LZ4_LAST_LITERALS 5
+
+#define LZ4_MATCH_FIND_LIMIT 12
+
+#define LZ4_MAX_OFFSET 65535
+
+#define LZ4_HASH_LOG 12
+
+RTEMS_STATIC_ASSERT(
+	RTEMS_ARRAY_SIZE(((rtems_jffs2_compressor_lz4_control *) 0)->hash_table)
+	  == (1 << LZ4_HASH_LOG),
+	LZ4_HASH_LOG
+);
+
+static rtems_jffs2_compressor_lz4_control *get_lz4_control(
+	rtems_jffs2_compressor_control *super
+)
+{
+	return (rtems_jffs2_compressor_lz4_control *) super;
+}
+
+static uint32_t lz4_read32(const unsigned char *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+
+	return v;
+}
+
+static uint32_t lz4_hash(const unsigned char *p)
+{
+	return (lz4_read32(p) * 2654435761U) >> (32 - LZ4_HASH_LOG);
+}
+
+/* Returns the count of bytes necessary to encode the length extension */
+static uint32_t lz4_length_size(uint32_t len)
+{
+	if (len < 15) {
+		return 0;
+	}
+
+	return (len - 15) / 255 + 1;
+}
+
+static unsigned char *lz4_put_length(unsigned char *op, uint32_t len)
+{
+	if (len >= 15) {
+		len -= 15;
+
+		while (len >= 255) {
+			*op++ = 255;
+			len -= 255;
+		}
+
+		*op++ = (unsigned char) len;
+	}
+
+	return op;
+}
+
+/* Returns the new output position or NULL if the sequence does not fit */
+static unsigned char *lz4_put_sequence(
+	unsigned char *op,
+	const unsigned char *op_end,
+	const unsigned char *literals,
+	uint32_t litlen,
+	uint32_t offset,
+	uint32_t matchlen
+)
+{
+	uint32_t need;
+	unsigned char *token;
+
+	need = 1 + lz4_length_size(litlen) + litlen;
+
+	if (matchlen > 0) {
+		need += 2 + lz4_length_size(matchlen - LZ4_MIN_MATCH);
+	}
+
+	if (need > (uint32_t) (op_end - op)) {
+		return NULL;
+	}
+
+	token = op++;
+	*token = (unsigned char) (min_t(uint32_t, litlen, 15) << 4);
+	op = lz4_put_length(op, litlen);
+	memcpy(op, literals, litlen);
+	op += litlen;
+
+	if (matchlen > 0) {
+		matchlen -= LZ4_MIN_MATCH;
+		*token |= (unsigned char) min_t(uint32_t, matchlen, 15);
+		*op++ = (unsigned char) offset;
+		*op++ = (unsigned char) (offset >> 8);
+		op = lz4_put_length(op, matchlen);
+	}
+
+	return op;
+}
+
+uint16_t rtems_jffs2_compressor_lz4_compress(
+	rtems_jffs2_compressor_control *super,
+	unsigned char *data_in,
+	unsigned char *cpage_out,
+	uint32_t *sourcelen,
+	uint32_t *dstlen
+)
+{
+	rtems_jffs2_compressor_lz4_control *self = get_lz4_control(super);
+	uint16_t *hash_table = &self->hash_table[0];
+	uint32_t srclen = *sourcelen;
+	const unsigned char *op_end = cpage_out + min_t(uint32_t, *dstlen, srclen);
+	unsigned char *op = cpage_out;
+	uint32_t anchor = 0;
+	uint32_t pos = 1;
+
+	/* Too small to contain a match */
+	if (srclen < LZ4_MATCH_FIND_LIMIT + 1 || srclen > LZ4_MAX_OFFSET) {
+		return JFFS2_COMPR_NONE;
+	}
+
+	memset(hash_table, 0, sizeof(self->hash_table));
+
+	while (pos + LZ4_MATCH_FIND_LIMIT <= srclen) {
+		uint32_t h = lz4_hash(&data_in[pos]);
+		uint32_t ref = hash_table[h];
+
+		hash_table[h] = (uint16_t) pos;
+
+		if (lz4_read32(&data_in[ref]) == lz4_read32(&data_in[pos])) {
+			uint32_t limit = srclen - LZ4_LAST_LITERALS;
+			uint32_t matchlen = LZ4_MIN_MATCH;
+
+			while (pos > anchor && ref > 0 && data_in[pos - 1] == data_in[ref - 1]) {
+				--pos;
+				--ref;
+				++matchlen;
+			}
+
+			while (pos + matchlen < limit && data_in[pos + matchlen] == data_in[ref + matchlen]) {
+				++matchlen;
+			}
+
+			op = lz4_put_sequence(op, op_end, &data_in[anchor],
+					      pos - anchor, pos - ref, matchlen);
+			if (op == NULL) {
+				return JFFS2_COMPR_NONE;
+			}
+
+			pos += matchlen;
+			anchor = pos;
+
+			/* Make the positions within the match available */
+			if (pos + LZ4_MATCH_FIND_LIMIT <= srclen) {
+				hash_table[lz4_hash(&data_in[pos - 2])] = (uint16_t) (pos - 2);
+			}
+		} else {
+			++pos;
+		}
+	}
+
+	op = lz4_put_sequence(op, op_end, &data_in[anchor], srclen - anchor, 0, 0);
+	if (op == NULL || op - cpage_out >= srclen) {
+		return JFFS2_COMPR_NONE;
+	}
+
+	*dstlen = (uint32_t) (op - cpage_out);
+	return RTEMS_JFFS2_COMPR_LZ4;
+}
+
+/* Returns false if the length extension exceeds the input */
+static bool lz4_get_length(
+	const unsigned char *data_in,
+	uint32_t srclen,
+	uint32_t *ip,
+	uint32_t *len
+)
+{
+	if (*len == 15) {
+		unsigned char b;
+
+		do {
+			if (*ip >= srclen) {
+				return false;
+			}
+
+			b = data_in[(*ip)++];
+			*len += b;
+		} while (b == 255);
+	}
+
+	return true;
+}
+
+int rtems_jffs2_compressor_lz4_decompress(
+	rtems_jffs2_compressor_control *self,
+	uint16_t comprtype,
+	unsigned char *data_in,
+	unsigned char *cpage_out,
+	uint32_t srclen,
+	uint32_t destlen
+)
+{
+	uint32_t ip = 0;
+	uint32_t op = 0;
+
+	(void) self;
+
+	if (comprtype != RTEMS_JFFS2_COMPR_LZ4) {
+		return -EIO;
+	}
+
+	while (ip < srclen) {
+		unsigned char token = data_in[ip++];
+		uint32_t litlen = token >> 4;
+		uint32_t matchlen = token & 0xf;
+		uint32_t offset;
+		uint32_t i;
+
+		if (!lz4_get_length(data_in, srclen, &ip, &litlen)
+		    || litlen > srclen - ip || litlen > destlen - op) {
+			return -EIO;
+		}
+
+		memcpy(&cpage_out[op], &data_in[ip], litlen);
+		ip += litlen;
+		op += litlen;
+
+		/* The last sequence has no match */
+		if (ip == srclen) {
+			break;
+		}
+
+		if (srclen - ip < 2) {
+			return -EIO;
+		}
+
+		offset = data_in[ip] | ((uint32_t) data_in[ip + 1] << 8);
+		ip += 2;
+
+		if (offset == 0 || offset > op
+		    || !lz4_get_length(data_in, srclen, &ip, &matchlen)) {
+			return -EIO;
+		}
+
+		matchlen += LZ4_MIN_MATCH;
+
+		if (matchlen > destlen - op) {
+			return -EIO;
+		}
+
+		/* The match may overlap the output, so copy byte by byte */
+		for (i = 0; i < matchlen; ++i) {
+			cpage_out[op + i] = cpage_out[op - offset + i];
+		}
+
+		op += matchlen;
+	}
+
+	if (op != destlen) {
+		return -EIO;
+	}
+
+	return 0;
+}
@@ -29,6 +29,7 @@
 #include <assert.h>
 #include <rtems/libio.h>
 #include <rtems/libio_.h>
+#include <rtems/rtems/tasks.h>
 
 /* Ensure that the JFFS2 values are identical to the POSIX defines */
 
@@ -361,9 +362,14 @@ static void rtems_jffs2_free_fs_info(rtems_jffs2_fs_info *fs_info, bool do_mount
 	if (do_mount_fs_was_successful) {
 		jffs2_free_ino_caches(c);
 		jffs2_free_raw_node_refs(c);
+		jffs2_sum_exit(c);
 		free(c->blocks);
 	}
 
+	if (sb->s_gc_task != 0) {
+		(void) rtems_task_delete(sb->s_gc_task);
+	}
+
 	rtems_jffs2_flash_control_destroy(fs_info->sb.s_flash_control);
 	rtems_jffs2_compressor_control_destroy(fs_info->sb.s_compressor_control);
 	rtems_recursive_mutex_destroy(&sb->s_mutex);
@@ -395,6 +401,111 @@ static struct _inode *rtems_jffs2_get_inode_by_iop(
 	return iop->pathinfo.node_access;
 }
 
+static off_t rtems_jffs2_file_size(const struct _inode *inode)
+{
+	return inode->i_size + inode->i_wbuf_len;
+}
+
+static int rtems_jffs2_flush_write_buffer(struct _inode *inode)
+{
+	struct jffs2_inode_info *f = JFFS2_INODE_INFO(inode);
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(inode->i_sb);
+	struct jffs2_raw_inode ri;
+	uint32_t len = inode->i_wbuf_len;
+	uint32_t writtenlen;
+	int ret;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	memset(&ri, 0, sizeof(ri));
+
+	ri.ino = cpu_to_je32(f->inocache->ino);
+	ri.mode = cpu_to_jemode(inode->i_mode);
+	ri.uid = cpu_to_je16(inode->i_uid);
+	ri.gid = cpu_to_je16(inode->i_gid);
+	ri.atime = ri.ctime = ri.mtime = cpu_to_je32(inode->i_mtime);
+	ri.isize = cpu_to_je32(inode->i_size);
+
+	ret = jffs2_write_inode_range(c, f, &ri, inode->i_wbuf, inode->i_size, len, &writtenlen);
+
+	/*
+	 * Keep the data which did not make it to flash at the start of the
+	 * buffer, so that a later flush may retry it.
+	 */
+	inode->i_size += writtenlen;
+	inode->i_wbuf_len = len - writtenlen;
+	memmove(inode->i_wbuf, &inode->i_wbuf[writtenlen], inode->i_wbuf_len);
+
+	if (ret == 0 && writtenlen != len) {
+		ret = -ENOSPC;
+	}
+
+	return ret;
+}
+
+static void rtems_jffs2_free_write_buffer(struct _inode *inode)
+{
+	free(inode->i_wbuf);
+	inode->i_wbuf = NULL;
+	inode->i_wbuf_len = 0;
+}
+
+static bool rtems_jffs2_is_buffered_write(const struct _inode *inode, off_t pos, size_t len)
+{
+	uint32_t size = inode->i_sb->s_write_buffer_size;
+
+	return len < size && pos == rtems_jffs2_file_size(inode);
+}
+
+/*
+ * Appends the data to the write buffer.  The buffered data starts at the end
+ * of the data on flash.  The buffer is written to flash once it is full or
+ * reaches a page boundary, since a data node cannot cross a page boundary.
+ * In case of an error, the data of this call which is still in the buffer is
+ * dropped, so that the file size does not include data reported as not
+ * written.  Data which already made it to flash stays, like in the direct
+ * write path.
+ */
+static int rtems_jffs2_buffer_write(struct _inode *inode, const unsigned char *buf, uint32_t len)
+{
+	uint32_t size = inode->i_sb->s_write_buffer_size;
+	uint32_t start = (uint32_t) rtems_jffs2_file_size(inode);
+	int ret = 0;
+
+	if (inode->i_wbuf == NULL) {
+		inode->i_wbuf = malloc(size);
+		if (inode->i_wbuf == NULL) {
+			return -ENOMEM;
+		}
+	}
+
+	while (len > 0 && ret == 0) {
+		uint32_t capacity = min_t(uint32_t, size, PAGE_SIZE - (inode->i_size & (PAGE_SIZE - 1)));
+		uint32_t chunk = min_t(uint32_t, len, capacity - inode->i_wbuf_len);
+
+		memcpy(&inode->i_wbuf[inode->i_wbuf_len], buf, chunk);
+		inode->i_wbuf_len += chunk;
+		buf += chunk;
+		len -= chunk;
+
+		if (inode->i_wbuf_len == capacity) {
+			ret = rtems_jffs2_flush_write_buffer(inode);
+		}
+	}
+
+	if (ret != 0) {
+		if (inode->i_size < start) {
+			inode->i_wbuf_len = start - inode->i_size;
+		} else {
+			inode->i_wbuf_len = 0;
+		}
+	}
+
+	return ret;
+}
+
 static int rtems_jffs2_fstat(
 	const rtems_filesystem_location_info_t *loc,
 	struct stat *buf
@@ -413,7 +524,7 @@ static int rtems_jffs2_fstat(
 	buf->st_nlink = inode->i_nlink;
 	buf->st_uid = inode->i_uid;
 	buf->st_gid = inode->i_gid;
-	buf->st_size = inode->i_size;
+	buf->st_size = rtems_jffs2_file_size(inode);
 	buf->st_atime = inode->i_atime;
 	buf->st_mtime = inode->i_mtime;
 	buf->st_ctime = inode->i_ctime;
@@ -556,6 +667,72 @@ static int rtems_jffs2_on_demand_garbage_collection(struct jffs2_sb_info *c)
 	}
 }
 
+static void rtems_jffs2_gc_task(rtems_task_argument arg)
+{
+	struct super_block *sb = (struct super_block *) arg;
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	rtems_event_set events = 0;
+
+	while ((events & RTEMS_JFFS2_GC_STOP_EVENT) == 0) {
+		bool more;
+
+		rtems_jffs2_do_lock(sb);
+		more = jffs2_thread_should_wake(c)
+			&& jffs2_garbage_collect_pass(c) == 0;
+		rtems_jffs2_do_unlock(sb);
+
+		/*
+		 * Release the file system lock after each pass so that the
+		 * garbage collection delays other operations by at most one
+		 * pass.
+		 */
+		events = 0;
+		(void) rtems_event_receive(
+			RTEMS_JFFS2_GC_EVENT | RTEMS_JFFS2_GC_STOP_EVENT,
+			RTEMS_EVENT_ANY | (more ? RTEMS_NO_WAIT : RTEMS_WAIT),
+			RTEMS_NO_TIMEOUT,
+			&events
+		);
+	}
+
+	(void) rtems_event_transient_send(sb->s_gc_task_stopper);
+	rtems_task_exit();
+}
+
+static int rtems_jffs2_create_gc_task(
+	struct super_block *sb,
+	rtems_task_priority priority
+)
+{
+	rtems_status_code sc;
+
+	sc = rtems_task_create(
+		rtems_build_name('J', 'F', 'G', 'C'),
+		priority,
+		2 * RTEMS_MINIMUM_STACK_SIZE,
+		RTEMS_DEFAULT_MODES,
+		RTEMS_DEFAULT_ATTRIBUTES,
+		&sb->s_gc_task
+	);
+	if (sc != RTEMS_SUCCESSFUL) {
+		sb->s_gc_task = 0;
+
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+static void rtems_jffs2_stop_gc_task(struct super_block *sb)
+{
+	if (sb->s_gc_task != 0) {
+		sb->s_gc_task_stopper = rtems_task_self();
+		(void) rtems_event_send(sb->s_gc_task, RTEMS_JFFS2_GC_STOP_EVENT);
+		(void) rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+		sb->s_gc_task = 0;
+	}
+}
+
 static int rtems_jffs2_ioctl(
 	rtems_libio_t   *iop,
 	ioctl_command_t  request,
@@ -617,9 +794,11 @@ static ssize_t rtems_jffs2_file_read(rtems_libio_t *iop, void *buf, size_t len)
 
 	rtems_jffs2_do_lock(inode->i_sb);
 
+	err = rtems_jffs2_flush_write_buffer(inode);
+
 	pos = iop->offset;
 
-	if (pos >= inode->i_size) {
+	if (err != 0 || pos >= inode->i_size) {
 		len = 0;
 	} else {
 		uint32_t pos_32 = (uint32_t) pos;
@@ -668,20 +847,27 @@ static ssize_t rtems_jffs2_file_write(rtems_libio_t *iop, const void *buf, size_
 	rtems_jffs2_do_lock(inode->i_sb);
 
 	if (rtems_libio_iop_is_append(iop)) {
-		pos = inode->i_size;
+		pos = rtems_jffs2_file_size(inode);
 	} else {
 		pos = iop->offset;
 	}
 
-	if (pos > inode->i_size) {
-		ri.version = cpu_to_je32(++f->highest_version);
-		eno = -jffs2_extend_file(inode, &ri, pos);
-	}
+	if (rtems_jffs2_is_buffered_write(inode, pos, len)) {
+		eno = -rtems_jffs2_buffer_write(inode, buf, len);
+		writtenlen = len;
+	} else {
+		eno = -rtems_jffs2_flush_write_buffer(inode);
 
-	if (eno == 0) {
-		ri.isize = cpu_to_je32(inode->i_size);
+		if (eno == 0 && pos > inode->i_size) {
+			ri.version = cpu_to_je32(++f->highest_version);
+			eno = -jffs2_extend_file(inode, &ri, pos);
+		}
+
+		if (eno == 0) {
+			ri.isize = cpu_to_je32(inode->i_size);
 
-		eno = -jffs2_write_inode_range(c, f, &ri, (void *) buf, pos, len, &writtenlen);
+			eno = -jffs2_write_inode_range(c, f, &ri, (void *) buf, pos, len, &writtenlen);
+		}
 	}
 
 	if (eno == 0) {
@@ -689,7 +875,7 @@ static ssize_t rtems_jffs2_file_write(rtems_libio_t *iop, const void *buf, size_
 
 		inode->i_mtime = inode->i_ctime = je32_to_cpu(ri.mtime);
 
-		if (pos > inode->i_size) {
+		if (pos > rtems_jffs2_file_size(inode)) {
 			inode->i_size = pos;
 		}
 
@@ -724,7 +910,48 @@ static int rtems_jffs2_file_ftruncate(rtems_libio_t *iop, off_t length)
 
 	rtems_jffs2_do_lock(inode->i_sb);
 
-	eno = -jffs2_do_setattr(inode, &iattr);
+	eno = -rtems_jffs2_flush_write_buffer(inode);
+
+	if (eno == 0) {
+		eno = -jffs2_do_setattr(inode, &iattr);
+	}
+
+	rtems_jffs2_do_unlock(inode->i_sb);
+
+	return rtems_jffs2_eno_to_rv_and_errno(eno);
+}
+
+static int rtems_jffs2_file_close(rtems_libio_t *iop)
+{
+	struct _inode *inode = rtems_jffs2_get_inode_by_iop(iop);
+	int eno;
+
+	rtems_jffs2_do_lock(inode->i_sb);
+
+	eno = -rtems_jffs2_flush_write_buffer(inode);
+
+	/*
+	 * In case of an error, the buffered data stays with the inode.  Another
+	 * operation on the inode may flush it, otherwise it is freed together with
+	 * the inode.
+	 */
+	if (eno == 0) {
+		rtems_jffs2_free_write_buffer(inode);
+	}
+
+	rtems_jffs2_do_unlock(inode->i_sb);
+
+	return rtems_jffs2_eno_to_rv_and_errno(eno);
+}
+
+static int rtems_jffs2_file_fsync(rtems_libio_t *iop)
+{
+	struct _inode *inode = rtems_jffs2_get_inode_by_iop(iop);
+	int eno;
+
+	rtems_jffs2_do_lock(inode->i_sb);
+
+	eno = -rtems_jffs2_flush_write_buffer(inode);
 
 	rtems_jffs2_do_unlock(inode->i_sb);
 
@@ -733,15 +960,15 @@ static int rtems_jffs2_file_ftruncate(rtems_libio_t *iop, off_t length)
 
 static const rtems_filesystem_file_handlers_r rtems_jffs2_file_handlers = {
 	.open_h = rtems_filesystem_default_open,
-	.close_h = rtems_filesystem_default_close,
+	.close_h = rtems_jffs2_file_close,
 	.read_h = rtems_jffs2_file_read,
 	.write_h = rtems_jffs2_file_write,
 	.ioctl_h = rtems_jffs2_ioctl,
 	.lseek_h = rtems_filesystem_default_lseek_file,
 	.fstat_h = rtems_jffs2_fstat,
 	.ftruncate_h = rtems_jffs2_file_ftruncate,
-	.fsync_h = rtems_filesystem_default_fsync_or_fdatasync,
-	.fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync,
+	.fsync_h = rtems_jffs2_file_fsync,
+	.fdatasync_h = rtems_jffs2_file_fsync,
 	.fcntl_h = rtems_filesystem_default_fcntl,
 	.kqfilter_h = rtems_filesystem_default_kqfilter,
 	.mmap_h = rtems_filesystem_default_mmap,
@@ -1054,6 +1281,8 @@ static void rtems_jffs2_fsunmount(rtems_filesystem_mount_table_entry_t *mt_entry
 	rtems_jffs2_fs_info *fs_info = mt_entry->fs_info;
 	struct _inode *root_i = mt_entry->mt_fs_root->location.node_access;
 
+	rtems_jffs2_stop_gc_task(&fs_info->sb);
+
 	icache_evict(root_i, NULL);
 	assert(root_i->i_cache_next == NULL);
 	assert(root_i->i_count == 1);
@@ -1263,6 +1492,8 @@ int rtems_jffs2_initialize(
 		sb->s_is_readonly = !mt_entry->writeable;
 		sb->s_flash_control = fc;
 		sb->s_compressor_control = jffs2_mount_data->compressor_control;
+		sb->s_enable_summary = jffs2_mount_data->enable_summary;
+		sb->s_write_buffer_size = min_t(uint32_t, jffs2_mount_data->write_buffer_size, PAGE_SIZE);
 
 		c->inocache_hashsize = inocache_hashsize;
 		c->inocache_list = &fs_info->inode_cache[0];
@@ -1276,6 +1507,22 @@ int rtems_jffs2_initialize(
 	if (err == 0) {
 		do_mount_fs_was_successful = true;
 
+		if (jffs2_mount_data->gc_trigger_free_blocks != 0) {
+			c->resv_blocks_gctrigger = (uint8_t) min_t(uint32_t,
+				jffs2_mount_data->gc_trigger_free_blocks, UINT8_MAX);
+		}
+
+		if (jffs2_mount_data->gc_trigger_very_dirty_blocks != 0) {
+			c->vdirty_blocks_gctrigger = (uint8_t) min_t(uint32_t,
+				jffs2_mount_data->gc_trigger_very_dirty_blocks, UINT8_MAX);
+		}
+
+		if (jffs2_mount_data->gc_task_priority != 0 && !jffs2_is_readonly(c)) {
+			err = rtems_jffs2_create_gc_task(sb, jffs2_mount_data->gc_task_priority);
+		}
+	}
+
+	if (err == 0) {
 		sb->s_root = jffs2_iget(sb, 1);
 		if (IS_ERR(sb->s_root)) {
 			err = PTR_ERR(sb->s_root);
@@ -1294,6 +1541,10 @@ int rtems_jffs2_initialize(
 		mt_entry->mt_fs_root->location.node_access = sb->s_root;
 		mt_entry->mt_fs_root->location.handlers = &rtems_jffs2_directory_handlers;
 
+		if (sb->s_gc_task != 0) {
+			(void) rtems_task_start(sb->s_gc_task, rtems_jffs2_gc_task, (rtems_task_argument) sb);
+		}
+
 		return 0;
 	} else {
 		if (fs_info != NULL) {
@@ -1497,6 +1748,7 @@ static void jffs2_clear_inode (struct _inode *inode)
         D1(printk(KERN_DEBUG "jffs2_clear_inode(): ino #%lu mode %o\n", inode->i_ino, inode->i_mode));
 
         jffs2_do_clear_inode(c, f);
+        rtems_jffs2_free_write_buffer(inode);
 }
 
 
@@ -699,6 +699,18 @@ static int jffs2_garbage_collect_pristine(struct jffs2_sb_info *c,
  retry:
 	phys_ofs = write_ofs(c);
 
+#ifdef __rtems__
+	/* The plain flash write does not collect summary information */
+	if (jffs2_sum_active(c)) {
+		struct kvec vecs[1];
+
+		vecs[0].iov_base = node;
+		vecs[0].iov_len = rawlen;
+		ret = jffs2_sum_add_kvec(c, vecs, 1, phys_ofs);
+		if (ret)
+			goto out_node;
+	}
+#endif /* __rtems__ */
 	ret = jffs2_flash_write(c, phys_ofs, rawlen, &retlen, (char *)node);
 
 	if (ret || (retlen != rawlen)) {
@@ -363,7 +363,7 @@ static int jffs2_do_reserve_space(struct jffs2_sb_info *c, uint32_t minsize,
  restart:
 	reserved_size = 0;
 
-	if (jffs2_sum_active() && (sumsize != JFFS2_SUMMARY_NOSUM_SIZE)) {
+	if (jffs2_sum_active(c) && (sumsize != JFFS2_SUMMARY_NOSUM_SIZE)) {
 							/* NOSUM_SIZE means not to generate summary */
 
 		if (jeb) {
@@ -791,6 +791,10 @@ void jffs2_mark_node_obsolete(struct jffs2_sb_info *c, struct jffs2_raw_node_ref
 			ref_offset(ref), retlen);
 		goto out_erase_sem;
 	}
+#ifdef __rtems__
+	if (jffs2_sum_active(c))
+		jffs2_sum_remove_node(c, jeb, ref_offset(ref));
+#endif /* __rtems__ */
 
 	/* Nodes which have been marked obsolete no longer need to be
 	   associated with any inode. Remove them from the per-inode list.
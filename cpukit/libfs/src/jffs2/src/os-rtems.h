@@ -33,6 +33,7 @@
 
 #include <rtems/jffs2.h>
 #include <rtems/thread.h>
+#include <rtems/rtems/event.h>
 
 #define CONFIG_JFFS2_RTIME
 
@@ -92,6 +93,9 @@ struct _inode {
 
 	struct jffs2_inode_info	jffs2_i;
 
+	unsigned char *		i_wbuf; // Data appended after i_size, not yet on flash
+	uint32_t		i_wbuf_len;
+
         struct _inode *		i_cache_prev; // We need doubly-linked?
         struct _inode *		i_cache_next;
 };
@@ -105,6 +109,10 @@ struct super_block {
 	rtems_jffs2_flash_control	*s_flash_control;
 	rtems_jffs2_compressor_control	*s_compressor_control;
 	bool			s_is_readonly;
+	bool			s_enable_summary;
+	uint32_t		s_write_buffer_size;
+	rtems_id		s_gc_task;
+	rtems_id		s_gc_task_stopper;
 	unsigned char		s_gc_buffer[PAGE_CACHE_SIZE]; // Avoids malloc when user may be under memory pressure
 	rtems_recursive_mutex	s_mutex;
 	char			s_name_buf[JFFS2_MAX_NAME_LEN];
@@ -120,12 +128,18 @@ static inline bool jffs2_is_readonly(struct jffs2_sb_info *c)
 	return sb->s_is_readonly;
 }
 
+#define RTEMS_JFFS2_GC_EVENT RTEMS_EVENT_0
+
+#define RTEMS_JFFS2_GC_STOP_EVENT RTEMS_EVENT_1
+
 static inline void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c)
 {
 	const struct super_block *sb = OFNI_BS_2SFFJ(c);
 	rtems_jffs2_flash_control *fc = sb->s_flash_control;
 
-	if (fc->trigger_garbage_collection != NULL) {
+	if (sb->s_gc_task != 0) {
+		(void) rtems_event_send(sb->s_gc_task, RTEMS_JFFS2_GC_EVENT);
+	} else if (fc->trigger_garbage_collection != NULL) {
 		(*fc->trigger_garbage_collection)(fc);
 	}
 }
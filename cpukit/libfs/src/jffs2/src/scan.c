@@ -134,7 +134,7 @@ int jffs2_scan_medium(struct jffs2_sb_info *c)
 		buf_size = (uint32_t)try_size;
 	}
 
-	if (jffs2_sum_active()) {
+	if (jffs2_sum_active(c)) {
 		s = kzalloc(sizeof(struct jffs2_summary), GFP_KERNEL);
 		if (!s) {
 			JFFS2_WARNING("Can't allocate memory for summary\n");
@@ -376,7 +376,7 @@ static int jffs2_scan_xattr_node(struct jffs2_sb_info *c, struct jffs2_erasebloc
 		jffs2_link_node_ref(c, jeb, ofs | REF_PRISTINE, totlen, (void *)xd);
 	}
 
-	if (jffs2_sum_active())
+	if (jffs2_sum_active(c))
 		jffs2_sum_add_xattr_mem(s, rx, ofs - jeb->offset);
 	dbg_xattr("scanning xdatum at %#08x (xid=%u, version=%u)\n",
 		  ofs, xd->xid, xd->version);
@@ -432,7 +432,7 @@ static int jffs2_scan_xref_node(struct jffs2_sb_info *c, struct jffs2_eraseblock
 
 	jffs2_link_node_ref(c, jeb, ofs | REF_PRISTINE, PAD(je32_to_cpu(rr->totlen)), (void *)ref);
 
-	if (jffs2_sum_active())
+	if (jffs2_sum_active(c))
 		jffs2_sum_add_xref_mem(s, rr, ofs - jeb->offset);
 	dbg_xattr("scan xref at %#08x (xid=%u, ino=%u)\n",
 		  ofs, ref->xid, ref->ino);
@@ -482,7 +482,7 @@ static int jffs2_scan_eraseblock (struct jffs2_sb_info *c, struct jffs2_eraseblo
 	}
 #endif
 
-	if (jffs2_sum_active()) {
+	if (jffs2_sum_active(c)) {
 		struct jffs2_sum_marker *sm;
 		void *sumptr = NULL;
 		uint32_t sumlen;
@@ -888,7 +888,7 @@ scan_more:
 			break;
 
 		case JFFS2_NODETYPE_PADDING:
-			if (jffs2_sum_active())
+			if (jffs2_sum_active(c))
 				jffs2_sum_add_padding_mem(s, je32_to_cpu(node->totlen));
 			if ((err = jffs2_scan_dirty_space(c, jeb, PAD(je32_to_cpu(node->totlen)))))
 				return err;
@@ -936,7 +936,7 @@ scan_more:
 		}
 	}
 
-	if (jffs2_sum_active()) {
+	if (jffs2_sum_active(c)) {
 		if (PAD(s->sum_size + JFFS2_SUMMARY_FRAME_SIZE) > jeb->free_size) {
 			dbg_summary("There is not enough space for "
 				"summary information, disabling for this jeb!\n");
@@ -1032,7 +1032,7 @@ static int jffs2_scan_inode_node(struct jffs2_sb_info *c, struct jffs2_erasebloc
 
 	pseudo_random += je32_to_cpu(ri->version);
 
-	if (jffs2_sum_active()) {
+	if (jffs2_sum_active(c)) {
 		jffs2_sum_add_inode_mem(s, ri, ofs - jeb->offset);
 	}
 
@@ -1107,7 +1107,7 @@ static int jffs2_scan_dirent_node(struct jffs2_sb_info *c, struct jffs2_eraseblo
 	fd->type = rd->type;
 	jffs2_add_fd_to_list(c, fd, &ic->scan_dents);
 
-	if (jffs2_sum_active()) {
+	if (jffs2_sum_active(c)) {
 		jffs2_sum_add_dirent_mem(s, rd, ofs - jeb->offset);
 	}
 
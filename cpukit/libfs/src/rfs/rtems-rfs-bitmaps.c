@@ -8,7 +8,8 @@
  * These functions manage bit maps. A bit map consists of the map of bit
  * allocated in a block and a search map where a bit represents 32 actual
  * bits. The search map allows for a faster search for an available bit as 32
- * search bits can checked in a test.
+ * search bits can checked in a test. The elements are searched a word at a
+ * time and the clear bit in an element is found by counting the zeros.
  */
 
 /*
@@ -357,6 +358,67 @@ rtems_rfs_bitmap_map_clear_all (rtems_rfs_bitmap_control* control)
   return 0;
 }
 
+/**
+ * Return the free bits of an element. A free bit is returned as a 1
+ * independent of the state of RTEMS_RFS_BITMAP_CLEAR_ZERO.
+ *
+ * @param target The element to get the free bits of.
+ * @return rtems_rfs_bitmap_element The mask of free bits.
+ */
+static rtems_rfs_bitmap_element
+rtems_rfs_bitmap_free_bits (rtems_rfs_bitmap_element target)
+{
+  return target ^ RTEMS_RFS_BITMAP_ELEMENT_SET;
+}
+
+/**
+ * Return the lowest bit set in a mask. The mask must not be 0.
+ */
+static int
+rtems_rfs_bitmap_first_bit (rtems_rfs_bitmap_element mask)
+{
+  return __builtin_ctz (mask);
+}
+
+/**
+ * Return the highest bit set in a mask. The mask must not be 0.
+ */
+static int
+rtems_rfs_bitmap_last_bit (rtems_rfs_bitmap_element mask)
+{
+  return rtems_rfs_bitmap_element_bits () - 1 - __builtin_clz (mask);
+}
+
+/**
+ * Allocate a bit found clear by a search and update the search map if the
+ * element becomes full.
+ */
+static void
+rtems_rfs_bitmap_alloc_bits (rtems_rfs_bitmap_control* control,
+                             rtems_rfs_bitmap_map      map,
+                             int                       map_index,
+                             rtems_rfs_bitmap_element  bits,
+                             size_t                    count)
+{
+  map[map_index] = rtems_rfs_bitmap_set (map[map_index], bits);
+  if (rtems_rfs_bitmap_match (map[map_index], RTEMS_RFS_BITMAP_ELEMENT_SET))
+  {
+    int search_index  = rtems_rfs_bitmap_map_index (map_index);
+    int search_offset = rtems_rfs_bitmap_map_offset (map_index);
+    control->search_bits[search_index] =
+      rtems_rfs_bitmap_set (control->search_bits[search_index],
+                            1 << search_offset);
+  }
+  control->free -= count;
+  rtems_rfs_buffer_mark_dirty (control->buffer);
+}
+
+/**
+ * Search the map for a clear bit from the bit for the window distance in the
+ * direction. The search map is checked a word at a time to skip elements that
+ * are full and the first clear bit in an element is found with a count of the
+ * zeros rather than testing each bit in turn.
+ */
 static int
 rtems_rfs_search_map_for_clear_bit (rtems_rfs_bitmap_control* control,
                                     rtems_rfs_bitmap_bit*     bit,
@@ -367,12 +429,9 @@ rtems_rfs_search_map_for_clear_bit (rtems_rfs_bitmap_control* control,
   rtems_rfs_bitmap_map      map;
   rtems_rfs_bitmap_bit      test_bit;
   rtems_rfs_bitmap_bit      end_bit;
-  rtems_rfs_bitmap_element* search_bits;
-  int                       search_index;
-  int                       search_offset;
-  rtems_rfs_bitmap_element* map_bits;
+  int                       start_index;
+  int                       end_index;
   int                       map_index;
-  int                       map_offset;
   int                       rc;
 
   *found = false;
@@ -395,112 +454,98 @@ rtems_rfs_search_map_for_clear_bit (rtems_rfs_bitmap_control* control,
   else if (end_bit >= control->size)
     end_bit = control->size - 1;
 
-  map_index     = rtems_rfs_bitmap_map_index (test_bit);
-  map_offset    = rtems_rfs_bitmap_map_offset (test_bit);
-  search_index  = rtems_rfs_bitmap_map_index (map_index);
-  search_offset = rtems_rfs_bitmap_map_offset (map_index);
-
-  search_bits = &control->search_bits[search_index];
-  map_bits    = &map[map_index];
+  start_index = rtems_rfs_bitmap_map_index (test_bit);
+  end_index   = rtems_rfs_bitmap_map_index (end_bit);
+  map_index   = start_index;
 
-  /*
-   * Check each bit from the search map offset for a clear bit.
-   */
-  do
+  while ((direction > 0) ? (map_index <= end_index) : (map_index >= end_index))
   {
+    rtems_rfs_bitmap_element available;
+    int                      search_index;
+    int                      search_offset;
+
     /*
-     * If any bit is clear find that bit and then search the map element. If
-     * all bits are set there are no map bits so move to the next search
-     * element.
+     * Use the search map to find the next element that is not full.
      */
-    if (!rtems_rfs_bitmap_match (*search_bits, RTEMS_RFS_BITMAP_ELEMENT_SET))
+    search_index  = rtems_rfs_bitmap_map_index (map_index);
+    search_offset = rtems_rfs_bitmap_map_offset (map_index);
+    available =
+      rtems_rfs_bitmap_free_bits (control->search_bits[search_index]);
+
+    if (direction > 0)
     {
-      while ((search_offset >= 0)
-             && (search_offset < rtems_rfs_bitmap_element_bits ()))
+      available &=
+        rtems_rfs_bitmap_mask_section (search_offset,
+                                       rtems_rfs_bitmap_element_bits ());
+      if (!available)
       {
-        if (!rtems_rfs_bitmap_test (*search_bits, search_offset))
-        {
-          /*
-           * Find the clear bit in the map. Update the search map and map if
-           * found. We may find none are spare if searching up from the seed.
-           */
-          while ((map_offset >= 0)
-                 && (map_offset < rtems_rfs_bitmap_element_bits ()))
-          {
-            if (!rtems_rfs_bitmap_test (*map_bits, map_offset))
-            {
-              *map_bits = rtems_rfs_bitmap_set (*map_bits, 1 << map_offset);
-              if (rtems_rfs_bitmap_match(*map_bits,
-                                         RTEMS_RFS_BITMAP_ELEMENT_SET))
-                *search_bits = rtems_rfs_bitmap_set (*search_bits,
-                                                     1 << search_offset);
-              control->free--;
-              *bit = test_bit;
-              *found = true;
-              rtems_rfs_buffer_mark_dirty (control->buffer);
-              return 0;
-            }
-
-            if (test_bit == end_bit)
-              break;
-
-            map_offset += direction;
-            test_bit   += direction;
-          }
-        }
-
-        map_bits  += direction;
-        map_index += direction;
-        map_offset = direction > 0 ? 0 : rtems_rfs_bitmap_element_bits () - 1;
-
-        test_bit = (map_index * rtems_rfs_bitmap_element_bits ()) + map_offset;
-
-        search_offset += direction;
-
-        if (((direction < 0) && (test_bit <= end_bit))
-            || ((direction > 0) && (test_bit >= end_bit)))
-          break;
+        map_index = (search_index + 1) * rtems_rfs_bitmap_element_bits ();
+        continue;
       }
+      map_index = (search_index * rtems_rfs_bitmap_element_bits ()) +
+        rtems_rfs_bitmap_first_bit (available);
+      if (map_index > end_index)
+        break;
     }
     else
     {
-      /*
-       * Move to the next search element. We need to determine the number of
-       * bits in the search offset that are being skipped so the map bits
-       * pointer can be updated. If we are moving down and we have a search
-       * offset of 0 then the search map adjustment is to the top bit of the
-       * pervious search bit's value.
-       *
-       * Align test_bit either up or down depending on the direction to next 32
-       * bit boundary.
-       */
-      rtems_rfs_bitmap_bit bits_skipped;
-      test_bit &= ~((1 << RTEMS_RFS_ELEMENT_BITS_POWER_2) - 1);
-      if (direction > 0)
+      available &= rtems_rfs_bitmap_mask (search_offset + 1);
+      if (!available)
       {
-        bits_skipped = rtems_rfs_bitmap_element_bits () - search_offset;
-        test_bit += bits_skipped * rtems_rfs_bitmap_element_bits ();
-        map_offset = 0;
+        map_index = (search_index * rtems_rfs_bitmap_element_bits ()) - 1;
+        continue;
       }
+      map_index = (search_index * rtems_rfs_bitmap_element_bits ()) +
+        rtems_rfs_bitmap_last_bit (available);
+      if (map_index < end_index)
+        break;
+    }
+
+    /*
+     * Mask the free bits of the element to the part of the window it covers.
+     */
+    available = rtems_rfs_bitmap_free_bits (map[map_index]);
+
+    if (map_index == start_index)
+    {
+      int offset = rtems_rfs_bitmap_map_offset (test_bit);
+      if (direction > 0)
+        available &=
+          rtems_rfs_bitmap_mask_section (offset,
+                                         rtems_rfs_bitmap_element_bits ());
       else
-      {
-        bits_skipped = search_offset + 1;
-        /*
-         * Need to remove 1 for the rounding up. The above rounds down and
-         * adds 1. Remember the logic is for subtraction.
-         */
-        test_bit -= ((bits_skipped - 1) * rtems_rfs_bitmap_element_bits ()) + 1;
-        map_offset = rtems_rfs_bitmap_element_bits () - 1;
-      }
-      map_bits += direction * bits_skipped;
-      map_index += direction * bits_skipped;
+        available &= rtems_rfs_bitmap_mask (offset + 1);
     }
 
-    search_bits  += direction;
-    search_offset = direction > 0 ? 0 : rtems_rfs_bitmap_element_bits () - 1;
+    if (map_index == end_index)
+    {
+      int offset = rtems_rfs_bitmap_map_offset (end_bit);
+      if (direction > 0)
+        available &= rtems_rfs_bitmap_mask (offset + 1);
+      else
+        available &=
+          rtems_rfs_bitmap_mask_section (offset,
+                                         rtems_rfs_bitmap_element_bits ());
+    }
+
+    if (available)
+    {
+      int offset;
+
+      if (direction > 0)
+        offset = rtems_rfs_bitmap_first_bit (available);
+      else
+        offset = rtems_rfs_bitmap_last_bit (available);
+
+      rtems_rfs_bitmap_alloc_bits (control, map, map_index, 1 << offset, 1);
+
+      *bit = (map_index * rtems_rfs_bitmap_element_bits ()) + offset;
+      *found = true;
+      return 0;
+    }
+
+    map_index += direction;
   }
-  while (((direction < 0) && (test_bit >= end_bit))
-         || ((direction > 0) && (test_bit <= end_bit)));
 
   return 0;
 }
@@ -521,6 +566,12 @@ rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
    */
   *allocated = false;
 
+  /*
+   * A seed outside the map does not find a bit.
+   */
+  if ((seed < 0) || (seed >= control->size))
+    return 0;
+
   /*
    * The window is the number of bits we search over in either direction each
    * time.
@@ -581,6 +632,79 @@ rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
   return 0;
 }
 
+int
+rtems_rfs_bitmap_map_alloc_run (rtems_rfs_bitmap_control* control,
+                                rtems_rfs_bitmap_bit      seed,
+                                size_t                    count,
+                                bool*                     allocated,
+                                rtems_rfs_bitmap_bit*     bit,
+                                size_t*                   allocated_count)
+{
+  rtems_rfs_bitmap_map map;
+  rtems_rfs_bitmap_bit next;
+  int                  rc;
+
+  *allocated_count = 0;
+
+  rc = rtems_rfs_bitmap_map_alloc (control, seed, allocated, bit);
+  if ((rc > 0) || !*allocated)
+    return rc;
+
+  *allocated_count = 1;
+
+  rc = rtems_rfs_bitmap_load_map (control, &map);
+  if (rc > 0)
+    return rc;
+
+  /*
+   * Extend the run up from the allocated bit while the bits are clear. The
+   * bits in an element are taken in one go.
+   */
+  next = *bit + 1;
+
+  while ((*allocated_count < count) && (next < control->size))
+  {
+    rtems_rfs_bitmap_element available;
+    size_t                   limit;
+    size_t                   run;
+    int                      index;
+    int                      offset;
+
+    index  = rtems_rfs_bitmap_map_index (next);
+    offset = rtems_rfs_bitmap_map_offset (next);
+
+    available = rtems_rfs_bitmap_free_bits (map[index]) >> offset;
+
+    limit = rtems_rfs_bitmap_element_bits () - offset;
+    if (limit > (count - *allocated_count))
+      limit = count - *allocated_count;
+    if (limit > (control->size - next))
+      limit = control->size - next;
+
+    if (available == RTEMS_RFS_BITMAP_ELEMENT_FULL_MASK)
+      run = rtems_rfs_bitmap_element_bits ();
+    else
+      run = rtems_rfs_bitmap_first_bit (~available);
+
+    if (run > limit)
+      run = limit;
+
+    if (run == 0)
+      break;
+
+    rtems_rfs_bitmap_alloc_bits (control, map, index,
+                                 rtems_rfs_bitmap_mask (run) << offset, run);
+
+    *allocated_count += run;
+    next += run;
+
+    if ((offset + run) < rtems_rfs_bitmap_element_bits ())
+      break;
+  }
+
+  return 0;
+}
+
 int
 rtems_rfs_bitmap_create_search (rtems_rfs_bitmap_control* control)
 {
@@ -618,14 +742,10 @@ rtems_rfs_bitmap_create_search (rtems_rfs_bitmap_control* control)
     }
 
     if (rtems_rfs_bitmap_match (bits, RTEMS_RFS_BITMAP_ELEMENT_SET))
-      rtems_rfs_bitmap_set (*search_map, bit);
+      *search_map = rtems_rfs_bitmap_set (*search_map, 1 << bit);
     else
-    {
-      int b;
-      for (b = 0; b < available; b++)
-        if (!rtems_rfs_bitmap_test (bits, b))
-          control->free++;
-    }
+      control->free +=
+        __builtin_popcount (rtems_rfs_bitmap_free_bits (bits));
 
     size -= available;
 
@@ -634,7 +754,8 @@ rtems_rfs_bitmap_create_search (rtems_rfs_bitmap_control* control)
     {
       bit = 0;
       search_map++;
-      *search_map = RTEMS_RFS_BITMAP_ELEMENT_CLEAR;
+      if (size)
+        *search_map = RTEMS_RFS_BITMAP_ELEMENT_CLEAR;
     }
     else
       bit++;
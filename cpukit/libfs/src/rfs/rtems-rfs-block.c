@@ -402,13 +402,31 @@ rtems_rfs_block_map_indirect_alloc (rtems_rfs_file_system*   fs,
   return 0;
 }
 
+/**
+ * Free a run of blocks allocated by the grow that are not in the map.
+ *
+ * @param fs The file system data.
+ * @param block The first block of the run.
+ * @param count The number of blocks in the run.
+ */
+static void
+rtems_rfs_block_map_free_run (rtems_rfs_file_system* fs,
+                              rtems_rfs_block_no     block,
+                              size_t                 count)
+{
+  while (count--)
+    rtems_rfs_group_bitmap_free (fs, false, block++);
+}
+
 int
 rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                           rtems_rfs_block_map*   map,
                           size_t                 blocks,
                           rtems_rfs_block_no*    new_block)
 {
-  int b;
+  rtems_rfs_bitmap_bit run_block = 0;
+  size_t               run = 0;
+  int                  b;
 
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_BLOCK_MAP_GROW))
     printf ("rtems-rfs: block-map-grow: entry: blocks=%zd count=%" PRIu32 "\n",
@@ -418,8 +436,9 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
     return EFBIG;
 
   /*
-   * Allocate a block at a time. The buffer handles hold the blocks so adding
-   * this way does not thrash the cache with lots of requests.
+   * Allocate the blocks as runs of contiguous blocks and add a block at a time
+   * to the map. The buffer handles hold the blocks so adding this way does not
+   * thrash the cache with lots of requests.
    */
   for (b = 0; b < blocks; b++)
   {
@@ -427,14 +446,21 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
     int                  rc;
 
     /*
-     * Allocate the block. If an indirect block is needed and cannot be
-     * allocated free this block.
+     * Allocate the next run when the current run has been used. If an
+     * indirect block is needed and cannot be allocated free this block and
+     * the rest of the run.
      */
+    if (run == 0)
+    {
+      rc = rtems_rfs_group_bitmap_alloc_blocks (fs, map->last_data_block,
+                                                blocks - b, &run_block, &run);
+      if (rc > 0)
+        return rc;
+    }
 
-    rc = rtems_rfs_group_bitmap_alloc (fs, map->last_data_block,
-                                       false, &block);
-    if (rc > 0)
-      return rc;
+    block = run_block;
+    ++run_block;
+    --run;
 
     if (map->size.count < RTEMS_RFS_INODE_BLOCKS)
       map->blocks[map->size.count] = block;
@@ -478,7 +504,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
 
         if (rc > 0)
         {
-          rtems_rfs_group_bitmap_free (fs, false, block);
+          rtems_rfs_block_map_free_run (fs, block, run + 1);
           return rc;
         }
       }
@@ -507,7 +533,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                                                    false);
           if (rc > 0)
           {
-            rtems_rfs_group_bitmap_free (fs, false, block);
+            rtems_rfs_block_map_free_run (fs, block, run + 1);
             return rc;
           }
 
@@ -527,7 +553,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
             if (rc > 0)
             {
               rtems_rfs_group_bitmap_free (fs, false, singly_block);
-              rtems_rfs_group_bitmap_free (fs, false, block);
+              rtems_rfs_block_map_free_run (fs, block, run + 1);
               return rc;
             }
           }
@@ -538,7 +564,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
             if (rc > 0)
             {
               rtems_rfs_group_bitmap_free (fs, false, singly_block);
-              rtems_rfs_group_bitmap_free (fs, false, block);
+              rtems_rfs_block_map_free_run (fs, block, run + 1);
               return rc;
             }
           }
@@ -555,7 +581,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                                                 true);
           if (rc > 0)
           {
-            rtems_rfs_group_bitmap_free (fs, false, block);
+            rtems_rfs_block_map_free_run (fs, block, run + 1);
             return rc;
           }
 
@@ -566,7 +592,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                                                 singly_block, true);
           if (rc > 0)
           {
-            rtems_rfs_group_bitmap_free (fs, false, block);
+            rtems_rfs_block_map_free_run (fs, block, run + 1);
             return rc;
           }
         }
@@ -75,6 +75,35 @@ rtems_rfs_scan_chain (rtems_chain_control*   chain,
   return NULL;
 }
 
+/**
+ * Check if a block is in flight, that is another task requests the block from
+ * the media. A block in flight has a place holder without references on the
+ * buffers list.
+ *
+ * @param fs The file system data.
+ * @param block The block number to check.
+ * @return bool True if the block is in flight.
+ */
+static bool
+rtems_rfs_buffer_in_flight (rtems_rfs_file_system* fs,
+                            rtems_rfs_buffer_block block)
+{
+  rtems_chain_node* node;
+
+  for (node = rtems_chain_first (&fs->buffers);
+       !rtems_chain_is_tail (&fs->buffers, node);
+       node = rtems_chain_next (node))
+  {
+    rtems_rfs_buffer* buffer = (rtems_rfs_buffer*) node;
+
+    if ((((rtems_rfs_buffer_block) ((intptr_t)(buffer->user))) == block) &&
+        (buffer->references == 0))
+      return true;
+  }
+
+  return false;
+}
+
 int
 rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
                                  rtems_rfs_buffer_handle* handle,
@@ -83,6 +112,8 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
 {
   int rc;
 
+  rtems_rfs_mutex_lock (&fs->buffer_lock);
+
   /*
    * If the handle has a buffer release it. This allows a handle to be reused
    * without needing to close then open it again.
@@ -93,7 +124,10 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
      * Treat block 0 as special to handle the loading of the super block.
      */
     if (block && (rtems_rfs_buffer_bnum (handle) == block))
+    {
+      rtems_rfs_mutex_unlock (&fs->buffer_lock);
       return 0;
+    }
 
     if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
       printf ("rtems-rfs: buffer-request: handle has buffer: %" PRIu32 "\n",
@@ -101,7 +135,10 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
 
     rc = rtems_rfs_buffer_handle_release (fs, handle);
     if (rc > 0)
+    {
+      rtems_rfs_mutex_unlock (&fs->buffer_lock);
       return rc;
+    }
     handle->dirty = false;
     handle->bnum = 0;
   }
@@ -109,6 +146,13 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
     printf ("rtems-rfs: buffer-request: block=%" PRIu32 "\n", block);
 
+  /*
+   * Wait for a block another task requests from the media. The block is then
+   * shared or found in the local cache below.
+   */
+  while (rtems_rfs_buffer_in_flight (fs, block))
+    rtems_rfs_condition_wait (&fs->buffer_arrived, &fs->buffer_lock);
+
   /*
    * First check to see if the buffer has already been requested and is
    * currently attached to a handle. If it is share the access. A buffer could
@@ -165,13 +209,35 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
    */
   if (!rtems_rfs_buffer_handle_has_block (handle))
   {
+    rtems_rfs_buffer in_flight;
+
+    /*
+     * Do not hold the lock while waiting for the media. Metadata blocks such
+     * as the inode blocks are shared by inodes with different inode locks so
+     * another task could request this block meanwhile. The block device would
+     * block the second request until the first buffer is released while the
+     * file system expects to share the buffer. The place holder makes the
+     * other task wait for this request instead.
+     */
+    memset (&in_flight, 0, sizeof (in_flight));
+    in_flight.user = (void*) ((intptr_t) block);
+    rtems_chain_append_unprotected (&fs->buffers, &in_flight.link);
+    fs->buffers_count++;
+
+    rtems_rfs_mutex_unlock (&fs->buffer_lock);
     rc = rtems_rfs_buffer_io_request (fs, block, read, &handle->buffer);
+    rtems_rfs_mutex_lock (&fs->buffer_lock);
+
+    rtems_chain_extract_unprotected (&in_flight.link);
+    fs->buffers_count--;
+    rtems_rfs_condition_broadcast (&fs->buffer_arrived);
 
     if (rc > 0)
     {
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
         printf ("rtems-rfs: buffer-request: block=%" PRIu32 ": bdbuf-%s: %d: %s\n",
                 block, read ? "read" : "get", rc, strerror (rc));
+      rtems_rfs_mutex_unlock (&fs->buffer_lock);
       return rc;
     }
 
@@ -194,6 +260,8 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
             block, read ? "read" : "get", handle->buffer->block,
             handle->buffer->references);
 
+  rtems_rfs_mutex_unlock (&fs->buffer_lock);
+
   return 0;
 }
 
@@ -205,6 +273,8 @@ rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
 
   if (rtems_rfs_buffer_handle_has_block (handle))
   {
+    rtems_rfs_mutex_lock (&fs->buffer_lock);
+
     if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_RELEASE))
       printf ("rtems-rfs: buffer-release: block=%" PRIu32 " %s refs=%d %s\n",
               rtems_rfs_buffer_bnum (handle),
@@ -280,11 +350,93 @@ rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
       }
     }
     handle->buffer = NULL;
+
+    rtems_rfs_mutex_unlock (&fs->buffer_lock);
   }
 
   return rc;
 }
 
+int
+rtems_rfs_buffer_direct (rtems_rfs_file_system* fs,
+                         rtems_rfs_buffer_block block,
+                         size_t                 count,
+                         void*                  data,
+                         bool                   read)
+{
+  size_t b;
+  int    rc;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
+    printf ("rtems-rfs: buffer-direct: block=%" PRIu32 " count=%zu %s\n",
+            block, count, read ? "read" : "write");
+
+  rtems_rfs_mutex_lock (&fs->buffer_lock);
+
+  for (b = 0; b < count; ++b)
+  {
+    rtems_chain_node* node;
+    rtems_rfs_buffer* buffer;
+
+    /*
+     * A buffer attached to a handle is in use and cannot be bypassed.
+     */
+    for (node = rtems_chain_first (&fs->buffers);
+         !rtems_chain_is_tail (&fs->buffers, node);
+         node = rtems_chain_next (node))
+    {
+      buffer = (rtems_rfs_buffer*) node;
+      if (((rtems_rfs_buffer_block) ((intptr_t)(buffer->user))) == block + b)
+      {
+        rtems_rfs_mutex_unlock (&fs->buffer_lock);
+        return EBUSY;
+      }
+    }
+
+    /*
+     * Hand the buffers held in the local cache back so the cache can sync or
+     * discard them.
+     */
+    if (fs->release_count)
+    {
+      buffer = rtems_rfs_scan_chain (&fs->release,
+                                     &fs->release_count,
+                                     block + b);
+      if (buffer)
+      {
+        buffer->user = (void*) 0;
+        rc = rtems_rfs_buffer_io_release (buffer, false);
+        if (rc > 0)
+        {
+          rtems_rfs_mutex_unlock (&fs->buffer_lock);
+          return rc;
+        }
+      }
+    }
+
+    if (fs->release_modified_count)
+    {
+      buffer = rtems_rfs_scan_chain (&fs->release_modified,
+                                     &fs->release_modified_count,
+                                     block + b);
+      if (buffer)
+      {
+        buffer->user = (void*) 0;
+        rc = rtems_rfs_buffer_io_release (buffer, true);
+        if (rc > 0)
+        {
+          rtems_rfs_mutex_unlock (&fs->buffer_lock);
+          return rc;
+        }
+      }
+    }
+  }
+
+  rtems_rfs_mutex_unlock (&fs->buffer_lock);
+
+  return rtems_rfs_buffer_io_direct (fs, block, count, data, read);
+}
+
 int
 rtems_rfs_buffer_open (const char* name, rtems_rfs_file_system* fs)
 {
@@ -343,6 +495,9 @@ rtems_rfs_buffer_open (const char* name, rtems_rfs_file_system* fs)
             rtems_rfs_fs_media_blocks (fs),
             rtems_rfs_fs_media_block_size (fs));
 
+  rtems_rfs_mutex_create (&fs->buffer_lock);
+  rtems_rfs_condition_create (&fs->buffer_arrived);
+
   return 0;
 }
 
@@ -372,6 +527,9 @@ rtems_rfs_buffer_close (rtems_rfs_file_system* fs)
               rc, strerror (rc));
   }
 
+  rtems_rfs_condition_destroy (&fs->buffer_arrived);
+  rtems_rfs_mutex_destroy (&fs->buffer_lock);
+
   return rc;
 }
 
@@ -473,6 +631,8 @@ rtems_rfs_buffers_release (rtems_rfs_file_system* fs)
             "release:%" PRIu32 " release-modified:%" PRIu32 "\n",
             fs->buffers_count, fs->release_count, fs->release_modified_count);
 
+  rtems_rfs_mutex_lock (&fs->buffer_lock);
+
   rc = rtems_rfs_release_chain (&fs->release,
                                 &fs->release_count,
                                 false);
@@ -484,5 +644,7 @@ rtems_rfs_buffers_release (rtems_rfs_file_system* fs)
   if ((rc > 0) && (rrc == 0))
     rrc = rc;
 
+  rtems_rfs_mutex_unlock (&fs->buffer_lock);
+
   return rrc;
 }
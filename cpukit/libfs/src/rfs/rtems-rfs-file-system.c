@@ -233,6 +233,8 @@ rtems_rfs_fs_open (const char*             name,
   (*fs)->release_modified_count = 0;
   (*fs)->flags = flags;
 
+  rtems_rfs_mutex_create (&(*fs)->bitmap_lock);
+
 #if UNUSED
   group = &(*fs)->groups[0];
   group_base = 0;
@@ -244,6 +246,7 @@ rtems_rfs_fs_open (const char*             name,
   rc = rtems_rfs_buffer_open (name, *fs);
   if (rc > 0)
   {
+    rtems_rfs_mutex_destroy (&(*fs)->bitmap_lock);
     free (*fs);
     if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
       printf ("rtems-rfs: open: buffer open failed: %d: %s\n",
@@ -256,6 +259,7 @@ rtems_rfs_fs_open (const char*             name,
   if (rc > 0)
   {
     rtems_rfs_buffer_close (*fs);
+    rtems_rfs_mutex_destroy (&(*fs)->bitmap_lock);
     free (*fs);
     if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
       printf ("rtems-rfs: open: reading superblock: %d: %s\n",
@@ -268,6 +272,7 @@ rtems_rfs_fs_open (const char*             name,
   if (rc > 0)
   {
     rtems_rfs_buffer_close (*fs);
+    rtems_rfs_mutex_destroy (&(*fs)->bitmap_lock);
     free (*fs);
     if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
       printf ("rtems-rfs: open: reading root inode: %d: %s\n",
@@ -284,6 +289,7 @@ rtems_rfs_fs_open (const char*             name,
     {
       rtems_rfs_inode_close (*fs, &inode);
       rtems_rfs_buffer_close (*fs);
+      rtems_rfs_mutex_destroy (&(*fs)->bitmap_lock);
       free (*fs);
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
         printf ("rtems-rfs: open: invalid root inode mode\n");
@@ -296,6 +302,7 @@ rtems_rfs_fs_open (const char*             name,
   if (rc > 0)
   {
     rtems_rfs_buffer_close (*fs);
+    rtems_rfs_mutex_destroy (&(*fs)->bitmap_lock);
     free (*fs);
     if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
       printf ("rtems-rfs: open: closing root inode: %d: %s\n", rc, strerror (rc));
@@ -319,6 +326,8 @@ rtems_rfs_fs_close (rtems_rfs_file_system* fs)
 
   rtems_rfs_buffer_close (fs);
 
+  rtems_rfs_mutex_destroy (&fs->bitmap_lock);
+
   free (fs);
   return 0;
 }
@@ -117,6 +117,17 @@ rtems_rfs_file_open (rtems_rfs_file_system*  fs,
       return rc;
     }
 
+    rc = rtems_rfs_mutex_create (&shared->lock);
+    if (rc > 0)
+    {
+      rtems_rfs_block_map_close (fs, &shared->map);
+      rtems_rfs_inode_close (fs, &shared->inode);
+      free (shared);
+      rtems_rfs_buffer_handle_close (fs, &handle->buffer);
+      free (handle);
+      return rc;
+    }
+
     shared->references = 1;
     shared->size.count = rtems_rfs_inode_get_block_count (&shared->inode);
     shared->size.offset = rtems_rfs_inode_get_block_offset (&shared->inode);
@@ -200,6 +211,7 @@ rtems_rfs_file_close (rtems_rfs_file_system* fs,
     }
 
     rtems_chain_extract_unprotected (&handle->shared->link);
+    rtems_rfs_mutex_destroy (&handle->shared->lock);
     free (handle->shared);
   }
 
@@ -306,6 +318,167 @@ rtems_rfs_file_io_start (rtems_rfs_file_handle* handle,
   return 0;
 }
 
+/**
+ * Release the blocks a direct write added to the map beyond the end of the
+ * blocks it transferred. They hold no data and would otherwise extend the
+ * file. The size offset of the map is restored if the map is back to the
+ * count of blocks it had before the write.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] map is the block map of the file.
+ * @param[in] end is the count of blocks to keep.
+ * @param[in] size is the size of the map before the write.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+static int
+rtems_rfs_file_io_direct_release (rtems_rfs_file_system*      fs,
+                                  rtems_rfs_block_map*        map,
+                                  rtems_rfs_block_no          end,
+                                  const rtems_rfs_block_size* size)
+{
+  int rc;
+
+  if (end < size->count)
+    end = size->count;
+
+  if (rtems_rfs_block_map_count (map) <= end)
+    return 0;
+
+  rc = rtems_rfs_block_map_shrink (fs, map,
+                                   rtems_rfs_block_map_count (map) - end);
+  if (rc > 0)
+    return rc;
+
+  if (rtems_rfs_block_map_count (map) == size->count)
+    rtems_rfs_block_map_set_size_offset (map, size->offset);
+
+  return 0;
+}
+
+int
+rtems_rfs_file_io_direct (rtems_rfs_file_handle* handle,
+                          void*                  data,
+                          size_t*                size,
+                          bool                   read)
+{
+  rtems_rfs_file_system* fs = rtems_rfs_file_fs (handle);
+  rtems_rfs_block_map*   map = rtems_rfs_file_map (handle);
+  size_t                 block_size = rtems_rfs_fs_block_size (fs);
+  size_t                 max_blocks = *size / block_size;
+  size_t                 blocks = 0;
+  rtems_rfs_buffer_block start = 0;
+  rtems_rfs_block_pos    bpos;
+  rtems_rfs_block_size   map_size;
+  bool                   grown = false;
+  int                    rc;
+
+  /*
+   * Unaligned buffers, positions within a block and transfers of less than a
+   * block use the cache. The caller does the rest of a transfer which is not
+   * a multiple of the block size through the cache.
+   */
+  if ((fs->direct_io_threshold == 0) ||
+      (*size < fs->direct_io_threshold) ||
+      (max_blocks == 0) ||
+      !rtems_rfs_buffer_io_direct_aligned (data) ||
+      rtems_rfs_file_block_offset (handle) ||
+      rtems_rfs_buffer_handle_has_block (&handle->buffer))
+  {
+    *size = 0;
+    return 0;
+  }
+
+  /*
+   * Collect the run of consecutive blocks from the current position. A read
+   * stops before a partial last block and a write grows the file as needed.
+   */
+  rtems_rfs_block_copy_bpos (&bpos, rtems_rfs_file_bpos (handle));
+  bpos.block = 0;
+  rtems_rfs_block_copy_size (&map_size, rtems_rfs_block_map_size (map));
+
+  while (blocks < max_blocks)
+  {
+    rtems_rfs_buffer_block block;
+
+    if (read
+        && rtems_rfs_block_pos_last_block (&bpos, rtems_rfs_block_map_size (map))
+        && rtems_rfs_block_map_size_offset (map))
+      break;
+
+    rc = rtems_rfs_block_map_find (fs, map, &bpos, &block);
+    if (rc > 0)
+    {
+      if (read && (rc == ENXIO))
+        break;
+
+      if (rc != ENXIO)
+        return rc;
+
+      /*
+       * Grow the map by the rest of the blocks being written so they are
+       * allocated as a contiguous run. The grown blocks which do not end up
+       * in this run are released below.
+       */
+      grown = true;
+      rc = rtems_rfs_block_map_grow (fs, map, max_blocks - blocks, &block);
+      if (rc > 0)
+      {
+        if (blocks == 0)
+        {
+          rtems_rfs_file_io_direct_release (fs, map, 0, &map_size);
+          return rc;
+        }
+        break;
+      }
+    }
+
+    if (blocks == 0)
+      start = block;
+    else if (block != start + blocks)
+      break;
+
+    ++blocks;
+    ++bpos.bno;
+  }
+
+  if (grown)
+  {
+    rc = rtems_rfs_file_io_direct_release (fs, map, bpos.bno, &map_size);
+    if (rc > 0)
+      return rc;
+  }
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_FILE_IO))
+    printf ("rtems-rfs: file-io: direct: %s pos=%" PRIu32 " block=%" PRIu32
+            " blocks=%zu\n", read ? "read" : "write",
+            handle->bpos.bno, start, blocks);
+
+  *size = 0;
+
+  if (blocks == 0)
+    return 0;
+
+  rc = rtems_rfs_buffer_direct (fs, start, blocks, data, read);
+  if (rc > 0)
+  {
+    /*
+     * Nothing was transferred, so release the blocks grown for the transfer.
+     * If a buffer handle holds a block of the run use the cache.
+     */
+    if (grown)
+      rtems_rfs_file_io_direct_release (fs, map, 0, &map_size);
+    if (rc == EBUSY)
+      return 0;
+    return rc;
+  }
+
+  *size = blocks * block_size;
+
+  return 0;
+}
+
 int
 rtems_rfs_file_io_end (rtems_rfs_file_handle* handle,
                        size_t                 size,
@@ -337,9 +510,9 @@ rtems_rfs_file_io_end (rtems_rfs_file_handle* handle,
   }
 
   /*
-   * Update the handle's position. Only a block size can be handled at a time
-   * so no special maths is needed. If the offset is bigger than the block size
-   * increase the block number and adjust the offset.
+   * Update the handle's position. If the offset is bigger than the block size
+   * increase the block number and adjust the offset. A direct I/O can span
+   * several blocks.
    *
    * If we are the last block and the position is past the current size update
    * the size with the new length. The map holds the block count.
@@ -349,8 +522,9 @@ rtems_rfs_file_io_end (rtems_rfs_file_handle* handle,
   if (handle->bpos.boff >=
       rtems_rfs_fs_block_size (rtems_rfs_file_fs (handle)))
   {
-    handle->bpos.bno++;
-    handle->bpos.boff -= rtems_rfs_fs_block_size (rtems_rfs_file_fs (handle));
+    handle->bpos.bno +=
+      handle->bpos.boff / rtems_rfs_fs_block_size (rtems_rfs_file_fs (handle));
+    handle->bpos.boff %= rtems_rfs_fs_block_size (rtems_rfs_file_fs (handle));
   }
 
   length = false;
@@ -149,11 +149,13 @@ rtems_rfs_group_close (rtems_rfs_file_system* fs, rtems_rfs_group* group)
   return result;
 }
 
-int
-rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
-                              rtems_rfs_bitmap_bit   goal,
-                              bool                   inode,
-                              rtems_rfs_bitmap_bit*  result)
+static int
+rtems_rfs_group_bitmap_search (rtems_rfs_file_system* fs,
+                               rtems_rfs_bitmap_bit   goal,
+                               bool                   inode,
+                               size_t                 count,
+                               rtems_rfs_bitmap_bit*  result,
+                               size_t*                run)
 {
   int                  group_start;
   size_t               size;
@@ -224,7 +226,8 @@ rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
     else
       bitmap = &fs->groups[group].block_bitmap;
 
-    rc = rtems_rfs_bitmap_map_alloc (bitmap, bit, &allocated, &bit);
+    rc = rtems_rfs_bitmap_map_alloc_run (bitmap, bit, count,
+                                         &allocated, &bit, run);
     if (rc > 0)
       return rc;
 
@@ -238,8 +241,8 @@ rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
       else
         *result = rtems_rfs_group_block (&fs->groups[group], bit);
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_GROUP_BITMAPS))
-        printf ("rtems-rfs: group-bitmap-alloc: %s allocated: %" PRId32 "\n",
-                inode ? "inode" : "block", *result);
+        printf ("rtems-rfs: group-bitmap-alloc: %s allocated: %" PRId32
+                " (%zu)\n", inode ? "inode" : "block", *result, *run);
       return 0;
     }
 
@@ -269,6 +272,39 @@ rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
   return ENOSPC;
 }
 
+int
+rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
+                              rtems_rfs_bitmap_bit   goal,
+                              bool                   inode,
+                              rtems_rfs_bitmap_bit*  result)
+{
+  size_t run;
+  int    rc;
+
+  rtems_rfs_mutex_lock (&fs->bitmap_lock);
+  rc = rtems_rfs_group_bitmap_search (fs, goal, inode, 1, result, &run);
+  rtems_rfs_mutex_unlock (&fs->bitmap_lock);
+
+  return rc;
+}
+
+int
+rtems_rfs_group_bitmap_alloc_blocks (rtems_rfs_file_system* fs,
+                                     rtems_rfs_bitmap_bit   goal,
+                                     size_t                 count,
+                                     rtems_rfs_bitmap_bit*  result,
+                                     size_t*                allocated)
+{
+  int rc;
+
+  rtems_rfs_mutex_lock (&fs->bitmap_lock);
+  rc = rtems_rfs_group_bitmap_search (fs, goal, false, count, result,
+                                      allocated);
+  rtems_rfs_mutex_unlock (&fs->bitmap_lock);
+
+  return rc;
+}
+
 int
 rtems_rfs_group_bitmap_free (rtems_rfs_file_system* fs,
                              bool                   inode,
@@ -303,10 +339,14 @@ rtems_rfs_group_bitmap_free (rtems_rfs_file_system* fs,
   else
     bitmap = &fs->groups[group].block_bitmap;
 
+  rtems_rfs_mutex_lock (&fs->bitmap_lock);
+
   rc = rtems_rfs_bitmap_map_clear (bitmap, bit);
 
   rtems_rfs_bitmap_release_buffer (fs, bitmap);
 
+  rtems_rfs_mutex_unlock (&fs->bitmap_lock);
+
   return rc;
 }
 
@@ -349,10 +389,14 @@ rtems_rfs_group_bitmap_test (rtems_rfs_file_system* fs,
   else
     bitmap = &fs->groups[group].block_bitmap;
 
+  rtems_rfs_mutex_lock (&fs->bitmap_lock);
+
   rc = rtems_rfs_bitmap_map_test (bitmap, bit, state);
 
   rtems_rfs_bitmap_release_buffer (fs, bitmap);
 
+  rtems_rfs_mutex_unlock (&fs->bitmap_lock);
+
   return rc;
 }
 
@@ -366,6 +410,8 @@ rtems_rfs_group_usage (rtems_rfs_file_system* fs,
   *blocks = 0;
   *inodes = 0;
 
+  rtems_rfs_mutex_lock (&fs->bitmap_lock);
+
   for (g = 0; g < fs->group_count; g++)
   {
     rtems_rfs_group* group = &fs->groups[g];
@@ -377,6 +423,8 @@ rtems_rfs_group_usage (rtems_rfs_file_system* fs,
       rtems_rfs_bitmap_map_free (&group->inode_bitmap);
   }
 
+  rtems_rfs_mutex_unlock (&fs->bitmap_lock);
+
   if (*blocks > rtems_rfs_fs_blocks (fs))
     *blocks = rtems_rfs_fs_blocks (fs);
   if (*inodes > rtems_rfs_fs_inodes (fs))
@@ -36,3 +36,136 @@ rtems_rfs_mutex_destroy (rtems_rfs_mutex* mutex)
 #endif
   return 0;
 }
+
+int
+rtems_rfs_condition_create (rtems_rfs_condition* condition)
+{
+#if __rtems__
+  rtems_condition_variable_init (condition, "RFS");
+#endif
+  return 0;
+}
+
+int
+rtems_rfs_condition_destroy (rtems_rfs_condition* condition)
+{
+#if __rtems__
+  rtems_condition_variable_destroy (condition);
+#endif
+  return 0;
+}
+
+int
+rtems_rfs_rwlock_create (rtems_rfs_rwlock* rwlock)
+{
+#if __rtems__
+  rtems_mutex_init (&rwlock->mutex, "RFS");
+  rtems_condition_variable_init (&rwlock->changed, "RFS");
+  rwlock->readers = 0;
+  rwlock->writers_waiting = 0;
+  rwlock->writer_nest = 0;
+  rwlock->writer = 0;
+#endif
+  return 0;
+}
+
+int
+rtems_rfs_rwlock_destroy (rtems_rfs_rwlock* rwlock)
+{
+#if __rtems__
+  rtems_condition_variable_destroy (&rwlock->changed);
+  rtems_mutex_destroy (&rwlock->mutex);
+#endif
+  return 0;
+}
+
+int
+rtems_rfs_rwlock_lock (rtems_rfs_rwlock* rwlock)
+{
+#if __rtems__
+  rtems_id self = rtems_task_self ();
+
+  rtems_mutex_lock (&rwlock->mutex);
+
+  if ((rwlock->writer_nest == 0) || (rwlock->writer != self))
+  {
+    ++rwlock->writers_waiting;
+    while ((rwlock->writer_nest > 0) || (rwlock->readers > 0))
+      rtems_condition_variable_wait (&rwlock->changed, &rwlock->mutex);
+    --rwlock->writers_waiting;
+    rwlock->writer = self;
+  }
+
+  ++rwlock->writer_nest;
+
+  rtems_mutex_unlock (&rwlock->mutex);
+#endif
+  return 0;
+}
+
+int
+rtems_rfs_rwlock_unlock (rtems_rfs_rwlock* rwlock)
+{
+#if __rtems__
+  rtems_mutex_lock (&rwlock->mutex);
+
+  --rwlock->writer_nest;
+  if (rwlock->writer_nest == 0)
+  {
+    rwlock->writer = 0;
+    rtems_condition_variable_broadcast (&rwlock->changed);
+  }
+
+  rtems_mutex_unlock (&rwlock->mutex);
+#endif
+  return 0;
+}
+
+int
+rtems_rfs_rwlock_lock_shared (rtems_rfs_rwlock* rwlock)
+{
+#if __rtems__
+  rtems_id self = rtems_task_self ();
+
+  rtems_mutex_lock (&rwlock->mutex);
+
+  /*
+   * The exclusive owner nests the lock.
+   */
+  if ((rwlock->writer_nest > 0) && (rwlock->writer == self))
+    ++rwlock->writer_nest;
+  else
+  {
+    while ((rwlock->writer_nest > 0) || (rwlock->writers_waiting > 0))
+      rtems_condition_variable_wait (&rwlock->changed, &rwlock->mutex);
+    ++rwlock->readers;
+  }
+
+  rtems_mutex_unlock (&rwlock->mutex);
+#endif
+  return 0;
+}
+
+int
+rtems_rfs_rwlock_unlock_shared (rtems_rfs_rwlock* rwlock)
+{
+#if __rtems__
+  rtems_id self = rtems_task_self ();
+
+  rtems_mutex_lock (&rwlock->mutex);
+
+  if ((rwlock->writer_nest > 0) && (rwlock->writer == self))
+    --rwlock->writer_nest;
+  else
+    --rwlock->readers;
+
+  if ((rwlock->writer_nest == 0) && (rwlock->readers == 0))
+  {
+    rwlock->writer = 0;
+    rtems_condition_variable_broadcast (&rwlock->changed);
+  }
+
+  rtems_mutex_unlock (&rwlock->mutex);
+#endif
+  return 0;
+}
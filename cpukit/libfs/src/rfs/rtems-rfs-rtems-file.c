@@ -28,6 +28,28 @@
 #include <rtems/rfs/rtems-rfs-file.h>
 #include "rtems-rfs-rtems.h"
 
+/**
+ * Lock the file for data I/O. The file system is locked shared so I/O to
+ * other files can proceed in parallel and the file's inode is locked to
+ * serialise access to the file's data and block map.
+ */
+static void
+rtems_rfs_rtems_file_lock (rtems_rfs_file_handle* file)
+{
+  rtems_rfs_rtems_lock_shared (rtems_rfs_file_fs (file));
+  rtems_rfs_mutex_lock (&file->shared->lock);
+}
+
+/**
+ * Unlock the file locked for data I/O.
+ */
+static void
+rtems_rfs_rtems_file_unlock (rtems_rfs_file_handle* file)
+{
+  rtems_rfs_mutex_unlock (&file->shared->lock);
+  rtems_rfs_rtems_unlock_shared (rtems_rfs_file_fs (file));
+}
+
 /**
  * This routine processes the open() system call.  Note that there is nothing
  * special to be done at open() time.
@@ -120,7 +142,7 @@ rtems_rfs_rtems_file_read (rtems_libio_t* iop,
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_READ))
     printf("rtems-rfs: file-read: handle:%p count:%zd\n", file, count);
 
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_lock (file);
 
   pos = iop->offset;
 
@@ -128,22 +150,32 @@ rtems_rfs_rtems_file_read (rtems_libio_t* iop,
   {
     while (count)
     {
-      size_t size;
+      size_t size = count;
 
-      rc = rtems_rfs_file_io_start (file, &size, true);
+      rc = rtems_rfs_file_io_direct (file, data, &size, true);
       if (rc > 0)
       {
-        read = rtems_rfs_rtems_error ("file-read: read: io-start", rc);
+        read = rtems_rfs_rtems_error ("file-read: read: io-direct", rc);
         break;
       }
 
       if (size == 0)
-        break;
+      {
+        rc = rtems_rfs_file_io_start (file, &size, true);
+        if (rc > 0)
+        {
+          read = rtems_rfs_rtems_error ("file-read: read: io-start", rc);
+          break;
+        }
 
-      if (size > count)
-        size = count;
+        if (size == 0)
+          break;
 
-      memcpy (data, rtems_rfs_file_data (file), size);
+        if (size > count)
+          size = count;
+
+        memcpy (data, rtems_rfs_file_data (file), size);
+      }
 
       data  += size;
       count -= size;
@@ -161,7 +193,7 @@ rtems_rfs_rtems_file_read (rtems_libio_t* iop,
   if (read >= 0)
     iop->offset = pos + read;
 
-  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_unlock (file);
 
   return read;
 }
@@ -189,7 +221,7 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_WRITE))
     printf("rtems-rfs: file-write: handle:%p count:%zd\n", file, count);
 
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_lock (file);
 
   pos = iop->offset;
   file_size = rtems_rfs_file_size (file);
@@ -203,7 +235,7 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
     rc = rtems_rfs_file_set_size (file, pos);
     if (rc)
     {
-      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+      rtems_rfs_rtems_file_unlock (file);
       return rtems_rfs_rtems_error ("file-write: write extend", rc);
     }
 
@@ -215,7 +247,7 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
     rc = rtems_rfs_file_seek (file, pos, &pos);
     if (rc)
     {
-      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+      rtems_rfs_rtems_file_unlock (file);
       return rtems_rfs_rtems_error ("file-write: write append seek", rc);
     }
   }
@@ -224,7 +256,20 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
   {
     size_t size = count;
 
-    rc = rtems_rfs_file_io_start (file, &size, false);
+    rc = rtems_rfs_file_io_direct (file, RTEMS_DECONST (uint8_t*, data),
+                                   &size, false);
+    if (rc == 0 && size == 0)
+    {
+      size = count;
+      rc = rtems_rfs_file_io_start (file, &size, false);
+      if (rc == 0)
+      {
+        if (size > count)
+          size = count;
+
+        memcpy (rtems_rfs_file_data (file), data, size);
+      }
+    }
     if (rc)
     {
       /*
@@ -237,11 +282,6 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
       break;
     }
 
-    if (size > count)
-      size = count;
-
-    memcpy (rtems_rfs_file_data (file), data, size);
-
     data  += size;
     count -= size;
     write  += size;
@@ -257,7 +297,7 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
   if (write >= 0)
     iop->offset = pos + write;
 
-  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_unlock (file);
 
   return write;
 }
@@ -282,7 +322,7 @@ rtems_rfs_rtems_file_lseek (rtems_libio_t* iop,
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_LSEEK))
     printf("rtems-rfs: file-lseek: handle:%p offset:%" PRIdoff_t "\n", file, offset);
 
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_lock (file);
 
   old_offset = iop->offset;
   new_offset = rtems_filesystem_default_lseek_file (iop, offset, whence);
@@ -299,7 +339,7 @@ rtems_rfs_rtems_file_lseek (rtems_libio_t* iop,
     }
   }
 
-  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_unlock (file);
 
   return new_offset;
 }
@@ -321,13 +361,13 @@ rtems_rfs_rtems_file_ftruncate (rtems_libio_t* iop,
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_FTRUNC))
     printf("rtems-rfs: file-ftrunc: handle:%p length:%" PRIdoff_t "\n", file, length);
 
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_lock (file);
 
   rc = rtems_rfs_file_set_size (file, length);
   if (rc)
     rc = rtems_rfs_rtems_error ("file_ftruncate: set size", rc);
 
-  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_unlock (file);
 
   return rc;
 }
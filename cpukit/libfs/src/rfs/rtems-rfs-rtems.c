@@ -754,6 +754,7 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
   rtems_rfs_file_system*   fs;
   uint32_t                 flags = 0;
   uint32_t                 max_held_buffers = RTEMS_RFS_FS_MAX_HELD_BUFFERS;
+  size_t                   direct_io_threshold = 0;
   const char*              options = data;
   int                      rc;
 
@@ -774,6 +775,11 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
     {
       max_held_buffers = strtoul (options + sizeof ("max-held-bufs"), 0, 0);
     }
+    else if (strncmp (options, "direct-io",
+                      sizeof ("direct-io") - 1) == 0)
+    {
+      direct_io_threshold = strtoul (options + sizeof ("direct-io"), 0, 0);
+    }
     else
       return rtems_rfs_rtems_error ("initialise: invalid option", EINVAL);
 
@@ -792,17 +798,17 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
 
   memset (rtems, 0, sizeof (rtems_rfs_rtems_private));
 
-  rc = rtems_rfs_mutex_create (&rtems->access);
+  rc = rtems_rfs_rwlock_create (&rtems->access);
   if (rc > 0)
   {
     free (rtems);
     return rtems_rfs_rtems_error ("initialise: cannot create mutex", rc);
   }
 
-  rc = rtems_rfs_mutex_lock (&rtems->access);
+  rc = rtems_rfs_rwlock_lock (&rtems->access);
   if (rc > 0)
   {
-    rtems_rfs_mutex_destroy (&rtems->access);
+    rtems_rfs_rwlock_destroy (&rtems->access);
     free (rtems);
     return rtems_rfs_rtems_error ("initialise: cannot lock access  mutex", rc);
   }
@@ -810,12 +816,14 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
   rc = rtems_rfs_fs_open (mt_entry->dev, rtems, flags, max_held_buffers, &fs);
   if (rc)
   {
-    rtems_rfs_mutex_unlock (&rtems->access);
-    rtems_rfs_mutex_destroy (&rtems->access);
+    rtems_rfs_rwlock_unlock (&rtems->access);
+    rtems_rfs_rwlock_destroy (&rtems->access);
     free (rtems);
     return rtems_rfs_rtems_error ("initialise: open", errno);
   }
 
+  fs->direct_io_threshold = direct_io_threshold;
+
   mt_entry->fs_info                          = fs;
   mt_entry->ops                              = &rtems_rfs_ops;
   mt_entry->mt_fs_root->location.node_access = (void*) RTEMS_RFS_ROOT_INO;
@@ -840,6 +848,6 @@ rtems_rfs_rtems_shutdown (rtems_filesystem_mount_table_entry_t* mt_entry)
   /* FIXME: Return value? */
   rtems_rfs_fs_close(fs);
 
-  rtems_rfs_mutex_destroy (&rtems->access);
+  rtems_rfs_rwlock_destroy (&rtems->access);
   free (rtems);
 }
@@ -143,9 +143,11 @@ int rtems_rfs_rtems_trace_shell_command (int argc, char *argv[]);
 typedef struct rtems_rfs_rtems_private
 {
   /**
-   * The access lock.
+   * The access lock. Operations on the file system metadata hold the lock
+   * exclusively. File data I/O holds the lock shared together with the lock
+   * of the file's inode.
    */
-  rtems_rfs_mutex access;
+  rtems_rfs_rwlock access;
 } rtems_rfs_rtems_private;
 /**
  * Return the file system structure given a path location.
@@ -264,7 +266,7 @@ static inline void
  rtems_rfs_rtems_lock (rtems_rfs_file_system* fs)
 {
   rtems_rfs_rtems_private* rtems = rtems_rfs_fs_user (fs);
-  rtems_rfs_mutex_lock (&rtems->access);
+  rtems_rfs_rwlock_lock (&rtems->access);
 }
 
 /**
@@ -275,7 +277,29 @@ static inline void
 {
   rtems_rfs_rtems_private* rtems = rtems_rfs_fs_user (fs);
   rtems_rfs_buffers_release (fs);
-  rtems_rfs_mutex_unlock (&rtems->access);
+  rtems_rfs_rwlock_unlock (&rtems->access);
+}
+
+/**
+ * Lock the RFS file system shared. Only file data I/O may be performed with
+ * the shared lock and the file's inode lock held.
+ */
+static inline void
+ rtems_rfs_rtems_lock_shared (rtems_rfs_file_system* fs)
+{
+  rtems_rfs_rtems_private* rtems = rtems_rfs_fs_user (fs);
+  rtems_rfs_rwlock_lock_shared (&rtems->access);
+}
+
+/**
+ * Unlock the shared locked RFS file system.
+ */
+static inline void
+ rtems_rfs_rtems_unlock_shared (rtems_rfs_file_system* fs)
+{
+  rtems_rfs_rtems_private* rtems = rtems_rfs_fs_user (fs);
+  rtems_rfs_buffers_release (fs);
+  rtems_rfs_rwlock_unlock_shared (&rtems->access);
 }
 
 /**
@@ -55,13 +55,20 @@
 #define RTEMS_CAPTURE_RECORD_EVENTS  (0)
 #endif
 
+/*
+ * The records and count are written by the CPU owning the data with
+ * interrupts masked. The reader only moves the buffer's tail and the released
+ * count. The lock and flags serialize the readers. Each CPU's data is on its
+ * own cache lines so recording does not disturb the other CPUs.
+ */
 typedef struct {
   rtems_capture_buffer records;
-  uint32_t             count;
+  Atomic_Uint          count;
+  uint32_t             released;
   rtems_id             reader;
   rtems_interrupt_lock lock;
   uint32_t             flags;
-} rtems_capture_per_cpu_data;
+} RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES) rtems_capture_per_cpu_data;
 
 typedef struct {
   uint32_t                flags;
@@ -87,6 +94,7 @@ static rtems_capture_global_data capture_global = {
 
 #define capture_records_on_cpu( _cpu ) capture_per_cpu[ _cpu ].records
 #define capture_count_on_cpu( _cpu )   capture_per_cpu[ _cpu ].count
+#define capture_released_on_cpu( _cpu ) capture_per_cpu[ _cpu ].released
 #define capture_flags_on_cpu( _cpu )   capture_per_cpu[ _cpu ].flags
 #define capture_reader_on_cpu( _cpu )  capture_per_cpu[ _cpu ].reader
 #define capture_lock_on_cpu( _cpu )    capture_per_cpu[ _cpu ].lock
@@ -275,6 +283,37 @@ rtems_capture_find_control (rtems_name name, rtems_id id)
   return control;
 }
 
+/*
+ * This function precomputes the watch part of the filter for a task. It
+ * depends on the global watch and the task's control and is updated when
+ * they change so the filter does not look at the control of a task each
+ * time it records an event. The priority part of the filter is checked when
+ * recording as the priority of a task can change at any time.
+ */
+static void
+rtems_capture_update_watched (rtems_tcb* tcb)
+{
+  rtems_capture_control* control = tcb->Capture.control;
+
+  if ((capture_flags_global & RTEMS_CAPTURE_GLOBAL_WATCH) ||
+      (control && (control->flags & RTEMS_CAPTURE_WATCH)))
+    tcb->Capture.flags |= RTEMS_CAPTURE_WATCHED;
+  else
+    tcb->Capture.flags &= ~RTEMS_CAPTURE_WATCHED;
+}
+
+static bool
+rtems_capture_update_watched_tcb (rtems_tcb *tcb, void *arg)
+{
+  rtems_capture_control* deleted = arg;
+
+  if (deleted != NULL && tcb->Capture.control == deleted)
+    tcb->Capture.control = NULL;
+
+  rtems_capture_update_watched (tcb);
+  return false;
+}
+
 /*
  * This function checks if a new control structure matches
  * the given task and sets the control if it does.
@@ -306,6 +345,8 @@ rtems_capture_initialize_control (rtems_tcb *tcb, void *arg)
     }
   }
 
+  rtems_capture_update_watched (tcb);
+
   return false;
 }
 
@@ -355,17 +396,14 @@ rtems_capture_create_control (rtems_name name, rtems_id id)
 void
 rtems_capture_record_lock (rtems_capture_record_lock_context* context)
 {
-  rtems_capture_per_cpu_data* cpu;
-  cpu = capture_per_cpu_get (rtems_scheduler_get_processor ());
-  rtems_interrupt_lock_interrupt_disable (&context->lock_context);
-  context->lock = &cpu->lock;
-  rtems_interrupt_lock_acquire_isr (&cpu->lock, &context->lock_context);
+  rtems_interrupt_local_disable (context->level);
+  context->buffer = NULL;
 }
 
 void
 rtems_capture_record_unlock (rtems_capture_record_lock_context* context)
 {
-  rtems_interrupt_lock_release (context->lock, &context->lock_context);
+  rtems_interrupt_local_enable (context->level);
 }
 
 void*
@@ -379,17 +417,21 @@ rtems_capture_record_open (rtems_tcb*                         tcb,
 
   size += sizeof (rtems_capture_record);
 
-  cpu = capture_per_cpu_get (rtems_scheduler_get_processor ());
-
+  /*
+   * Mask the interrupts before getting the CPU so the task cannot migrate
+   * while the record is open.
+   */
   rtems_capture_record_lock (context);
 
+  cpu = capture_per_cpu_get (rtems_scheduler_get_processor ());
+
   ptr = rtems_capture_buffer_allocate (&cpu->records, size);
   if (ptr != NULL)
   {
     rtems_capture_record in;
     rtems_capture_time time;
 
-    ++cpu->count;
+    context->buffer = &cpu->records;
 
     if ((events & RTEMS_CAPTURE_RECORD_EVENTS) == 0)
       tcb->Capture.flags |= RTEMS_CAPTURE_TRACED;
@@ -408,8 +450,6 @@ rtems_capture_record_open (rtems_tcb*                         tcb,
 
     ptr = rtems_capture_record_append(ptr, &in, sizeof(in));
   }
-  else
-    cpu->flags |= RTEMS_CAPTURE_OVERFLOW;
 
   return ptr;
 }
@@ -417,6 +457,23 @@ rtems_capture_record_open (rtems_tcb*                         tcb,
 void
 rtems_capture_record_close (rtems_capture_record_lock_context* context)
 {
+  if (context->buffer != NULL)
+  {
+    rtems_capture_per_cpu_data* cpu;
+    unsigned int                count;
+
+    cpu = RTEMS_CONTAINER_OF (context->buffer, rtems_capture_per_cpu_data,
+                              records);
+
+    /*
+     * Count the record before it is visible so a reader never sees more
+     * records than counted.
+     */
+    count = _Atomic_Load_uint (&cpu->count, ATOMIC_ORDER_RELAXED);
+    _Atomic_Store_uint (&cpu->count, count + 1, ATOMIC_ORDER_RELAXED);
+    rtems_capture_buffer_commit (context->buffer);
+  }
+
   rtems_capture_record_unlock (context);
 }
 
@@ -445,6 +502,7 @@ rtems_capture_initialize_task( rtems_tcb* tcb )
   }
 
   tcb->Capture.flags |= RTEMS_CAPTURE_INIT_TASK;
+  rtems_capture_update_watched (tcb);
 
   rtems_interrupt_lock_release (&capture_lock_global, &lock_context);
 }
@@ -490,20 +548,15 @@ bool rtems_capture_filter (rtems_tcb*  tcb, uint32_t events)
         (RTEMS_CAPTURE_TRIGGERED | RTEMS_CAPTURE_ONLY_MONITOR)) ==
        RTEMS_CAPTURE_TRIGGERED))
   {
-    rtems_capture_control* control;
-
-    control = tcb->Capture.control;
-
     /*
      * Capture the record if we have an event that is always
-     * captured, or the task's real priority is greater than the
-     * watch ceiling, and the global watch or task watch is enabled.
+     * captured, or the global watch or task watch is enabled, and the
+     * task's real priority is greater than the watch ceiling.
      */
     if ((events & RTEMS_CAPTURE_RECORD_EVENTS) ||
-        ((rtems_capture_task_real_priority (tcb) >= capture_ceiling) &&
-         (rtems_capture_task_real_priority (tcb) <= capture_floor) &&
-         ((capture_flags_global & RTEMS_CAPTURE_GLOBAL_WATCH) ||
-          (control && (control->flags & RTEMS_CAPTURE_WATCH)))))
+        (((tcb->Capture.flags & RTEMS_CAPTURE_WATCHED) != 0) &&
+         (rtems_capture_task_real_priority (tcb) >= capture_ceiling) &&
+         (rtems_capture_task_real_priority (tcb) <= capture_floor)))
     {
       return false;
     }
@@ -601,7 +654,11 @@ rtems_capture_open (uint32_t   size, rtems_capture_timestamp timestamp RTEMS_UNU
 
   count = rtems_scheduler_get_processor_maximum();
   if (capture_per_cpu == NULL) {
-    capture_per_cpu = calloc( count, sizeof( *capture_per_cpu ) );
+    capture_per_cpu =
+      rtems_cache_aligned_malloc( count * sizeof( *capture_per_cpu ) );
+    if (capture_per_cpu == NULL)
+      return RTEMS_NO_MEMORY;
+    memset( capture_per_cpu, 0, count * sizeof( *capture_per_cpu ) );
   }
 
   for (i=0; i<count; i++) {
@@ -612,6 +669,9 @@ rtems_capture_open (uint32_t   size, rtems_capture_timestamp timestamp RTEMS_UNU
       break;
     }
 
+    _Atomic_Init_uint( &capture_count_on_cpu( i ), 0 );
+    capture_released_on_cpu( i ) = 0;
+
     rtems_interrupt_lock_initialize(
       &capture_lock_on_cpu( i ),
       "Capture Per-CPU"
@@ -750,6 +810,24 @@ rtems_capture_set_monitor (bool enable)
   return RTEMS_SUCCESSFUL;
 }
 
+static inline uint32_t
+rtems_capture_count_records (const void* records, size_t size)
+{
+  const uint8_t* ptr = records;
+  uint32_t       recs = 0;
+  size_t         bytes = 0;
+
+  while (bytes < size)
+  {
+    const rtems_capture_record* rec = (const rtems_capture_record*) ptr;
+    recs++;
+    ptr += rec->size;
+    bytes += rec->size;
+ }
+
+ return recs;
+}
+
 /*
  * This function clears the capture trace flag in the tcb.
  */
@@ -791,11 +869,32 @@ rtems_capture_flush (bool prime)
     for (cpu=0; cpu < rtems_scheduler_get_processor_maximum(); cpu++) {
       RTEMS_INTERRUPT_LOCK_REFERENCE( lock, &(capture_lock_on_cpu( cpu )) )
       rtems_interrupt_lock_context lock_context_per_cpu;
+      rtems_capture_buffer*        records = &capture_records_on_cpu(cpu);
 
+      /*
+       * A record opened before the capture engine was turned off can still be
+       * committed by the CPU owning the buffer. Count the discarded records
+       * so the released count only covers records removed from the buffer.
+       * A record committed after the peek stays in the buffer and is read
+       * later. The records wrap at most once so two peeks see all records.
+       */
       rtems_interrupt_lock_acquire (lock, &lock_context_per_cpu);
-      capture_count_on_cpu(cpu) = 0;
-      if (capture_records_on_cpu(cpu).buffer)
-        rtems_capture_buffer_flush( &capture_records_on_cpu(cpu) );
+      if (records->buffer != NULL) {
+        int pass;
+
+        for (pass = 0; pass < 2; ++pass) {
+          const void* recs;
+          size_t      recs_size;
+
+          recs = rtems_capture_buffer_peek (records, &recs_size);
+          if (recs == NULL)
+            break;
+
+          capture_released_on_cpu(cpu) +=
+            rtems_capture_count_records (recs, recs_size);
+          rtems_capture_buffer_free (records, recs_size);
+        }
+      }
       rtems_interrupt_lock_release (lock, &lock_context_per_cpu);
     }
 
@@ -868,6 +967,8 @@ rtems_capture_watch_del (rtems_name name, rtems_id id)
 
       *prev_control = control->next;
 
+      _Thread_Iterate (rtems_capture_update_watched_tcb, control);
+
       rtems_interrupt_lock_release (&capture_lock_global, &lock_context);
 
       free (control);
@@ -918,6 +1019,8 @@ rtems_capture_watch_ctrl (rtems_name name, rtems_id id, bool enable)
       else
         control->flags &= ~RTEMS_CAPTURE_WATCH;
 
+      _Thread_Iterate (rtems_capture_update_watched_tcb, NULL);
+
       rtems_interrupt_lock_release (&capture_lock_global, &lock_context);
 
       found = true;
@@ -951,6 +1054,8 @@ rtems_capture_watch_global (bool enable)
   else
     capture_flags_global &= ~RTEMS_CAPTURE_GLOBAL_WATCH;
 
+  _Thread_Iterate (rtems_capture_update_watched_tcb, NULL);
+
   rtems_interrupt_lock_release (&capture_lock_global, &lock_context);
 
   return RTEMS_SUCCESSFUL;
@@ -1198,24 +1303,6 @@ rtems_capture_clear_trigger (rtems_name                 from_name,
   return RTEMS_SUCCESSFUL;
 }
 
-static inline uint32_t
-rtems_capture_count_records (const void* records, size_t size)
-{
-  const uint8_t* ptr = records;
-  uint32_t       recs = 0;
-  size_t         bytes = 0;
-
-  while (bytes < size)
-  {
-    const rtems_capture_record* rec = (const rtems_capture_record*) ptr;
-    recs++;
-    ptr += rec->size;
-    bytes += rec->size;
- }
-
- return recs;
-}
-
 /*
  * This function reads a number of records from the capture buffer.
  *
@@ -1299,14 +1386,18 @@ rtems_capture_release (uint32_t cpu, uint32_t count)
     RTEMS_INTERRUPT_LOCK_REFERENCE( lock, &(capture_lock_on_cpu( cpu )) )
     rtems_capture_buffer*        records = &(capture_records_on_cpu( cpu ));
     uint32_t*                    flags = &(capture_flags_on_cpu( cpu ));
-    uint32_t*                    total = &(capture_count_on_cpu( cpu ));
+    uint32_t*                    released = &(capture_released_on_cpu( cpu ));
+    uint32_t                     total;
 
     sc = RTEMS_SUCCESSFUL;
 
     rtems_interrupt_lock_acquire (lock, &lock_context);
 
-    if (count > *total) {
-      count = *total;
+    total = _Atomic_Load_uint (&capture_count_on_cpu( cpu ),
+                               ATOMIC_ORDER_ACQUIRE) - *released;
+
+    if (count > total) {
+      count = total;
     }
 
     if ( (capture_flags_global & RTEMS_CAPTURE_ON) != 0 ) {
@@ -1332,7 +1423,7 @@ rtems_capture_release (uint32_t cpu, uint32_t count)
       rel_size = ptr_size;
     }
 
-    *total -= count;
+    *released += count;
 
     if (count) {
       rtems_capture_buffer_free( records, rel_size );
@@ -29,101 +29,113 @@
 void*
 rtems_capture_buffer_allocate (rtems_capture_buffer* buffer, size_t size)
 {
-  void* ptr = NULL;
+  void*  ptr = NULL;
+  size_t head;
+  size_t tail;
 
-  if ((buffer->count + size) <= buffer->end)
-  {
-    size_t end;
+  head = _Atomic_Load_uintptr (&buffer->head, ATOMIC_ORDER_RELAXED);
+  tail = _Atomic_Load_uintptr (&buffer->tail, ATOMIC_ORDER_ACQUIRE);
 
+  if (head >= tail)
+  {
     /*
-     * Determine if the end of free space is marked with the end of buffer
-     * space, or the head of allocated space.
+     * tail|.....|head| freespace| size
      *
-     * |...|head| freespace |tail| ...| end
-     *
-     * tail|.....|head| freespace| end
+     * Allocate at the head or wrap around to the front of the buffer. A
+     * wrapped head must stay below the tail, a head equal to the tail would
+     * be an empty buffer.
      */
-    if (buffer->tail > buffer->head)
+    if ((head + size) <= buffer->size)
     {
-      end = buffer->tail;
-    } else
+      ptr = &buffer->buffer[head];
+      buffer->next = head + size;
+    }
+    else if (size < tail)
     {
-      end = buffer->end;
+      /*
+       * Mark the end of the records so a read will wrap when out of data.
+       * The consumer sees the end once the head is committed.
+       */
+      buffer->end = head;
+      ptr = buffer->buffer;
+      buffer->next = size;
     }
-
+  }
+  else
+  {
     /*
-     * Can we allocate it easily?
+     * |...|head| freespace |tail| ...| end
      */
-    if ((buffer->head + size) <= end)
-    {
-      ptr = &buffer->buffer[buffer->head];
-      buffer->head += size;
-      buffer->count = buffer->count + size;
-      if (buffer->max_rec < size)
-        buffer->max_rec = size;
-    }
-    else
+    if ((head + size) < tail)
     {
-      /*
-       * We have to consider wrapping around to the front of the buffer
-       *
-       * If there is no room at the end of the buffer and we have we already
-       * wrapped then we can't allocate and if there is room at the front of
-       * the buffer.
-       */
-      if ((end != buffer->tail) && (buffer->tail >= size))
-      {
-        /*
-         * Change the end pointer to the last used byte, so a read will wrap
-         * when out of data
-         */
-        buffer->end = buffer->head;
-
-        /*
-         * Now return the buffer
-         */
-        ptr = buffer->buffer;
-        buffer->head = size;
-        buffer->count = buffer->count + size;
-        if (buffer->max_rec < size)
-          buffer->max_rec = size;
-      }
+      ptr = &buffer->buffer[head];
+      buffer->next = head + size;
     }
   }
 
+  if (ptr != NULL && buffer->max_rec < size)
+    buffer->max_rec = size;
+
   return ptr;
 }
 
+void*
+rtems_capture_buffer_peek (rtems_capture_buffer* buffer, size_t* size)
+{
+  size_t head;
+  size_t tail;
+
+  head = _Atomic_Load_uintptr (&buffer->head, ATOMIC_ORDER_ACQUIRE);
+  tail = _Atomic_Load_uintptr (&buffer->tail, ATOMIC_ORDER_RELAXED);
+
+  if (tail > head && tail == buffer->end)
+  {
+    /*
+     * All records before the end are read, continue at the front.
+     */
+    tail = 0;
+    _Atomic_Store_uintptr (&buffer->tail, tail, ATOMIC_ORDER_RELEASE);
+  }
+
+  if (tail == head)
+  {
+    *size = 0;
+    return NULL;
+  }
+
+  if (tail > head)
+    *size = buffer->end - tail;
+  else
+    *size = head - tail;
+
+  return &buffer->buffer[tail];
+}
+
 void*
 rtems_capture_buffer_free (rtems_capture_buffer* buffer, size_t size)
 {
   void*  ptr;
   size_t next;
   size_t buff_size;
+  size_t tail;
 
   if (size == 0)
     return NULL;
 
   ptr = rtems_capture_buffer_peek (buffer, &buff_size);
-  next = buffer->tail + size;
+  tail = _Atomic_Load_uintptr (&buffer->tail, ATOMIC_ORDER_RELAXED);
+  next = tail + size;
 
   /*
-   * Check if we are freeing space past the end of the buffer
+   * Check if we are freeing space past the contiguous records
    */
-  _Assert (! rtems_capture_buffer_is_empty( buffer));
-  _Assert (!((buffer->tail > buffer->head) && (next > buffer->end)));
-  _Assert (!((buffer->tail < buffer->head) && (next > buffer->head)));
+  _Assert (ptr != NULL);
+  _Assert (size <= buff_size);
 
-  buffer->count = buffer->count - size;
-
-  if (next == buffer->end)
-  {
-    buffer->end = buffer->size;
-    buffer->tail = 0;
-  } else
-  {
-    buffer->tail = next;
-  }
+  /*
+   * Freeing the last records before the end wraps the tail in the next peek.
+   */
+  _Atomic_Store_uintptr (&buffer->tail, next, ATOMIC_ORDER_RELEASE);
 
   return ptr;
 }
@@ -28,6 +28,8 @@
 
 #include <stdlib.h>
 
+#include <rtems/score/atomic.h>
+
 /**@{*/
 #ifdef __cplusplus
 extern "C" {
@@ -35,24 +37,41 @@ extern "C" {
 
 /**
  * Capture buffer. There is one per CPU.
+ *
+ * The buffer is a single producer, single consumer ring of variable length
+ * records. The producer is the CPU owning the buffer with interrupts masked
+ * and the consumer is the reader. Each side only writes its own index so no
+ * lock is needed. The producer publishes a record by storing the head with
+ * release semantics once the record is written.
+ *
+ * tail|..records..|head| freespace | end
+ *
+ * ..records..|head| freespace |tail|..records..| end
  */
 typedef struct rtems_capture_buffer {
-  uint8_t* buffer;       /**< The per cpu buffer. */
-  size_t   size;         /**< The size of the buffer in bytes. */
-  size_t   count;        /**< The number of used bytes in the buffer. */
-  size_t   head;         /**< First record. */
-  size_t   tail;         /**< Head == Tail for empty. */
-  size_t   end;          /**< Buffer current end, it may move in. */
-  size_t   max_rec;      /**< The largest record in the buffer. */
+  uint8_t*       buffer;  /**< The per cpu buffer. */
+  size_t         size;    /**< The size of the buffer in bytes. */
+  Atomic_Uintptr head;    /**< The end of the published records. Producer. */
+  Atomic_Uintptr tail;    /**< The first record. Head == Tail for empty.
+                           *   Consumer. */
+  size_t         end;     /**< The end of the records before the head
+                           *   wrapped. Producer. */
+  size_t         next;    /**< The head once the open record is
+                           *   committed. Producer. */
+  size_t         max_rec; /**< The largest record in the buffer. Producer. */
 } rtems_capture_buffer;
 
+/**
+ * Discard the records in the buffer. This is a consumer operation and can be
+ * used with active producers.
+ */
 static inline void
 rtems_capture_buffer_flush (rtems_capture_buffer* buffer)
 {
-  buffer->end = buffer->size;
-  buffer->head = buffer->tail =  0;
-  buffer->count = 0;
-  buffer->max_rec = 0;
+  _Atomic_Store_uintptr (&buffer->tail,
+                         _Atomic_Load_uintptr (&buffer->head,
+                                               ATOMIC_ORDER_ACQUIRE),
+                         ATOMIC_ORDER_RELEASE);
 }
 
 static inline void
@@ -60,13 +79,16 @@ rtems_capture_buffer_create (rtems_capture_buffer* buffer, size_t size)
 {
   buffer->buffer = malloc(size);
   buffer->size = size;
-  rtems_capture_buffer_flush (buffer);
+  buffer->end = size;
+  buffer->next = 0;
+  buffer->max_rec = 0;
+  _Atomic_Init_uintptr (&buffer->head, 0);
+  _Atomic_Init_uintptr (&buffer->tail, 0);
 }
 
 static inline void
 rtems_capture_buffer_destroy (rtems_capture_buffer*  buffer)
 {
-  rtems_capture_buffer_flush (buffer);
   free (buffer->buffer);
   buffer->buffer = NULL;
 }
@@ -74,43 +96,40 @@ rtems_capture_buffer_destroy (rtems_capture_buffer*  buffer)
 static inline bool
 rtems_capture_buffer_is_empty (rtems_capture_buffer* buffer)
 {
-   return buffer->count == 0;
-}
-
-static inline bool
-rtems_capture_buffer_is_full (rtems_capture_buffer* buffer)
-{
-   return buffer->count == buffer->size;
+  return _Atomic_Load_uintptr (&buffer->head, ATOMIC_ORDER_RELAXED) ==
+    _Atomic_Load_uintptr (&buffer->tail, ATOMIC_ORDER_RELAXED);
 }
 
 static inline bool
 rtems_capture_buffer_has_wrapped (rtems_capture_buffer* buffer)
 {
-  if (buffer->tail > buffer->head)
-    return true;
-
-  return false;
+  return _Atomic_Load_uintptr (&buffer->tail, ATOMIC_ORDER_RELAXED) >
+    _Atomic_Load_uintptr (&buffer->head, ATOMIC_ORDER_RELAXED);
 }
 
-static inline void*
-rtems_capture_buffer_peek (rtems_capture_buffer* buffer, size_t* size)
+/**
+ * Publish the record returned by the last allocate. Producer.
+ */
+static inline void
+rtems_capture_buffer_commit (rtems_capture_buffer* buffer)
 {
-  if (rtems_capture_buffer_is_empty (buffer))
-  {
-    *size = 0;
-    return NULL;
-  }
-
-  if (buffer->tail > buffer->head)
-    *size = buffer->end - buffer->tail;
-  else
-    *size = buffer->head - buffer->tail;
-
-  return &buffer->buffer[buffer->tail];
+  _Atomic_Store_uintptr (&buffer->head, buffer->next, ATOMIC_ORDER_RELEASE);
 }
 
+/**
+ * Allocate a record. It is not visible to the consumer until it is
+ * committed. Producer.
+ */
 void* rtems_capture_buffer_allocate (rtems_capture_buffer* buffer, size_t size);
 
+/**
+ * Return the first contiguous block of records. Consumer.
+ */
+void* rtems_capture_buffer_peek (rtems_capture_buffer* buffer, size_t* size);
+
+/**
+ * Release records from the front of the buffer. Consumer.
+ */
 void* rtems_capture_buffer_free (rtems_capture_buffer* buffer, size_t size);
 
 #ifdef __cplusplus
@@ -286,19 +286,12 @@ rtems_capture_switch_task (rtems_tcb* ct,
    */
   if (flags & RTEMS_CAPTURE_ON)
   {
-    rtems_capture_time time;
     if (!rtems_capture_task_initialized (ct))
       rtems_capture_initialize_task (ct);
 
     if (!rtems_capture_task_initialized (ht))
       rtems_capture_initialize_task (ht);
 
-    /*
-     * Update the execution time. Assume the time will not overflow
-     * for now. This may need to change.
-     */
-    rtems_capture_get_time (&time);
-
     if (rtems_capture_trigger_fired (ct, ht, RTEMS_CAPTURE_SWITCH))
     {
       capture_record (ct, RTEMS_CAPTURE_SWITCHED_OUT_EVENT);
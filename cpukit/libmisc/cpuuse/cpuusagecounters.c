@@ -0,0 +1,437 @@
+/**
+ * @file
+ *
+ * @ingroup libmisc_cpuuse CPU Usage
+ *
+ * @brief CPU Usage Counters
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include <rtems/cpuuse.h>
+#include <rtems/score/apimutex.h>
+#include <rtems/score/cpu.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/userextimpl.h>
+#include <rtems/score/watchdogimpl.h>
+
+#include "cpuuseimpl.h"
+
+/*
+ * Each processor has its own counter state which is only changed by the
+ * thread switch extension and the sample watchdog on this processor with
+ * interrupts disabled.  On SMP configurations the extension runs also with
+ * the per-processor lock acquired.  A CPU usage reset is detected through the
+ * uptime of the last reset, so that each processor clears its own totals.
+ *
+ * The counters of the port have only 32 bits.  A processor cycle counter at
+ * 4GHz wraps after about one second, so the counters are also sampled
+ * periodically by a watchdog for threads which use a processor for a longer
+ * time without a thread switch.
+ */
+
+#if defined(CPU_PROVIDES_PERFORMANCE_COUNTERS) \
+  && CPU_PROVIDES_PERFORMANCE_COUNTERS == TRUE
+#define CPU_USAGE_COUNTERS_HAVE_PORT_SUPPORT
+#endif
+
+#if defined(RTEMS_SMP)
+#define CPU_USAGE_COUNTERS_PROCESSORS CPU_MAXIMUM_PROCESSORS
+#else
+#define CPU_USAGE_COUNTERS_PROCESSORS 1
+#endif
+
+#define CPU_USAGE_COUNTERS_SAMPLES_PER_SECOND 4
+
+typedef struct {
+  Watchdog_Control            Watchdog;
+  bool                        active;
+#if defined(CPU_USAGE_COUNTERS_HAVE_PORT_SUPPORT)
+  uint32_t                    last_cycles;
+  uint32_t                    last_instructions;
+  uint32_t                    last_cache_misses;
+#else
+  CPU_Counter_ticks           last_cycles;
+#endif
+  bool                        have_events;
+  Timestamp_Control           reset;
+  Thread_Performance_counters total;
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) CPU_usage_Counters_processor;
+
+typedef struct {
+  User_extensions_Control      Extension;
+  bool                         enabled;
+  bool                         have_events;
+  CPU_usage_Counters_processor Processor[ CPU_USAGE_COUNTERS_PROCESSORS ];
+} CPU_usage_Counters_control;
+
+static void CPU_usage_Counters_switch_extension(
+  Thread_Control *executing,
+  Thread_Control *heir
+);
+
+static CPU_usage_Counters_control CPU_usage_Counters = {
+  .Extension = {
+    .Callouts = {
+      .thread_switch = CPU_usage_Counters_switch_extension
+    }
+  }
+};
+
+static void CPU_usage_Counters_add(
+  Thread_Performance_counters       *sum,
+  const Thread_Performance_counters *delta
+)
+{
+  sum->cycles += delta->cycles;
+  sum->instructions += delta->instructions;
+  sum->cache_misses += delta->cache_misses;
+}
+
+static void CPU_usage_Counters_sample(
+  CPU_usage_Counters_processor *processor,
+  Thread_Performance_counters  *delta
+)
+{
+#if defined(CPU_USAGE_COUNTERS_HAVE_PORT_SUPPORT)
+  uint32_t cycles;
+  uint32_t instructions;
+  uint32_t cache_misses;
+
+  _CPU_Performance_counters_read( &cycles, &instructions, &cache_misses );
+  delta->cycles = cycles - processor->last_cycles;
+  delta->instructions = instructions - processor->last_instructions;
+  delta->cache_misses = cache_misses - processor->last_cache_misses;
+  processor->last_cycles = cycles;
+  processor->last_instructions = instructions;
+  processor->last_cache_misses = cache_misses;
+#else
+  CPU_Counter_ticks cycles;
+
+  cycles = _CPU_Counter_read();
+  delta->cycles = _CPU_Counter_difference( cycles, processor->last_cycles );
+  delta->instructions = 0;
+  delta->cache_misses = 0;
+  processor->last_cycles = cycles;
+#endif
+}
+
+static void CPU_usage_Counters_update(
+  CPU_usage_Counters_processor *processor,
+  Thread_Control               *executing
+)
+{
+  Thread_Performance_counters delta;
+
+  CPU_usage_Counters_sample( processor, &delta );
+
+  if (
+    !_Timestamp_Equal_to( &processor->reset, &CPU_usage_Uptime_at_last_reset )
+  ) {
+    processor->reset = CPU_usage_Uptime_at_last_reset;
+    memset( &processor->total, 0, sizeof( processor->total ) );
+  }
+
+  CPU_usage_Counters_add( &processor->total, &delta );
+  CPU_usage_Counters_add(
+    CPU_usage_Get_performance_counters( executing ),
+    &delta
+  );
+}
+
+static void CPU_usage_Counters_switch_extension(
+  Thread_Control *executing,
+  Thread_Control *heir
+)
+{
+  CPU_usage_Counters_processor *processor;
+  ISR_Level                     level;
+
+  (void) heir;
+
+  /*
+   * On uniprocessor configurations the extension runs with interrupts
+   * enabled, so the sample watchdog could interrupt the update.
+   */
+  _ISR_Local_disable( level );
+  processor = &CPU_usage_Counters.Processor[ _SMP_Get_current_processor() ];
+  CPU_usage_Counters_update( processor, executing );
+  _ISR_Local_enable( level );
+}
+
+static void CPU_usage_Counters_arm(
+  CPU_usage_Counters_processor *processor,
+  Per_CPU_Control              *cpu
+)
+{
+  uint32_t interval;
+
+  interval = _Watchdog_Ticks_per_second
+    / CPU_USAGE_COUNTERS_SAMPLES_PER_SECOND;
+
+  if ( interval == 0 ) {
+    interval = 1;
+  }
+
+  _Watchdog_Per_CPU_insert_ticks( &processor->Watchdog, cpu, interval );
+}
+
+static void CPU_usage_Counters_watchdog( Watchdog_Control *watchdog )
+{
+  CPU_usage_Counters_processor *processor;
+  Per_CPU_Control              *cpu;
+  ISR_Level                     level;
+
+  processor = RTEMS_CONTAINER_OF(
+    watchdog,
+    CPU_usage_Counters_processor,
+    Watchdog
+  );
+  cpu = _Watchdog_Get_CPU( watchdog );
+
+  /*
+   * The watchdog may be armed again by an enable after a disable while this
+   * routine was pending.
+   */
+  _ISR_Local_disable( level );
+
+  if ( processor->active && !_Watchdog_Is_scheduled( watchdog ) ) {
+    CPU_usage_Counters_update( processor, _Per_CPU_Get_executing( cpu ) );
+    CPU_usage_Counters_arm( processor, cpu );
+  }
+
+  _ISR_Local_enable( level );
+}
+
+static void CPU_usage_Counters_start( void *arg )
+{
+  CPU_usage_Counters_processor *processor;
+  Per_CPU_Control              *cpu_self;
+  Thread_Performance_counters   delta;
+  ISR_Level                     level;
+
+  (void) arg;
+
+  _ISR_Local_disable( level );
+  cpu_self = _Per_CPU_Get();
+  processor = &CPU_usage_Counters.Processor[ _Per_CPU_Get_index( cpu_self ) ];
+
+#if defined(CPU_USAGE_COUNTERS_HAVE_PORT_SUPPORT)
+  processor->have_events = _CPU_Performance_counters_enable();
+#else
+  processor->have_events = false;
+#endif
+
+  CPU_usage_Counters_sample( processor, &delta );
+
+  _Watchdog_Preinitialize( &processor->Watchdog, cpu_self );
+  _Watchdog_Initialize( &processor->Watchdog, CPU_usage_Counters_watchdog );
+  processor->active = true;
+  CPU_usage_Counters_arm( processor, cpu_self );
+  _ISR_Local_enable( level );
+}
+
+static void CPU_usage_Counters_stop( void *arg )
+{
+  CPU_usage_Counters_processor *processor;
+  ISR_Level                     level;
+
+  (void) arg;
+
+  _ISR_Local_disable( level );
+  processor = &CPU_usage_Counters.Processor[ _SMP_Get_current_processor() ];
+  processor->active = false;
+  _Watchdog_Per_CPU_remove_ticks( &processor->Watchdog );
+  _ISR_Local_enable( level );
+}
+
+static void CPU_usage_Counters_broadcast( void ( *handler )( void * ) )
+{
+  Per_CPU_Control *cpu_self;
+
+  cpu_self = _Thread_Dispatch_disable();
+#if defined(RTEMS_SMP)
+  _SMP_Broadcast_action( handler, NULL );
+#else
+  ( *handler )( NULL );
+#endif
+  _Thread_Dispatch_enable( cpu_self );
+}
+
+rtems_status_code rtems_cpu_usage_counters_enable( void )
+{
+  CPU_usage_Counters_control *counters;
+  uint32_t                    cpu_max;
+  uint32_t                    cpu_index;
+  bool                        have_events;
+
+  if ( _Thread_Performance_counters_offset == 0 ) {
+    return RTEMS_NOT_CONFIGURED;
+  }
+
+  counters = &CPU_usage_Counters;
+  _Objects_Allocator_lock();
+
+  if ( counters->enabled ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  CPU_usage_Counters_broadcast( CPU_usage_Counters_start );
+
+  have_events = true;
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if ( _Per_CPU_Is_processor_online( _Per_CPU_Get_by_index( cpu_index ) ) ) {
+      have_events = have_events
+        && counters->Processor[ cpu_index ].have_events;
+    }
+  }
+
+  counters->have_events = have_events;
+  counters->enabled = true;
+  _User_extensions_Add_set( &counters->Extension );
+
+  _Objects_Allocator_unlock();
+  return RTEMS_SUCCESSFUL;
+}
+
+void rtems_cpu_usage_counters_disable( void )
+{
+  CPU_usage_Counters_control *counters;
+
+  counters = &CPU_usage_Counters;
+  _Objects_Allocator_lock();
+
+  if ( counters->enabled ) {
+    _User_extensions_Remove_set( &counters->Extension );
+    CPU_usage_Counters_broadcast( CPU_usage_Counters_stop );
+    counters->enabled = false;
+  }
+
+  _Objects_Allocator_unlock();
+}
+
+bool rtems_cpu_usage_counters_are_enabled( void )
+{
+  return CPU_usage_Counters.enabled;
+}
+
+bool rtems_cpu_usage_counters_have_events( void )
+{
+  return CPU_usage_Counters.have_events;
+}
+
+static void CPU_usage_Counters_get(
+  const volatile Thread_Performance_counters *src,
+  rtems_cpu_usage_counters                   *dst
+)
+{
+  /*
+   * The thread counters may be updated by a thread switch on another
+   * processor.  Read them until two consecutive reads match to avoid torn
+   * values on targets without atomic 64-bit loads.
+   */
+  do {
+    dst->cycles = src->cycles;
+    dst->instructions = src->instructions;
+    dst->cache_misses = src->cache_misses;
+  } while (
+    dst->cycles != src->cycles
+      || dst->instructions != src->instructions
+      || dst->cache_misses != src->cache_misses
+  );
+}
+
+rtems_status_code rtems_cpu_usage_get_counters(
+  rtems_id                  id,
+  rtems_cpu_usage_counters *counters
+)
+{
+  Thread_Control   *the_thread;
+  ISR_lock_Context  lock_context;
+
+  if ( counters == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( _Thread_Performance_counters_offset == 0 ) {
+    return RTEMS_NOT_CONFIGURED;
+  }
+
+  the_thread = _Thread_Get( id, &lock_context );
+
+  if ( the_thread == NULL ) {
+    return RTEMS_INVALID_ID;
+  }
+
+  CPU_usage_Counters_get(
+    CPU_usage_Get_performance_counters( the_thread ),
+    counters
+  );
+
+  _ISR_lock_ISR_enable( &lock_context );
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_cpu_usage_get_processor_counters(
+  uint32_t                  cpu_index,
+  rtems_cpu_usage_counters *counters
+)
+{
+  const CPU_usage_Counters_processor *processor;
+#if defined(RTEMS_SMP)
+  Per_CPU_Control                    *cpu;
+#endif
+  Per_CPU_Control                    *cpu_self;
+  ISR_lock_Context                    lock_context;
+
+  if ( counters == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( cpu_index >= _SMP_Get_processor_maximum() ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  processor = &CPU_usage_Counters.Processor[ cpu_index ];
+
+  cpu_self = _Thread_Dispatch_disable();
+  _ISR_lock_ISR_disable( &lock_context );
+#if defined(RTEMS_SMP)
+  cpu = _Per_CPU_Get_by_index( cpu_index );
+  _Per_CPU_Acquire( cpu, &lock_context );
+#endif
+
+  if (
+    _Timestamp_Equal_to( &processor->reset, &CPU_usage_Uptime_at_last_reset )
+  ) {
+    counters->cycles = processor->total.cycles;
+    counters->instructions = processor->total.instructions;
+    counters->cache_misses = processor->total.cache_misses;
+  } else {
+    memset( counters, 0, sizeof( *counters ) );
+  }
+
+#if defined(RTEMS_SMP)
+  _Per_CPU_Release( cpu, &lock_context );
+#endif
+  _ISR_lock_ISR_enable( &lock_context );
+  _Thread_Dispatch_enable( cpu_self );
+  return RTEMS_SUCCESSFUL;
+}
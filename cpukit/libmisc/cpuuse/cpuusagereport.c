@@ -73,6 +73,93 @@ static bool cpu_usage_visitor( Thread_Control *the_thread, void *arg )
   return false;
 }
 
+static bool cpu_usage_counters_visitor(
+  Thread_Control *the_thread,
+  void           *arg
+)
+{
+  const rtems_printer      *printer;
+  char                      name[ 16 ];
+  rtems_cpu_usage_counters  counters;
+  rtems_status_code         sc;
+
+  printer = arg;
+  _Thread_Get_name( the_thread, name, sizeof( name ) );
+
+  sc = rtems_cpu_usage_get_counters( the_thread->Object.id, &counters );
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    return false;
+  }
+
+  rtems_printf(
+    printer,
+    " 0x%08" PRIx32 " | %-15s | %14" PRIu64 " | %14" PRIu64 " | %13" PRIu64 "\n",
+    the_thread->Object.id,
+    name,
+    counters.cycles,
+    counters.instructions,
+    counters.cache_misses
+  );
+
+  return false;
+}
+
+static void cpu_usage_counters_report( const rtems_printer *printer )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  rtems_printf(
+     printer,
+     "                          PERFORMANCE COUNTERS BY THREAD\n"
+     "------------+-----------------+----------------+----------------+--------------\n"
+     " ID         | NAME            | CYCLES         | INSTRUCTIONS   | CACHE MISSES\n"
+     "------------+-----------------+----------------+----------------+--------------\n"
+  );
+
+  rtems_task_iterate(
+    cpu_usage_counters_visitor,
+    RTEMS_DECONST( rtems_printer *, printer )
+  );
+
+  rtems_printf(
+     printer,
+     "------------+-----------------+----------------+----------------+--------------\n"
+  );
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    rtems_cpu_usage_counters counters;
+    rtems_status_code        sc;
+
+    sc = rtems_cpu_usage_get_processor_counters( cpu_index, &counters );
+    if ( sc == RTEMS_SUCCESSFUL ) {
+      rtems_printf(
+        printer,
+        " CPU %-6" PRIu32 " |                 | %14" PRIu64 " | %14" PRIu64
+          " | %13" PRIu64 "\n",
+        cpu_index,
+        counters.cycles,
+        counters.instructions,
+        counters.cache_misses
+      );
+    }
+  }
+
+  if ( !rtems_cpu_usage_counters_have_events() ) {
+    rtems_printf(
+       printer,
+       " INSTRUCTIONS AND CACHE MISSES ARE NOT COUNTED ON THIS PROCESSOR\n"
+    );
+  }
+
+  rtems_printf(
+     printer,
+     "-------------------------------------------------------------------------------\n"
+  );
+}
+
 /*
  *  rtems_cpu_usage_report
  */
@@ -115,6 +202,10 @@ void rtems_cpu_usage_report_with_plugin(
      "-------------------------------------------------------------------------------\n",
      seconds, nanoseconds
   );
+
+  if ( rtems_cpu_usage_counters_are_enabled() ) {
+    cpu_usage_counters_report( printer );
+  }
 }
 
 void rtems_cpu_usage_report( void )
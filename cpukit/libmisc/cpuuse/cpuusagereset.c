@@ -19,6 +19,8 @@
 #include "config.h"
 #endif
 
+#include <string.h>
+
 #include <rtems/cpuuse.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/todimpl.h>
@@ -42,6 +44,14 @@ static bool CPU_usage_Per_thread_handler(
 
   _Timestamp_Set_to_zero( &the_thread->cpu_time_used );
 
+  if ( _Thread_Performance_counters_offset != 0 ) {
+    memset(
+      CPU_usage_Get_performance_counters( the_thread ),
+      0,
+      sizeof( Thread_Performance_counters )
+    );
+  }
+
   _Scheduler_Release_critical( scheduler, &scheduler_lock_context );
   _Thread_State_release( the_thread, &state_lock_context );
   return false;
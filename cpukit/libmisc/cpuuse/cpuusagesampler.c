@@ -0,0 +1,582 @@
+/**
+ * @file
+ *
+ * @ingroup libmisc_cpuuse CPU Usage
+ *
+ * @brief CPU Usage Sampler
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/cpuuse.h>
+#include <rtems/rtems/tasksimpl.h>
+#include <rtems/score/apimutex.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/schedulerimpl.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/todimpl.h>
+#include <rtems/score/userextimpl.h>
+
+#include "cpuuseimpl.h"
+
+/*
+ * The sampler table has an entry for each thread object.  The thread switch
+ * extension appends the entry of the thread leaving a processor to the marked
+ * list of the current period, once per period.  An update swaps the two
+ * marked lists and only visits the threads of the ended period.  The marked
+ * lists are protected by the sampler lock, everything else by the object
+ * allocator lock which is also held by the thread create and delete
+ * extensions.
+ */
+
+typedef struct {
+  Thread_Control    *thread;
+  Timestamp_Control  used;
+  Timestamp_Control  current;
+  uint32_t           generation;
+} CPU_usage_Sampler_entry;
+
+typedef struct {
+  ISR_LOCK_MEMBER( Lock )
+  User_extensions_Control  Extension;
+  CPU_usage_Sampler_entry *entries;
+  uint32_t                 entry_count;
+  uint32_t                 base[ OBJECTS_APIS_LAST + 1 ];
+  Objects_Maximum          maximum[ OBJECTS_APIS_LAST + 1 ];
+  uint32_t                *marked[ 2 ];
+  uint32_t                 marked_count;
+  uint32_t                 generation;
+  const uint32_t          *active;
+  uint32_t                 active_count;
+  Timestamp_Control        reset;
+  Timestamp_Control        last_uptime;
+  Timestamp_Control        total;
+  Timestamp_Control        idle;
+  uint32_t                 threads;
+  uintptr_t                stack_size;
+  bool                     overflow;
+} CPU_usage_Sampler_control;
+
+static bool CPU_usage_Sampler_create_extension(
+  Thread_Control *executing,
+  Thread_Control *created
+);
+
+static void CPU_usage_Sampler_delete_extension(
+  Thread_Control *executing,
+  Thread_Control *deleted
+);
+
+static void CPU_usage_Sampler_switch_extension(
+  Thread_Control *executing,
+  Thread_Control *heir
+);
+
+static CPU_usage_Sampler_control CPU_usage_Sampler = {
+#if defined(RTEMS_SMP)
+  .Lock = ISR_LOCK_INITIALIZER( "CPU Usage Sampler" ),
+#endif
+  .Extension = {
+    .Callouts = {
+      .thread_create = CPU_usage_Sampler_create_extension,
+      .thread_delete = CPU_usage_Sampler_delete_extension,
+      .thread_switch = CPU_usage_Sampler_switch_extension
+    }
+  }
+};
+
+static uint32_t CPU_usage_Sampler_index(
+  const CPU_usage_Sampler_control *sampler,
+  Objects_Id                       id
+)
+{
+  Objects_APIs    api;
+  Objects_Maximum index;
+
+  api = _Objects_Get_API( id );
+  index = _Objects_Get_index( id );
+
+  if ( api > OBJECTS_APIS_LAST || index > sampler->maximum[ api ] ) {
+    return UINT32_MAX;
+  }
+
+  return sampler->base[ api ] + index - OBJECTS_INDEX_MINIMUM;
+}
+
+static void CPU_usage_Sampler_mark(
+  CPU_usage_Sampler_control *sampler,
+  const Thread_Control      *the_thread
+)
+{
+  uint32_t index;
+
+  index = CPU_usage_Sampler_index( sampler, the_thread->Object.id );
+
+  if ( index < sampler->entry_count ) {
+    CPU_usage_Sampler_entry *entry;
+
+    entry = &sampler->entries[ index ];
+
+    if ( entry->generation != sampler->generation ) {
+      entry->generation = sampler->generation;
+      sampler->marked[ sampler->generation & 1 ][ sampler->marked_count ] =
+        index;
+      ++sampler->marked_count;
+    }
+  }
+}
+
+static void CPU_usage_Sampler_switch_extension(
+  Thread_Control *executing,
+  Thread_Control *heir
+)
+{
+  CPU_usage_Sampler_control *sampler;
+  ISR_lock_Context           lock_context;
+
+  (void) heir;
+  sampler = &CPU_usage_Sampler;
+
+  _ISR_lock_ISR_disable_and_acquire( &sampler->Lock, &lock_context );
+
+  if ( executing != NULL ) {
+    CPU_usage_Sampler_mark( sampler, executing );
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &sampler->Lock, &lock_context );
+}
+
+static bool CPU_usage_Sampler_add(
+  Thread_Control *the_thread,
+  void           *arg
+)
+{
+  CPU_usage_Sampler_control *sampler;
+  uint32_t                   index;
+
+  sampler = arg;
+  index = CPU_usage_Sampler_index( sampler, the_thread->Object.id );
+
+  if ( index < sampler->entry_count ) {
+    CPU_usage_Sampler_entry *entry;
+
+    entry = &sampler->entries[ index ];
+    entry->thread = the_thread;
+    _Timestamp_Set_to_zero( &entry->used );
+    _Timestamp_Set_to_zero( &entry->current );
+    ++sampler->threads;
+    sampler->stack_size += the_thread->Start.Initial_stack.size;
+  } else {
+    sampler->overflow = true;
+  }
+
+  return false;
+}
+
+static bool CPU_usage_Sampler_create_extension(
+  Thread_Control *executing,
+  Thread_Control *created
+)
+{
+  (void) executing;
+  CPU_usage_Sampler_add( created, &CPU_usage_Sampler );
+  return true;
+}
+
+static void CPU_usage_Sampler_delete_extension(
+  Thread_Control *executing,
+  Thread_Control *deleted
+)
+{
+  CPU_usage_Sampler_control *sampler;
+  uint32_t                   index;
+
+  (void) executing;
+  sampler = &CPU_usage_Sampler;
+  index = CPU_usage_Sampler_index( sampler, deleted->Object.id );
+
+  if ( index < sampler->entry_count ) {
+    CPU_usage_Sampler_entry *entry;
+
+    entry = &sampler->entries[ index ];
+
+    if ( entry->thread == deleted ) {
+      entry->thread = NULL;
+      _Timestamp_Subtract( &entry->used, &sampler->total, &sampler->total );
+      --sampler->threads;
+      sampler->stack_size -= deleted->Start.Initial_stack.size;
+    }
+  }
+}
+
+/*
+ * Get the CPU time used by all threads again, for example after a CPU usage
+ * reset.  This is the only place which visits every entry.
+ */
+static void CPU_usage_Sampler_synchronize( CPU_usage_Sampler_control *sampler )
+{
+  uint32_t index;
+
+  sampler->reset = CPU_usage_Uptime_at_last_reset;
+  _Timestamp_Set_to_zero( &sampler->total );
+  _Timestamp_Set_to_zero( &sampler->idle );
+
+  for ( index = 0 ; index < sampler->entry_count ; ++index ) {
+    CPU_usage_Sampler_entry *entry;
+    Thread_Control          *the_thread;
+
+    entry = &sampler->entries[ index ];
+    the_thread = entry->thread;
+
+    if ( the_thread != NULL ) {
+      _Thread_Get_CPU_time_used( the_thread, &entry->used );
+      _Timestamp_Set_to_zero( &entry->current );
+      _Timestamp_Add_to( &sampler->total, &entry->used );
+
+      if ( the_thread->is_idle ) {
+        _Timestamp_Add_to( &sampler->idle, &entry->used );
+      }
+    }
+  }
+}
+
+rtems_status_code rtems_cpu_usage_sampler_create( void )
+{
+  CPU_usage_Sampler_control *sampler;
+  uint32_t                   entry_count;
+  int                        api;
+
+  sampler = &CPU_usage_Sampler;
+  _Objects_Allocator_lock();
+
+  if ( sampler->entries != NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  entry_count = 0;
+
+  for ( api = 1 ; api <= OBJECTS_APIS_LAST ; ++api ) {
+    const Objects_Information *information;
+
+    information = _Objects_Information_table[ api ][ 1 ];
+    sampler->base[ api ] = entry_count;
+
+    if ( information != NULL ) {
+      sampler->maximum[ api ] = _Objects_Get_maximum_index( information );
+    } else {
+      sampler->maximum[ api ] = 0;
+    }
+
+    entry_count += sampler->maximum[ api ];
+  }
+
+  sampler->entries = calloc( entry_count, sizeof( *sampler->entries ) );
+  sampler->marked[ 0 ] = calloc( entry_count, sizeof( uint32_t ) );
+  sampler->marked[ 1 ] = calloc( entry_count, sizeof( uint32_t ) );
+
+  if (
+    sampler->entries == NULL
+      || sampler->marked[ 0 ] == NULL
+      || sampler->marked[ 1 ] == NULL
+  ) {
+    free( sampler->entries );
+    free( sampler->marked[ 0 ] );
+    free( sampler->marked[ 1 ] );
+    sampler->entries = NULL;
+    _Objects_Allocator_unlock();
+    return RTEMS_NO_MEMORY;
+  }
+
+  sampler->entry_count = entry_count;
+  sampler->marked_count = 0;
+  sampler->generation = 1;
+  sampler->active = sampler->marked[ 1 ];
+  sampler->active_count = 0;
+  sampler->threads = 0;
+  sampler->stack_size = 0;
+  sampler->overflow = false;
+
+  _Thread_Iterate( CPU_usage_Sampler_add, sampler );
+  CPU_usage_Sampler_synchronize( sampler );
+  _TOD_Get_uptime( &sampler->last_uptime );
+
+  _User_extensions_Add_set( &sampler->Extension );
+
+  _Objects_Allocator_unlock();
+  return RTEMS_SUCCESSFUL;
+}
+
+void rtems_cpu_usage_sampler_delete( void )
+{
+  CPU_usage_Sampler_control *sampler;
+
+  sampler = &CPU_usage_Sampler;
+  _Objects_Allocator_lock();
+
+  if ( sampler->entries != NULL ) {
+    _User_extensions_Remove_set( &sampler->Extension );
+    free( sampler->entries );
+    free( sampler->marked[ 0 ] );
+    free( sampler->marked[ 1 ] );
+    sampler->entries = NULL;
+    sampler->entry_count = 0;
+  }
+
+  _Objects_Allocator_unlock();
+}
+
+rtems_status_code rtems_cpu_usage_sampler_update(
+  rtems_cpu_usage_summary *summary
+)
+{
+  CPU_usage_Sampler_control *sampler;
+  ISR_lock_Context           lock_context;
+  Timestamp_Control          uptime;
+  Timestamp_Control          period;
+  Timestamp_Control          current;
+  Timestamp_Control          current_idle;
+  const uint32_t            *marked;
+  uint32_t                   marked_count;
+  uint32_t                   cpu_max;
+  uint32_t                   cpu_index;
+  uint32_t                   i;
+  rtems_status_code          sc;
+
+  sampler = &CPU_usage_Sampler;
+  _Objects_Allocator_lock();
+
+  if ( sampler->entries == NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  if ( !_Timestamp_Equal_to( &sampler->reset, &CPU_usage_Uptime_at_last_reset ) ) {
+    CPU_usage_Sampler_synchronize( sampler );
+  }
+
+  /*
+   * The threads of the previous period which did not use a processor in this
+   * period are not visited below.
+   */
+  for ( i = 0 ; i < sampler->active_count ; ++i ) {
+    _Timestamp_Set_to_zero( &sampler->entries[ sampler->active[ i ] ].current );
+  }
+
+  _TOD_Get_uptime( &uptime );
+
+  /*
+   * The threads executing now did not leave a processor in this period.
+   */
+  cpu_max = _SMP_Get_processor_maximum();
+
+  _ISR_lock_ISR_disable_and_acquire( &sampler->Lock, &lock_context );
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    const Per_CPU_Control *cpu;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+
+    if ( _Per_CPU_Is_processor_online( cpu ) ) {
+      CPU_usage_Sampler_mark( sampler, cpu->executing );
+    }
+  }
+
+  marked = sampler->marked[ sampler->generation & 1 ];
+  marked_count = sampler->marked_count;
+  ++sampler->generation;
+  sampler->marked_count = 0;
+
+  _ISR_lock_Release_and_ISR_enable( &sampler->Lock, &lock_context );
+
+  _Timestamp_Set_to_zero( &current );
+  _Timestamp_Set_to_zero( &current_idle );
+
+  for ( i = 0 ; i < marked_count ; ++i ) {
+    CPU_usage_Sampler_entry *entry;
+    Thread_Control          *the_thread;
+    Timestamp_Control        used;
+
+    entry = &sampler->entries[ marked[ i ] ];
+    the_thread = entry->thread;
+
+    if ( the_thread == NULL ) {
+      continue;
+    }
+
+    _Thread_Get_CPU_time_used( the_thread, &used );
+
+    if ( _Timestamp_Less_than( &used, &entry->used ) ) {
+      entry->current = used;
+    } else {
+      _Timestamp_Subtract( &entry->used, &used, &entry->current );
+    }
+
+    entry->used = used;
+    _Timestamp_Add_to( &sampler->total, &entry->current );
+    _Timestamp_Add_to( &current, &entry->current );
+
+    if ( the_thread->is_idle ) {
+      _Timestamp_Add_to( &sampler->idle, &entry->current );
+      _Timestamp_Add_to( &current_idle, &entry->current );
+    }
+  }
+
+  sampler->active = marked;
+  sampler->active_count = marked_count;
+
+  _Timestamp_Subtract( &sampler->last_uptime, &uptime, &period );
+  sampler->last_uptime = uptime;
+  _Timestamp_Subtract( &sampler->reset, &uptime, &uptime );
+
+  summary->uptime = _Timestamp_Get_as_nanoseconds( &uptime );
+  summary->period = _Timestamp_Get_as_nanoseconds( &period );
+  summary->total = _Timestamp_Get_as_nanoseconds( &sampler->total );
+  summary->idle = _Timestamp_Get_as_nanoseconds( &sampler->idle );
+  summary->current = _Timestamp_Get_as_nanoseconds( &current );
+  summary->current_idle = _Timestamp_Get_as_nanoseconds( &current_idle );
+  summary->threads = sampler->threads;
+  summary->active = marked_count;
+  summary->stack_size = sampler->stack_size;
+
+  sc = sampler->overflow ? RTEMS_TOO_MANY : RTEMS_SUCCESSFUL;
+  _Objects_Allocator_unlock();
+  return sc;
+}
+
+static uint64_t CPU_usage_Sampler_key(
+  const rtems_cpu_usage_sample *sample,
+  bool                          total
+)
+{
+  return total ? sample->total : sample->current;
+}
+
+/*
+ * Insert the entry into the samples in descending order.  The count is small
+ * compared to the number of threads so an insertion sort is sufficient.
+ */
+static size_t CPU_usage_Sampler_insert(
+  rtems_cpu_usage_sample        *samples,
+  size_t                         count,
+  size_t                         n,
+  const CPU_usage_Sampler_entry *entry,
+  bool                           total
+)
+{
+  rtems_cpu_usage_sample sample;
+  size_t                 i;
+
+  sample.id = entry->thread->Object.id;
+  sample.total = _Timestamp_Get_as_nanoseconds( &entry->used );
+  sample.current = _Timestamp_Get_as_nanoseconds( &entry->current );
+
+  i = n;
+
+  while (
+    i > 0
+      && CPU_usage_Sampler_key( &sample, total )
+        > CPU_usage_Sampler_key( &samples[ i - 1 ], total )
+  ) {
+    if ( i < count ) {
+      samples[ i ] = samples[ i - 1 ];
+    }
+
+    --i;
+  }
+
+  if ( i < count ) {
+    samples[ i ] = sample;
+
+    if ( n < count ) {
+      ++n;
+    }
+  }
+
+  return n;
+}
+
+size_t rtems_cpu_usage_sampler_top(
+  rtems_cpu_usage_sample *samples,
+  size_t                  count,
+  bool                    total
+)
+{
+  CPU_usage_Sampler_control *sampler;
+  size_t                     n;
+  size_t                     i;
+
+  sampler = &CPU_usage_Sampler;
+  n = 0;
+
+  _Objects_Allocator_lock();
+
+  if ( sampler->entries == NULL ) {
+    _Objects_Allocator_unlock();
+    return 0;
+  }
+
+  if ( total ) {
+    for ( i = 0 ; i < sampler->entry_count ; ++i ) {
+      const CPU_usage_Sampler_entry *entry;
+
+      entry = &sampler->entries[ i ];
+
+      if ( entry->thread != NULL ) {
+        n = CPU_usage_Sampler_insert( samples, count, n, entry, total );
+      }
+    }
+  } else {
+    for ( i = 0 ; i < sampler->active_count ; ++i ) {
+      const CPU_usage_Sampler_entry *entry;
+
+      entry = &sampler->entries[ sampler->active[ i ] ];
+
+      if ( entry->thread != NULL ) {
+        n = CPU_usage_Sampler_insert( samples, count, n, entry, total );
+      }
+    }
+  }
+
+  for ( i = 0 ; i < n ; ++i ) {
+    const Scheduler_Control *scheduler;
+    Thread_Control          *the_thread;
+    Thread_queue_Context     queue_context;
+    Priority_Control         real_priority;
+    Priority_Control         priority;
+
+    the_thread = sampler->entries[
+      CPU_usage_Sampler_index( sampler, samples[ i ].id )
+    ].thread;
+
+    _Thread_queue_Context_initialize( &queue_context );
+    _Thread_Wait_acquire( the_thread, &queue_context );
+    scheduler = _Thread_Scheduler_get_home( the_thread );
+    real_priority = the_thread->Real_priority.priority;
+    priority = _Thread_Get_priority( the_thread );
+    _Thread_Wait_release( the_thread, &queue_context );
+
+    samples[ i ].real_priority =
+      _RTEMS_Priority_From_core( scheduler, real_priority );
+    samples[ i ].priority = _RTEMS_Priority_From_core( scheduler, priority );
+  }
+
+  _Objects_Allocator_unlock();
+  return n;
+}
@@ -76,6 +76,10 @@ typedef struct
   Timestamp_Control      current;           /* Current time run in this period. */
   Timestamp_Control      current_idle;      /* Current time in idle this period. */
   uint32_t               stack_size;        /* Size of stack allocated. */
+  bool                   sampler;           /* The CPU usage sampler is used. */
+  rtems_cpu_usage_sample* samples;          /* The samples of the sampler. */
+  size_t                 sample_size;       /* The size of the samples array. */
+  size_t                 sample_count;      /* Number of samples. */
 } rtems_cpu_usage_data;
 
 /*
@@ -88,6 +92,12 @@ typedef struct
 #define RTEMS_TOP_SORT_CURRENT       (4)
 #define RTEMS_TOP_SORT_MAX           (4)
 
+/*
+ * Refresh period limits in milliseconds.
+ */
+#define RTEMS_TOP_POLL_MIN           (100)
+#define RTEMS_TOP_POLL_MAX           (10000)
+
 static inline bool equal_to_uint32_t( uint32_t * lhs, uint32_t * rhs )
 {
    if ( *lhs == *rhs )
@@ -259,6 +269,168 @@ task_usage(Thread_Control* thread, void* arg)
   return false;
 }
 
+/*
+ * Iterate over all tasks to create the sorted table with the current and
+ * total usage.
+ */
+static bool
+iterate_usage(rtems_cpu_usage_data* data)
+{
+  Timestamp_Control uptime_at_last_reset = CPU_usage_Uptime_at_last_reset;
+  size_t            tasks_size;
+  size_t            usage_size;
+
+  data->task_count = 0;
+  _Thread_Iterate(task_counter, data);
+
+  tasks_size = sizeof(Thread_Control*) * (data->task_count + 1);
+  usage_size = sizeof(Timestamp_Control) * (data->task_count + 1);
+
+  if (data->task_count > data->task_size)
+  {
+    data->tasks = realloc(data->tasks, tasks_size);
+    data->usage = realloc(data->usage, usage_size);
+    data->current_usage = realloc(data->current_usage, usage_size);
+    if ((data->tasks == NULL) || (data->usage == NULL) || (data->current_usage == NULL))
+    {
+      rtems_printf(data->printer, "top worker: error: no memory\n");
+      return false;
+    }
+  }
+
+  memset(data->tasks, 0, tasks_size);
+  memset(data->usage, 0, usage_size);
+  memset(data->current_usage, 0, usage_size);
+
+  _Timestamp_Set_to_zero(&data->total);
+  _Timestamp_Set_to_zero(&data->current);
+  _Timestamp_Set_to_zero(&data->idle);
+  _Timestamp_Set_to_zero(&data->current_idle);
+
+  data->stack_size = 0;
+
+  _TOD_Get_uptime(&data->uptime);
+  _Timestamp_Subtract(&uptime_at_last_reset, &data->uptime, &data->uptime);
+  _Timestamp_Subtract(&data->last_uptime, &data->uptime, &data->period);
+  data->last_uptime = data->uptime;
+
+  _Thread_Iterate(task_usage, data);
+
+  if (data->task_count > data->task_size)
+  {
+    data->last_tasks = realloc(data->last_tasks, tasks_size);
+    data->last_usage = realloc(data->last_usage, usage_size);
+    if ((data->last_tasks == NULL) || (data->last_usage == NULL))
+    {
+      rtems_printf(data->printer, "top worker: error: no memory\n");
+      return false;
+    }
+    data->task_size = data->task_count;
+  }
+
+  memcpy(data->last_tasks, data->tasks, tasks_size);
+  memcpy(data->last_usage, data->usage, usage_size);
+  data->last_task_count = data->task_count;
+
+  return true;
+}
+
+static void
+set_time(Timestamp_Control* time, uint64_t nanoseconds)
+{
+  _Timestamp_Set(time,
+                 nanoseconds / TOD_NANOSECONDS_PER_SECOND,
+                 nanoseconds % TOD_NANOSECONDS_PER_SECOND);
+}
+
+/*
+ * Get the tasks with the highest usage from the CPU usage sampler. Only the
+ * tasks which used a processor since the last sample are visited when
+ * sorting on the current load. Returns false if the sampler cannot provide
+ * the sample.
+ */
+static bool
+sample_usage(rtems_cpu_usage_data* data)
+{
+  rtems_cpu_usage_summary summary;
+  rtems_status_code       sc;
+  size_t                  count;
+
+  sc = rtems_cpu_usage_sampler_update(&summary);
+  if (sc != RTEMS_SUCCESSFUL)
+    return false;
+
+  count = summary.threads;
+  if (data->single_page && (data->show != 0) && (data->show < count))
+    count = data->show;
+
+  if (count > data->sample_size)
+  {
+    rtems_cpu_usage_sample* samples;
+    samples = realloc(data->samples, count * sizeof(*samples));
+    if (samples == NULL)
+    {
+      rtems_printf(data->printer, "top worker: error: no memory\n");
+      data->thread_run = false;
+      return false;
+    }
+    data->samples = samples;
+    data->sample_size = count;
+  }
+
+  data->sample_count =
+    rtems_cpu_usage_sampler_top(data->samples, count,
+                                data->sort_order == RTEMS_TOP_SORT_TOTAL);
+
+  data->task_count = summary.threads;
+  data->stack_size = summary.stack_size;
+
+  set_time(&data->uptime, summary.uptime);
+  set_time(&data->period, summary.period);
+  set_time(&data->total, summary.total);
+  set_time(&data->idle, summary.idle);
+  set_time(&data->current, summary.current);
+  set_time(&data->current_idle, summary.current_idle);
+  data->last_uptime = data->uptime;
+
+  /*
+   * The next iterate restarts with all tasks.
+   */
+  data->last_task_count = 0;
+
+  return true;
+}
+
+static void
+print_task(rtems_cpu_usage_data*    data,
+           rtems_id                 id,
+           const char*              name,
+           rtems_task_priority      real_priority,
+           rtems_task_priority      priority,
+           const Timestamp_Control* usage,
+           const Timestamp_Control* current_usage)
+{
+  uint32_t ival, fval;
+
+  rtems_printf(data->printer,
+               " 0x%08" PRIx32 " | %-19s |  %3" PRId32 " |  %3" PRId32 "   | ",
+               id,
+               name,
+               real_priority,
+               priority);
+
+  /*
+   * Print the information
+   */
+  print_time(data, usage, 19);
+  _Timestamp_Divide(usage, &data->total, &ival, &fval);
+  rtems_printf(data->printer,
+               " |%4" PRIu32 ".%03" PRIu32, ival, fval);
+  _Timestamp_Divide(current_usage, &data->period, &ival, &fval);
+  rtems_printf(data->printer,
+               " |%4" PRIu32 ".%03" PRIu32 "\n", ival, fval);
+}
+
 /*
  * rtems_cpuusage_top_thread
  *
@@ -284,66 +456,26 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
 
   CPU_usage_Set_to_zero(&data->zero);
 
+  /*
+   * The sampler is shared, another top may be using it.
+   */
+  data->sampler = rtems_cpu_usage_sampler_create() == RTEMS_SUCCESSFUL;
+
   while (data->thread_run)
   {
-    Timestamp_Control uptime_at_last_reset = CPU_usage_Uptime_at_last_reset;
-    size_t            tasks_size;
-    size_t            usage_size;
     Timestamp_Control load;
+    bool              sampled = false;
 
-    data->task_count = 0;
-    _Thread_Iterate(task_counter, data);
+    if (data->sampler &&
+        ((data->sort_order == RTEMS_TOP_SORT_CURRENT) ||
+         (data->sort_order == RTEMS_TOP_SORT_TOTAL)))
+      sampled = sample_usage(data);
 
-    tasks_size = sizeof(Thread_Control*) * (data->task_count + 1);
-    usage_size = sizeof(Timestamp_Control) * (data->task_count + 1);
+    if (!sampled && !iterate_usage(data))
+      data->thread_run = false;
 
-    if (data->task_count > data->task_size)
-    {
-      data->tasks = realloc(data->tasks, tasks_size);
-      data->usage = realloc(data->usage, usage_size);
-      data->current_usage = realloc(data->current_usage, usage_size);
-      if ((data->tasks == NULL) || (data->usage == NULL) || (data->current_usage == NULL))
-      {
-        rtems_printf(data->printer, "top worker: error: no memory\n");
-        data->thread_run = false;
-        break;
-      }
-    }
-
-    memset(data->tasks, 0, tasks_size);
-    memset(data->usage, 0, usage_size);
-    memset(data->current_usage, 0, usage_size);
-
-    _Timestamp_Set_to_zero(&data->total);
-    _Timestamp_Set_to_zero(&data->current);
-    _Timestamp_Set_to_zero(&data->idle);
-    _Timestamp_Set_to_zero(&data->current_idle);
-
-    data->stack_size = 0;
-
-    _TOD_Get_uptime(&data->uptime);
-    _Timestamp_Subtract(&uptime_at_last_reset, &data->uptime, &data->uptime);
-    _Timestamp_Subtract(&data->last_uptime, &data->uptime, &data->period);
-    data->last_uptime = data->uptime;
-
-    _Thread_Iterate(task_usage, data);
-
-    if (data->task_count > data->task_size)
-    {
-      data->last_tasks = realloc(data->last_tasks, tasks_size);
-      data->last_usage = realloc(data->last_usage, usage_size);
-      if ((data->last_tasks == NULL) || (data->last_usage == NULL))
-      {
-        rtems_printf(data->printer, "top worker: error: no memory\n");
-        data->thread_run = false;
-        break;
-      }
-      data->task_size = data->task_count;
-    }
-
-    memcpy(data->last_tasks, data->tasks, tasks_size);
-    memcpy(data->last_usage, data->usage, usage_size);
-    data->last_task_count = data->task_count;
+    if (!data->thread_run)
+      break;
 
     /*
      * We need to loop again to get suitable current usage values as we need a
@@ -362,7 +494,7 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
       rtems_printf(data->printer,
                    "\x1b[H\x1b[J"
                    " ENTER:Exit  SPACE:Refresh"
-                   "  S:Scroll  A:All  <>:Order  +/-:Lines\n");
+                   "  S:Scroll  A:All  <>:Order  +/-:Lines  []:Rate\n");
     rtems_printf(data->printer, "\n");
 
     /*
@@ -425,11 +557,30 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
 
     task_count = 0;
 
-    for (i = 0; i < data->task_count; i++)
+    if (sampled)
+    {
+      for (i = 0; i < (int) data->sample_count; i++)
+      {
+        const rtems_cpu_usage_sample* sample = &data->samples[i];
+        Timestamp_Control             usage;
+        Timestamp_Control             current_usage;
+
+        ++task_count;
+
+        rtems_object_get_name(sample->id, sizeof(name), name);
+
+        set_time(&usage, sample->total);
+        set_time(&current_usage, sample->current);
+
+        print_task(data, sample->id, name,
+                   sample->real_priority, sample->priority,
+                   &usage, &current_usage);
+      }
+    }
+
+    for (i = 0; !sampled && (i < data->task_count); i++)
     {
       Thread_Control*          thread = data->tasks[i];
-      Timestamp_Control        usage;
-      Timestamp_Control        current_usage;
       Thread_queue_Context     queue_context;
       const Scheduler_Control *scheduler;
       Priority_Control         real_priority;
@@ -461,26 +612,10 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
       priority = _Thread_Get_priority(thread);
       _Thread_Wait_release(thread, &queue_context);
 
-      rtems_printf(data->printer,
-                   " 0x%08" PRIx32 " | %-19s |  %3" PRId32 " |  %3" PRId32 "   | ",
-                   thread->Object.id,
-                   name,
-                   _RTEMS_Priority_From_core(scheduler, real_priority),
-                   _RTEMS_Priority_From_core(scheduler, priority));
-
-      usage = data->usage[i];
-      current_usage = data->current_usage[i];
-
-      /*
-       * Print the information
-       */
-      print_time(data, &usage, 19);
-      _Timestamp_Divide(&usage, &data->total, &ival, &fval);
-      rtems_printf(data->printer,
-                   " |%4" PRIu32 ".%03" PRIu32, ival, fval);
-      _Timestamp_Divide(&current_usage, &data->period, &ival, &fval);
-      rtems_printf(data->printer,
-                   " |%4" PRIu32 ".%03" PRIu32 "\n", ival, fval);
+      print_task(data, thread->Object.id, name,
+                 _RTEMS_Priority_From_core(scheduler, real_priority),
+                 _RTEMS_Priority_From_core(scheduler, priority),
+                 &data->usage[i], &data->current_usage[i]);
     }
 
     if (data->single_page && (data->show != 0) && (task_count < data->show))
@@ -509,6 +644,10 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
   free(data->last_tasks);
   free(data->last_usage);
   free(data->current_usage);
+  free(data->samples);
+
+  if (data->sampler)
+    rtems_cpu_usage_sampler_delete();
 
   data->thread_active = false;
 
@@ -627,6 +766,22 @@ void rtems_cpu_usage_top_with_plugin(
       if (data.show != 0)
         data.show = show_lines;
     }
+    else if (c == '[')
+    {
+      if (data.poll_rate_usecs > RTEMS_TOP_POLL_MIN)
+        data.poll_rate_usecs /= 2;
+      if (data.poll_rate_usecs < RTEMS_TOP_POLL_MIN)
+        data.poll_rate_usecs = RTEMS_TOP_POLL_MIN;
+      rtems_event_send(id, RTEMS_EVENT_1);
+    }
+    else if (c == ']')
+    {
+      if (data.poll_rate_usecs < RTEMS_TOP_POLL_MAX)
+        data.poll_rate_usecs *= 2;
+      if (data.poll_rate_usecs > RTEMS_TOP_POLL_MAX)
+        data.poll_rate_usecs = RTEMS_TOP_POLL_MAX;
+      rtems_event_send(id, RTEMS_EVENT_1);
+    }
     else if (c == ' ')
     {
       rtems_event_send(id, RTEMS_EVENT_1);
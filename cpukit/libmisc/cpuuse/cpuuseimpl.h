@@ -10,6 +10,7 @@
 #ifndef __RTEMS_CPUUSEIMPL_h
 #define __RTEMS_CPUUSEIMPL_h
 
+#include <rtems/score/thread.h>
 #include <rtems/score/timestamp.h>
 
 #ifdef __cplusplus
@@ -18,6 +19,18 @@ extern "C" {
 
 extern Timestamp_Control CPU_usage_Uptime_at_last_reset;
 
+/*
+ * The performance counters are placed in the thread control block by the
+ * application configuration only if CONFIGURE_CPU_USAGE_COUNTERS is defined.
+ */
+static inline Thread_Performance_counters *CPU_usage_Get_performance_counters(
+  Thread_Control *the_thread
+)
+{
+  return (Thread_Performance_counters *)
+    ( (char *) the_thread + _Thread_Performance_counters_offset );
+}
+
 #ifdef __cplusplus
 }
 #endif
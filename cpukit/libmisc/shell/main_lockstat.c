@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/profiling.h>
+#include <rtems/shell.h>
+#include <rtems/shellconfig.h>
+
+#define LOCKSTAT_DEFAULT_COUNT 10
+
+#define LOCKSTAT_MAXIMUM_COUNT 32
+
+typedef struct {
+  rtems_profiling_object top[ LOCKSTAT_MAXIMUM_COUNT ];
+  char                   names[ LOCKSTAT_MAXIMUM_COUNT ][ 16 ];
+  size_t                 count;
+  size_t                 maximum;
+  size_t                 objects;
+  uint64_t               overflow_count;
+} lockstat_context;
+
+static bool lockstat_is_less(
+  const rtems_profiling_object *a,
+  const rtems_profiling_object *b
+)
+{
+  if ( a->contention_count != b->contention_count ) {
+    return a->contention_count < b->contention_count;
+  }
+
+  return a->total_wait_time < b->total_wait_time;
+}
+
+static void lockstat_visitor( void *arg, const rtems_profiling_data *data )
+{
+  lockstat_context             *ctx;
+  const rtems_profiling_object *object;
+  size_t                        i;
+
+  ctx = arg;
+
+  if ( data->header.type == RTEMS_PROFILING_OBJECT_OVERFLOW ) {
+    ctx->overflow_count = data->object_overflow.overflow_count;
+    return;
+  }
+
+  if ( data->header.type != RTEMS_PROFILING_OBJECT ) {
+    return;
+  }
+
+  object = &data->object;
+  ++ctx->objects;
+
+  if (
+    ctx->count == ctx->maximum
+      && !lockstat_is_less( &ctx->top[ ctx->count - 1 ], object )
+  ) {
+    return;
+  }
+
+  if ( ctx->count < ctx->maximum ) {
+    ++ctx->count;
+  }
+
+  /* Insert into the descending top list, the names are copied */
+  i = ctx->count - 1;
+
+  while ( i > 0 && lockstat_is_less( &ctx->top[ i - 1 ], object ) ) {
+    ctx->top[ i ] = ctx->top[ i - 1 ];
+    memcpy( ctx->names[ i ], ctx->names[ i - 1 ], sizeof( ctx->names[ i ] ) );
+    --i;
+  }
+
+  ctx->top[ i ] = *object;
+
+  if ( object->name != NULL ) {
+    strlcpy( ctx->names[ i ], object->name, sizeof( ctx->names[ i ] ) );
+  } else {
+    snprintf( ctx->names[ i ], sizeof( ctx->names[ i ] ), "%p", object->object );
+  }
+}
+
+static int rtems_shell_main_lockstat( int argc, char **argv )
+{
+  lockstat_context *ctx;
+  size_t            i;
+
+  ctx = calloc( 1, sizeof( *ctx ) );
+  if ( ctx == NULL ) {
+    fprintf( stderr, "lockstat: not enough memory\n" );
+    return 1;
+  }
+
+  ctx->maximum = LOCKSTAT_DEFAULT_COUNT;
+
+  if ( argc > 1 ) {
+    unsigned long count;
+    char         *end;
+
+    count = strtoul( argv[ 1 ], &end, 0 );
+
+    if (
+      argc > 2 || *end != '\0' || count == 0 || count > LOCKSTAT_MAXIMUM_COUNT
+    ) {
+      fprintf(
+        stderr,
+        "lockstat: invalid count, expected 1 to %i\n",
+        LOCKSTAT_MAXIMUM_COUNT
+      );
+      free( ctx );
+      return 1;
+    }
+
+    ctx->maximum = count;
+  }
+
+  rtems_profiling_iterate( lockstat_visitor, ctx );
+
+  if ( ctx->overflow_count != 0 ) {
+    printf(
+      "lockstat: statistics table full, %" PRIu64
+        " acquire operations not recorded\n",
+      ctx->overflow_count
+    );
+  }
+
+  if ( ctx->objects == 0 ) {
+    printf( "lockstat: no object statistics available\n" );
+    free( ctx );
+    return 0;
+  }
+
+  printf(
+    "ID         | NAME             | ACQUIRE    | CONTENDED  |"
+      " WAIT MAX/AVG [us]     | HOLD MAX [us]\n"
+  );
+
+  for ( i = 0; i < ctx->count; ++i ) {
+    const rtems_profiling_object *object;
+    uint64_t                      mean_wait_time;
+
+    object = &ctx->top[ i ];
+
+    if ( object->contention_count != 0 ) {
+      mean_wait_time = object->total_wait_time / object->contention_count;
+    } else {
+      mean_wait_time = 0;
+    }
+
+    printf(
+      "0x%08" PRIx32 " | %-16s | %10" PRIu64 " | %10" PRIu64
+        " | %10" PRIu32 "/%-10" PRIu64 " | %10" PRIu32 "\n",
+      object->id,
+      ctx->names[ i ],
+      object->acquire_count,
+      object->contention_count,
+      object->max_wait_time / 1000,
+      mean_wait_time / 1000,
+      object->max_hold_time / 1000
+    );
+  }
+
+  free( ctx );
+  return 0;
+}
+
+rtems_shell_cmd_t rtems_shell_LOCKSTAT_Command = {
+  .name = "lockstat",
+  .usage = "lockstat [COUNT]",
+  .topic = "rtems",
+  .command = rtems_shell_main_lockstat
+};
@@ -66,6 +66,12 @@
  */
 static bool Stack_check_Initialized;
 
+/*
+ *  Variable to indicate that the task stacks are not filled with the
+ *  pattern and the stack usage is tracked in the task control block.
+ */
+static bool Stack_check_Watermark;
+
 /*
  *  The "magic pattern" used to mark the end of the stack.
  */
@@ -172,6 +178,98 @@ static bool Stack_check_Is_sanity_pattern_valid( const Stack_Control *stack )
   ) == 0;
 }
 
+/*
+ *  In the watermark mode a guard word is placed in each stride of the stack
+ *  instead of filling the entire stack.  The guard word of a stride is
+ *  placed at its end farthest away from the stack start.
+ */
+#define WATERMARK_STRIDE RTEMS_STACK_CHECKER_WATERMARK_STRIDE
+
+#if (CPU_STACK_GROWS_UP == TRUE)
+  #define Stack_check_Get_guard( _the_stack, _depth ) \
+    ((uint32_t *) RTEMS_ALIGN_DOWN( \
+      (uintptr_t) (_the_stack)->area + (_depth) - sizeof(uint32_t), \
+      sizeof(uint32_t) ))
+#else
+  #define Stack_check_Get_guard( _the_stack, _depth ) \
+    ((uint32_t *) RTEMS_ALIGN_UP( \
+      (uintptr_t) (_the_stack)->area + (_the_stack)->size - (_depth), \
+      sizeof(uint32_t) ))
+#endif
+
+static void Stack_check_Add_guards( Stack_Control *stack )
+{
+  size_t size;
+  size_t depth;
+
+  size = Stack_check_Usable_stack_size( stack );
+
+  for ( depth = WATERMARK_STRIDE; depth <= size; depth += WATERMARK_STRIDE ) {
+    *Stack_check_Get_guard( stack, depth ) = U32_PATTERN;
+  }
+}
+
+/*
+ *  The watermark control is placed in the thread control block by the
+ *  application configuration only in the watermark mode.
+ */
+static Thread_Stack_check_control *Stack_check_Get_control(
+  Thread_Control *the_thread
+)
+{
+  _Assert( _Thread_Stack_check_offset != 0 );
+  return (Thread_Stack_check_control *)
+    ( (char *) the_thread + _Thread_Stack_check_offset );
+}
+
+/*
+ *  Update the stack usage of the thread with a stack pointer of the thread
+ *  and the guard words.  Only the guard word of the stride following the
+ *  current usage is checked, so each guard word is visited once on average.
+ */
+static size_t Stack_check_Update_watermark(
+  Thread_Control *the_thread,
+  const void     *sp
+)
+{
+  Thread_Stack_check_control *control;
+  const Stack_Control        *stack;
+  size_t                      size;
+  size_t                      used;
+  size_t                      depth;
+
+  control = Stack_check_Get_control( the_thread );
+  stack = &the_thread->Start.Initial_stack;
+  size = Stack_check_Usable_stack_size( stack );
+  used = control->used;
+
+  if ( sp != NULL ) {
+    size_t sp_used;
+
+    sp_used = (size_t) Stack_check_Calculate_used(
+      Stack_check_Usable_stack_start( stack ),
+      size,
+      sp
+    );
+
+    if ( sp_used > used && sp_used <= size ) {
+      used = sp_used;
+    }
+  }
+
+  depth = RTEMS_ALIGN_DOWN( used, WATERMARK_STRIDE ) + WATERMARK_STRIDE;
+
+  while (
+    depth <= size && *Stack_check_Get_guard( stack, depth ) != U32_PATTERN
+  ) {
+    used = depth;
+    depth += WATERMARK_STRIDE;
+  }
+
+  control->used = used;
+  return used;
+}
+
 /*
  *  rtems_stack_checker_create_extension
  */
@@ -188,6 +286,21 @@ bool rtems_stack_checker_create_extension(
   return true;
 }
 
+bool rtems_stack_checker_watermark_create_extension(
+  Thread_Control *running RTEMS_UNUSED,
+  Thread_Control *the_thread
+)
+{
+  Stack_check_Initialized = true;
+  Stack_check_Watermark = true;
+
+  Stack_check_Get_control( the_thread )->used = 0;
+  Stack_check_Add_guards( &the_thread->Start.Initial_stack );
+  Stack_check_Add_sanity_pattern( &the_thread->Start.Initial_stack );
+
+  return true;
+}
+
 void rtems_stack_checker_begin_extension( Thread_Control *executing )
 {
   Per_CPU_Control *cpu_self;
@@ -342,6 +455,24 @@ void rtems_stack_checker_switch_extension(
   }
 }
 
+void rtems_stack_checker_watermark_switch_extension(
+  Thread_Control *running,
+  Thread_Control *heir
+)
+{
+  rtems_stack_checker_switch_extension( running, heir );
+
+  /*
+   *  The extension runs on the stack of the heir in SMP configurations and
+   *  on the stack of the thread switched out otherwise.
+   */
+#if defined(RTEMS_SMP)
+  Stack_check_Update_watermark( heir, __builtin_frame_address( 0 ) );
+#else
+  Stack_check_Update_watermark( running, __builtin_frame_address( 0 ) );
+#endif
+}
+
 /*
  *  Check if blown
  */
@@ -397,16 +528,9 @@ static inline void *Stack_check_Find_high_water_mark(
   return (void *)0;
 }
 
-static bool Stack_check_Dump_stack_usage(
-  const Stack_Control *stack,
-  const void          *current,
-  const char          *name,
-  uint32_t             id,
-  const rtems_printer *printer
-)
+static uint32_t Stack_check_Get_used( const Stack_Control *stack )
 {
   uint32_t  size;
-  uint32_t  used;
   void     *low;
   void     *high_water_mark;
 
@@ -416,9 +540,40 @@ static bool Stack_check_Dump_stack_usage(
   high_water_mark = Stack_check_Find_high_water_mark(low, size);
 
   if ( high_water_mark )
-    used = Stack_check_Calculate_used( low, size, high_water_mark );
-  else
-    used = 0;
+    return Stack_check_Calculate_used( low, size, high_water_mark );
+
+  return 0;
+}
+
+static uint32_t Stack_check_Get_thread_used( Thread_Control *the_thread )
+{
+  const void *sp;
+
+  if ( !Stack_check_Watermark ) {
+    return Stack_check_Get_used( &the_thread->Start.Initial_stack );
+  }
+
+  if ( _Thread_Is_executing( the_thread ) ) {
+    sp = __builtin_frame_address( 0 );
+  } else {
+    sp = NULL;
+  }
+
+  return Stack_check_Update_watermark( the_thread, sp );
+}
+
+static bool Stack_check_Dump_stack_usage(
+  const Stack_Control *stack,
+  uint32_t             used,
+  const void          *current,
+  const char          *name,
+  uint32_t             id,
+  const rtems_printer *printer
+)
+{
+  uint32_t  size;
+
+  size = Stack_check_Usable_stack_size(stack);
 
   rtems_printf(
     printer,
@@ -452,6 +607,7 @@ static bool Stack_check_Dump_threads_usage(
   _Thread_Get_name( the_thread, name, sizeof( name ) );
   Stack_check_Dump_stack_usage(
     &the_thread->Start.Initial_stack,
+    Stack_check_Get_thread_used( the_thread ),
     (void *) _CPU_Context_Get_SP( &the_thread->Registers ),
     name,
     the_thread->Object.id,
@@ -468,6 +624,7 @@ static void Stack_check_Dump_interrupt_stack_usage(
 {
   Stack_check_Dump_stack_usage(
     stack,
+    Stack_check_Get_used( stack ),
     NULL,
     "Interrupt Stack",
     id,
@@ -509,6 +666,44 @@ void rtems_stack_checker_report_usage_with_plugin(
   }
 }
 
+rtems_status_code rtems_stack_checker_get_usage(
+  rtems_id  id,
+  size_t   *used,
+  size_t   *size
+)
+{
+  Thread_Control   *the_thread;
+  ISR_lock_Context  lock_context;
+
+  if ( used == NULL || size == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( !Stack_check_Initialized ) {
+    return RTEMS_NOT_CONFIGURED;
+  }
+
+  _Objects_Allocator_lock();
+  the_thread = _Thread_Get( id, &lock_context );
+
+  if ( the_thread == NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_INVALID_ID;
+  }
+
+  /*
+   *  The stack may be scanned, so enable the interrupts.  The allocator lock
+   *  prevents that the thread and its stack are freed.
+   */
+  _ISR_lock_ISR_enable( &lock_context );
+
+  *used = Stack_check_Get_thread_used( the_thread );
+  *size = Stack_check_Usable_stack_size( &the_thread->Start.Initial_stack );
+
+  _Objects_Allocator_unlock();
+  return RTEMS_SUCCESSFUL;
+}
+
 void rtems_stack_checker_report_usage( void )
 {
   rtems_printer printer;
@@ -0,0 +1,204 @@
+/**
+ * @file
+ *
+ * @brief Untar an Image with an Extractor Task
+ *
+ * @ingroup libmisc_untar_img Untar Image
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <rtems/untar.h>
+
+/*
+ * The producer, for example a decompressor, fills the buffers and the
+ * extractor task processes them with Untar_FromChunk_Print() in the order
+ * they are filled. The empty semaphore counts the buffers the producer can
+ * fill and the full semaphore counts the buffers the extractor task can
+ * process. A buffer with a length of zero ends the extraction.
+ */
+
+static unsigned char *Untar_Pipe_Buffer(
+  const Untar_PipeContext *ctx,
+  size_t index
+)
+{
+  return &ctx->buffers[index * ctx->buffer_size];
+}
+
+static rtems_task Untar_Pipe_Task(rtems_task_argument arg)
+{
+  Untar_PipeContext *ctx = (Untar_PipeContext *) arg;
+
+  while (true) {
+    size_t index;
+    size_t length;
+
+    rtems_counting_semaphore_wait(&ctx->full);
+
+    index = ctx->consumer;
+    length = ctx->lengths[index];
+    ctx->consumer = (index + 1) % ctx->buffer_count;
+
+    if (length == 0) {
+      break;
+    }
+
+    /*
+     * Keep consuming the buffers after an error so the producer does not
+     * block. The producer stops when it sees the error.
+     */
+    if (ctx->status == UNTAR_SUCCESSFUL) {
+      ctx->status = Untar_FromChunk_Print(
+        &ctx->base,
+        Untar_Pipe_Buffer(ctx, index),
+        length,
+        ctx->printer
+      );
+    }
+
+    rtems_counting_semaphore_post(&ctx->empty);
+  }
+
+  if (ctx->base.out_fd >= 0) {
+    close(ctx->base.out_fd);
+    ctx->base.out_fd = -1;
+  }
+
+  rtems_binary_semaphore_post(&ctx->done);
+  rtems_task_exit();
+}
+
+int Untar_PipeContext_Init(
+  Untar_PipeContext *ctx,
+  size_t buffer_size,
+  size_t buffer_count,
+  rtems_task_priority priority,
+  const rtems_printer *printer
+)
+{
+  rtems_status_code sc;
+
+  if (buffer_size == 0 || buffer_count == 0) {
+    return UNTAR_FAIL;
+  }
+
+  Untar_ChunkContext_Init(&ctx->base);
+  ctx->buffer_size = buffer_size;
+  ctx->buffer_count = buffer_count;
+  ctx->producer = 0;
+  ctx->consumer = 0;
+  ctx->status = UNTAR_SUCCESSFUL;
+  ctx->printer = printer;
+
+  ctx->lengths = calloc(buffer_count, sizeof(ctx->lengths[0]));
+  ctx->buffers = malloc(buffer_count * buffer_size);
+  if (ctx->lengths == NULL || ctx->buffers == NULL) {
+    free(ctx->lengths);
+    free(ctx->buffers);
+    return UNTAR_FAIL;
+  }
+
+  if (priority == RTEMS_CURRENT_PRIORITY) {
+    sc = rtems_task_set_priority(RTEMS_SELF, RTEMS_CURRENT_PRIORITY, &priority);
+    if (sc != RTEMS_SUCCESSFUL) {
+      free(ctx->lengths);
+      free(ctx->buffers);
+      return UNTAR_FAIL;
+    }
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name('U', 'T', 'A', 'R'),
+    priority,
+    2 * RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->task
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    rtems_printf(printer, "untar: pipe: task create: %s\n",
+                 rtems_status_text(sc));
+    free(ctx->lengths);
+    free(ctx->buffers);
+    return UNTAR_FAIL;
+  }
+
+  rtems_counting_semaphore_init(&ctx->empty, "UntarEmpty", buffer_count);
+  rtems_counting_semaphore_init(&ctx->full, "UntarFull", 0);
+  rtems_binary_semaphore_init(&ctx->done, "UntarDone");
+
+  sc = rtems_task_start(ctx->task, Untar_Pipe_Task, (rtems_task_argument) ctx);
+  if (sc != RTEMS_SUCCESSFUL) {
+    rtems_task_delete(ctx->task);
+    rtems_counting_semaphore_destroy(&ctx->empty);
+    rtems_counting_semaphore_destroy(&ctx->full);
+    rtems_binary_semaphore_destroy(&ctx->done);
+    free(ctx->lengths);
+    free(ctx->buffers);
+    return UNTAR_FAIL;
+  }
+
+  return UNTAR_SUCCESSFUL;
+}
+
+void *Untar_Pipe_Obtain(Untar_PipeContext *ctx)
+{
+  rtems_counting_semaphore_wait(&ctx->empty);
+
+  if (ctx->status != UNTAR_SUCCESSFUL) {
+    rtems_counting_semaphore_post(&ctx->empty);
+    return NULL;
+  }
+
+  return Untar_Pipe_Buffer(ctx, ctx->producer);
+}
+
+void Untar_Pipe_Release(Untar_PipeContext *ctx, size_t length)
+{
+  /*
+   * An empty buffer would end the extraction, give it back to the producer.
+   */
+  if (length == 0) {
+    rtems_counting_semaphore_post(&ctx->empty);
+    return;
+  }
+
+  ctx->lengths[ctx->producer] = length;
+  ctx->producer = (ctx->producer + 1) % ctx->buffer_count;
+  rtems_counting_semaphore_post(&ctx->full);
+}
+
+int Untar_PipeContext_Finish(Untar_PipeContext *ctx)
+{
+  int status;
+
+  rtems_counting_semaphore_wait(&ctx->empty);
+  ctx->lengths[ctx->producer] = 0;
+  rtems_counting_semaphore_post(&ctx->full);
+
+  rtems_binary_semaphore_wait(&ctx->done);
+
+  status = ctx->status;
+
+  rtems_counting_semaphore_destroy(&ctx->empty);
+  rtems_counting_semaphore_destroy(&ctx->full);
+  rtems_binary_semaphore_destroy(&ctx->done);
+  free(ctx->lengths);
+  free(ctx->buffers);
+
+  return status;
+}
@@ -91,3 +91,58 @@ int Untar_FromGzChunk_Print(
 }
 
 
+
+int Untar_FromGzMemory_Pipe(
+  Untar_PipeContext *ctx,
+  const void *tgz,
+  size_t size
+)
+{
+  z_stream strm;
+  int untar_status = UNTAR_SUCCESSFUL;
+  int status;
+
+  memset(&strm, 0, sizeof(strm));
+  status = inflateInit2(&strm, 32 + MAX_WBITS);
+  if (status != Z_OK) {
+    Untar_PipeContext_Finish(ctx);
+    return UNTAR_FAIL;
+  }
+
+  strm.next_in = (Bytef *) tgz;
+  strm.avail_in = size;
+
+  /* Inflate into the pipe's buffers until the end of the stream */
+  do {
+    void *buffer = Untar_Pipe_Obtain(ctx);
+
+    if (buffer == NULL) {
+      break;
+    }
+
+    strm.next_out = (Bytef *) buffer;
+    strm.avail_out = ctx->buffer_size;
+
+    status = inflate(&strm, Z_NO_FLUSH);
+    Untar_Pipe_Release(ctx, ctx->buffer_size - strm.avail_out);
+  } while (status == Z_OK);
+
+  if (status != Z_STREAM_END && status != Z_OK) {
+    rtems_printf(ctx->printer, "Zlib inflate failed\n");
+    untar_status = UNTAR_GZ_INFLATE_FAILED;
+  }
+
+  if (inflateEnd(&strm) != Z_OK) {
+    rtems_printf(ctx->printer, "Zlib inflate end failed\n");
+    if (untar_status == UNTAR_SUCCESSFUL) {
+      untar_status = UNTAR_GZ_INFLATE_END_FAILED;
+    }
+  }
+
+  status = Untar_PipeContext_Finish(ctx);
+  if (untar_status == UNTAR_SUCCESSFUL) {
+    untar_status = status;
+  }
+
+  return untar_status;
+}
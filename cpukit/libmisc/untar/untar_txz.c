@@ -107,3 +107,59 @@ int Untar_FromXzChunk_Print(
 
   return untar_status;
 }
+
+int Untar_FromXzMemory_Pipe(
+  Untar_PipeContext *ctx,
+  const void *txz,
+  size_t size,
+  uint32_t dict_max
+)
+{
+  struct xz_dec *strm;
+  struct xz_buf buf;
+  int untar_status = UNTAR_SUCCESSFUL;
+  enum xz_ret status = XZ_OK;
+
+  xz_crc32_init();
+
+  strm = xz_dec_init(XZ_DYNALLOC, dict_max);
+  if (strm == NULL) {
+    Untar_PipeContext_Finish(ctx);
+    return UNTAR_FAIL;
+  }
+
+  buf.in = (const uint8_t *) txz;
+  buf.in_pos = 0;
+  buf.in_size = size;
+
+  /* Decompress into the pipe's buffers until the end of the stream */
+  do {
+    void *buffer = Untar_Pipe_Obtain(ctx);
+
+    if (buffer == NULL) {
+      break;
+    }
+
+    buf.out = (uint8_t *) buffer;
+    buf.out_pos = 0;
+    buf.out_size = ctx->buffer_size;
+
+    status = xz_dec_run(strm, &buf);
+    Untar_Pipe_Release(ctx, buf.out_pos);
+  } while (status == XZ_OK);
+
+  xz_dec_end(strm);
+
+  if (status != XZ_OK && status != XZ_STREAM_END) {
+    rtems_printf(ctx->printer, "XZ decompression failed (%d)\n", status);
+    untar_status = UNTAR_FAIL;
+  }
+
+  if (untar_status == UNTAR_SUCCESSFUL) {
+    untar_status = Untar_PipeContext_Finish(ctx);
+  } else {
+    Untar_PipeContext_Finish(ctx);
+  }
+
+  return untar_status;
+}
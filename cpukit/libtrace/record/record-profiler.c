@@ -0,0 +1,238 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/record.h>
+#include <rtems/config.h>
+#include <rtems/score/apimutex.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/watchdogimpl.h>
+
+typedef struct {
+  uint32_t         interval;
+  unsigned int     depth;
+  Watchdog_Control Watchdogs[ CPU_MAXIMUM_PROCESSORS ];
+} Record_Profiler_control;
+
+static Record_Profiler_control _Record_Profiler;
+
+void rtems_record_profiler_sample_context( uintptr_t pc, uintptr_t fp )
+{
+  rtems_record_item     items[ 1 + RTEMS_RECORD_PROFILER_DEPTH_MAXIMUM ];
+  const Thread_Control *executing;
+  uintptr_t             low;
+  uintptr_t             high;
+  size_t                n;
+  size_t                depth;
+
+  if ( pc == 0 ) {
+    return;
+  }
+
+  items[ 0 ].event = RTEMS_RECORD_SAMPLE_PC;
+  items[ 0 ].data = pc;
+  n = 1;
+  depth = _Record_Profiler.depth;
+
+  /*
+   * Only follow frame records in the stack of the executing thread, so that
+   * a broken frame pointer chain cannot lead to invalid memory accesses.
+   */
+  executing = _Thread_Get_executing();
+  low = (uintptr_t) executing->Start.Initial_stack.area;
+  high = low + executing->Start.Initial_stack.size - 2 * sizeof( uintptr_t );
+
+  while (
+    n <= depth
+      && fp >= low
+      && fp <= high
+      && fp % sizeof( uintptr_t ) == 0
+  ) {
+    const uintptr_t *record;
+    uintptr_t        previous;
+    uintptr_t        return_address;
+
+    record = (const uintptr_t *) fp;
+    previous = record[ 0 ];
+    return_address = record[ 1 ];
+
+    if ( return_address == 0 ) {
+      break;
+    }
+
+    items[ n ].event = RTEMS_RECORD_SAMPLE_CALLER;
+    items[ n ].data = return_address;
+    ++n;
+
+    if ( previous <= fp ) {
+      break;
+    }
+
+    fp = previous;
+  }
+
+  rtems_record_produce_n( items, n );
+}
+
+void rtems_record_profiler_sample( void )
+{
+#if defined(CPU_PROVIDES_INTERRUPTED_CONTEXT) \
+  && CPU_PROVIDES_INTERRUPTED_CONTEXT == TRUE
+  uintptr_t pc;
+  uintptr_t fp;
+
+  _CPU_Get_interrupted_context( &pc, &fp );
+  rtems_record_profiler_sample_context( pc, fp );
+#endif
+}
+
+static void _Record_Profiler_watchdog( Watchdog_Control *watchdog )
+{
+  Per_CPU_Control  *cpu;
+  ISR_lock_Context  lock_context;
+  uint32_t          interval;
+
+  cpu = _Watchdog_Get_CPU( watchdog );
+
+  _ISR_lock_ISR_disable( &lock_context );
+  _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
+
+  /* The interval is checked under the lock, see rtems_record_profiler_stop() */
+  interval = _Record_Profiler.interval;
+
+  if ( interval != 0 ) {
+    _Watchdog_Insert(
+      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
+      watchdog,
+      cpu->Watchdog.ticks + interval
+    );
+  }
+
+  _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
+  _ISR_lock_ISR_enable( &lock_context );
+
+  rtems_record_profiler_sample();
+}
+
+void rtems_record_profiler_start( uint32_t interval, unsigned int depth )
+{
+  Record_Profiler_control *profiler;
+  uint32_t                 cpu_max;
+  uint32_t                 cpu_index;
+
+  if ( interval == 0 ) {
+    interval = 1;
+  }
+
+  if ( depth > RTEMS_RECORD_PROFILER_DEPTH_MAXIMUM ) {
+    depth = RTEMS_RECORD_PROFILER_DEPTH_MAXIMUM;
+  }
+
+  profiler = &_Record_Profiler;
+  _Objects_Allocator_lock();
+
+  profiler->depth = depth;
+
+  if ( profiler->interval != 0 ) {
+    profiler->interval = interval;
+    _Objects_Allocator_unlock();
+    return;
+  }
+
+  profiler->interval = interval;
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control  *cpu;
+    Watchdog_Control *watchdog;
+    ISR_lock_Context  lock_context;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+
+    if ( !_Per_CPU_Is_processor_online( cpu ) ) {
+      continue;
+    }
+
+    watchdog = &profiler->Watchdogs[ cpu_index ];
+    _Watchdog_Preinitialize( watchdog, cpu );
+    _Watchdog_Initialize( watchdog, _Record_Profiler_watchdog );
+
+    _ISR_lock_ISR_disable( &lock_context );
+    _Watchdog_Per_CPU_insert_ticks( watchdog, cpu, interval );
+    _ISR_lock_ISR_enable( &lock_context );
+  }
+
+  _Objects_Allocator_unlock();
+}
+
+void rtems_record_profiler_stop( void )
+{
+  Record_Profiler_control *profiler;
+  uint32_t                 cpu_max;
+  uint32_t                 cpu_index;
+
+  profiler = &_Record_Profiler;
+  _Objects_Allocator_lock();
+
+  if ( profiler->interval == 0 ) {
+    _Objects_Allocator_unlock();
+    return;
+  }
+
+  /*
+   * A watchdog routine running concurrently on another processor checks the
+   * interval while it owns the watchdog lock of its processor.  It either
+   * sees the zero interval or re-inserted its watchdog before we remove it.
+   */
+  profiler->interval = 0;
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control  *cpu;
+    ISR_lock_Context  lock_context;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+
+    if ( !_Per_CPU_Is_processor_online( cpu ) ) {
+      continue;
+    }
+
+    _ISR_lock_ISR_disable( &lock_context );
+    _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
+    _Watchdog_Remove(
+      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
+      &profiler->Watchdogs[ cpu_index ]
+    );
+    _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
+    _ISR_lock_ISR_enable( &lock_context );
+  }
+
+  _Objects_Allocator_unlock();
+}
@@ -226,6 +226,8 @@ static const char * const event_text[] = {
   [ RTEMS_RECORD_RTEMS_TIMER_RESET ] = "RTEMS_TIMER_RESET",
   [ RTEMS_RECORD_RTEMS_TIMER_SERVER_FIRE_AFTER ] = "RTEMS_TIMER_SERVER_FIRE_AFTER",
   [ RTEMS_RECORD_RTEMS_TIMER_SERVER_FIRE_WHEN ] = "RTEMS_TIMER_SERVER_FIRE_WHEN",
+  [ RTEMS_RECORD_SAMPLE_CALLER ] = "SAMPLE_CALLER",
+  [ RTEMS_RECORD_SAMPLE_PC ] = "SAMPLE_PC",
   [ RTEMS_RECORD_SBWAIT_ENTRY ] = "SBWAIT_ENTRY",
   [ RTEMS_RECORD_SBWAIT_EXIT ] = "SBWAIT_EXIT",
   [ RTEMS_RECORD_SBWAKEUP_ENTRY ] = "SBWAKEUP_ENTRY",
@@ -380,8 +382,6 @@ static const char * const event_text[] = {
   [ RTEMS_RECORD_WRITE_EXIT ] = "WRITE_EXIT",
   [ RTEMS_RECORD_WRITEV_ENTRY ] = "WRITEV_ENTRY",
   [ RTEMS_RECORD_WRITEV_EXIT ] = "WRITEV_EXIT",
-  [ RTEMS_RECORD_SYSTEM_341 ] = "SYSTEM_341",
-  [ RTEMS_RECORD_SYSTEM_342 ] = "SYSTEM_342",
   [ RTEMS_RECORD_SYSTEM_343 ] = "SYSTEM_343",
   [ RTEMS_RECORD_SYSTEM_344 ] = "SYSTEM_344",
   [ RTEMS_RECORD_SYSTEM_345 ] = "SYSTEM_345",
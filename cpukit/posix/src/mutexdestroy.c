@@ -41,6 +41,7 @@ int pthread_mutex_destroy(
 
   if ( _POSIX_Mutex_Get_owner( the_mutex ) == NULL ) {
     the_mutex->flags = ~the_mutex->flags;
+    _Thread_queue_Stats_remove_self_contained( the_mutex );
     eno = 0;
   } else {
     eno = EBUSY;
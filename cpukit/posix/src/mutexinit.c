@@ -185,5 +185,6 @@ int pthread_mutex_init(
   the_mutex->Recursive.nest_level = 0;
   _Priority_Node_initialize( &the_mutex->Priority_ceiling, priority );
   the_mutex->scheduler = scheduler;
+  _Thread_queue_Stats_remove_self_contained( the_mutex );
   return 0;
 }
@@ -106,5 +106,14 @@ int _POSIX_Mutex_Lock_support(
       break;
   }
 
+  if ( status == STATUS_SUCCESSFUL ) {
+    _Thread_queue_Stats_acquire_self_contained(
+      &the_mutex->Recursive.Mutex.Queue.Queue,
+      the_mutex,
+      &queue_context,
+      the_mutex->Recursive.nest_level == 0
+    );
+  }
+
   return _POSIX_Get_error( status );
 }
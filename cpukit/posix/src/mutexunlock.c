@@ -88,6 +88,13 @@ int pthread_mutex_unlock(
 
   executing = _POSIX_Mutex_Acquire( the_mutex, &queue_context );
 
+  if (
+    _POSIX_Mutex_Get_owner( the_mutex ) == executing
+      && the_mutex->Recursive.nest_level == 0
+  ) {
+    _Thread_queue_Stats_release_self_contained( the_mutex );
+  }
+
   switch ( _POSIX_Mutex_Get_protocol( flags ) ) {
     case POSIX_MUTEX_PRIORITY_CEILING:
       status = _POSIX_Mutex_Ceiling_surrender(
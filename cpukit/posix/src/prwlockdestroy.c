@@ -45,6 +45,7 @@ int pthread_rwlock_destroy(
    */
 
   the_rwlock->flags = ~the_rwlock->flags;
+  _Thread_queue_Stats_remove_self_contained( the_rwlock );
   _CORE_RWLock_Release( &the_rwlock->RWLock, &queue_context );
   return 0;
 }
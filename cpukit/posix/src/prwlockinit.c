@@ -78,5 +78,6 @@ int pthread_rwlock_init(
 
   the_rwlock->flags = (uintptr_t) the_rwlock ^ POSIX_RWLOCK_MAGIC;
   _CORE_RWLock_Initialize( &the_rwlock->RWLock );
+  _Thread_queue_Stats_remove_self_contained( the_rwlock );
   return 0;
 }
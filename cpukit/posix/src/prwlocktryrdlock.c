@@ -39,5 +39,15 @@ int pthread_rwlock_tryrdlock(
     false,                  /* do not wait for the rwlock */
     &queue_context
   );
+
+  if ( status == STATUS_SUCCESSFUL ) {
+    _Thread_queue_Stats_acquire_self_contained(
+      &the_rwlock->RWLock.Queue.Queue,
+      the_rwlock,
+      &queue_context,
+      false
+    );
+  }
+
   return _POSIX_Get_error( status );
 }
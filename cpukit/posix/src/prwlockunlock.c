@@ -50,6 +50,25 @@ int pthread_rwlock_unlock(
   the_rwlock = _POSIX_RWLock_Get( rwlock );
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
+#if defined(RTEMS_PROFILING)
+  {
+    Thread_queue_Context queue_context;
+
+    /*
+     * Only the writer has a hold time.  The readers share the rwlock, so
+     * there is no hold instant for each reader.
+     */
+    _Thread_queue_Context_initialize( &queue_context );
+    _CORE_RWLock_Acquire( &the_rwlock->RWLock, &queue_context );
+
+    if ( the_rwlock->RWLock.current_state == CORE_RWLOCK_LOCKED_FOR_WRITING ) {
+      _Thread_queue_Stats_release_self_contained( the_rwlock );
+    }
+
+    _CORE_RWLock_Release( &the_rwlock->RWLock, &queue_context );
+  }
+#endif
+
   status = _CORE_RWLock_Surrender( &the_rwlock->RWLock );
   return _POSIX_Get_error( status );
 }
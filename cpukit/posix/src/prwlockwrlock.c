@@ -42,5 +42,15 @@ int pthread_rwlock_wrlock(
     true,          /* do not timeout -- wait forever */
     &queue_context
   );
+
+  if ( status == STATUS_SUCCESSFUL ) {
+    _Thread_queue_Stats_acquire_self_contained(
+      &the_rwlock->RWLock.Queue.Queue,
+      the_rwlock,
+      &queue_context,
+      true
+    );
+  }
+
   return _POSIX_Get_error( status );
 }
@@ -48,6 +48,45 @@ THREAD_QUEUE_OBJECT_ASSERT(
 );
 #endif
 
+#if defined(RTEMS_PROFILING)
+static void _Semaphore_Stats_acquire(
+  Objects_Id                  id,
+  const Thread_Control       *executing,
+  const Thread_queue_Context *queue_context
+)
+{
+  Semaphore_Control    *the_semaphore;
+  Thread_queue_Context  lock_context;
+  Semaphore_Variant     variant;
+
+  /*
+   * The semaphore lock was released by the seize operation, so get the
+   * semaphore again since a counting semaphore may be deleted in the
+   * meantime.
+   */
+  the_semaphore = _Semaphore_Get( id, &lock_context );
+
+  if ( the_semaphore == NULL ) {
+    return;
+  }
+
+  _Thread_queue_Acquire_critical(
+    &the_semaphore->Core_control.Wait_queue,
+    &lock_context
+  );
+  variant = _Semaphore_Get_variant( _Semaphore_Get_flags( the_semaphore ) );
+  _Thread_queue_Stats_acquire(
+    &the_semaphore->Core_control.Wait_queue,
+    queue_context,
+    _Semaphore_Is_owner_not_nested( the_semaphore, variant, executing )
+  );
+  _Thread_queue_Release(
+    &the_semaphore->Core_control.Wait_queue,
+    &lock_context
+  );
+}
+#endif
+
 rtems_status_code rtems_semaphore_obtain(
   rtems_id        id,
   rtems_option    option_set,
@@ -139,5 +178,11 @@ rtems_status_code rtems_semaphore_obtain(
       break;
   }
 
+#if defined(RTEMS_PROFILING)
+  if ( status == STATUS_SUCCESSFUL ) {
+    _Semaphore_Stats_acquire( id, executing, &queue_context );
+  }
+#endif
+
   return _Status_Get( status );
 }
@@ -53,6 +53,22 @@ rtems_status_code rtems_semaphore_release( rtems_id id )
   flags = _Semaphore_Get_flags( the_semaphore );
   variant = _Semaphore_Get_variant( flags );
 
+#if defined(RTEMS_PROFILING)
+  _Thread_queue_Acquire_critical(
+    &the_semaphore->Core_control.Wait_queue,
+    &queue_context
+  );
+
+  if ( _Semaphore_Is_owner_not_nested( the_semaphore, variant, executing ) ) {
+    _Thread_queue_Stats_release( &the_semaphore->Core_control.Wait_queue );
+  }
+
+  _Thread_queue_Release_critical(
+    &the_semaphore->Core_control.Wait_queue,
+    &queue_context
+  );
+#endif
+
   switch ( variant ) {
     case SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY:
       status = _CORE_recursive_mutex_Surrender(
@@ -0,0 +1,65 @@
+/**
+ *  @file
+ *
+ *  @brief RTEMS Task Wake After Nanoseconds
+ *  @ingroup ClassicTasks
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/tasks.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/timecounter.h>
+#include <rtems/score/watchdogimpl.h>
+
+rtems_status_code rtems_task_wake_after_ns(
+  uint64_t nanoseconds
+)
+{
+  Thread_Control  *executing;
+  Per_CPU_Control *cpu_self;
+  struct timespec  end;
+  uint64_t         expire;
+
+  /*
+   * The end is determined by the current uptime and not by the uptime of the
+   * last timecounter windup to get an interval shorter than a clock tick.
+   */
+  _Timecounter_Nanouptime( &end );
+  end.tv_sec += (time_t) ( nanoseconds / WATCHDOG_NANOSECONDS_PER_SECOND );
+  end.tv_nsec += (long) ( nanoseconds % WATCHDOG_NANOSECONDS_PER_SECOND );
+
+  if ( end.tv_nsec >= WATCHDOG_NANOSECONDS_PER_SECOND ) {
+    ++end.tv_sec;
+    end.tv_nsec -= WATCHDOG_NANOSECONDS_PER_SECOND;
+  }
+
+  if ( _Watchdog_Is_far_future_timespec( &end ) ) {
+    expire = WATCHDOG_MAXIMUM_TICKS;
+  } else {
+    expire = _Watchdog_Ticks_from_timespec( &end );
+  }
+
+  cpu_self = _Thread_Dispatch_disable();
+    executing = _Per_CPU_Get_executing( cpu_self );
+
+    if ( nanoseconds == 0 ) {
+      _Thread_Yield( executing );
+    } else {
+      _Thread_Set_state( executing, STATES_WAITING_FOR_TIME );
+      _Thread_Wait_flags_set( executing, THREAD_WAIT_STATE_BLOCKED );
+      _Thread_Add_timeout_monotonic( executing, cpu_self, expire );
+    }
+  _Thread_Dispatch_direct( cpu_self );
+  return RTEMS_SUCCESSFUL;
+}
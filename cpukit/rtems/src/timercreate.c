@@ -36,6 +36,8 @@ RTEMS_STATIC_ASSERT(
 
 Timer_server_Control *volatile _Timer_server;
 
+Timer_server_Control **_Timer_server_Processors;
+
 void _Timer_Routine_adaptor( Watchdog_Control *the_watchdog )
 {
   Timer_Control   *the_timer;
@@ -73,6 +75,10 @@ rtems_status_code _Timer_Fire(
     the_timer->initial = interval;
     the_timer->start_time = _Timer_Get_CPU_ticks( cpu );
 
+    if ( _Timer_Is_on_task_class( the_class ) ) {
+      the_timer->server = _Timer_server_Get( _Per_CPU_Get() );
+    }
+
     if ( _Timer_Is_interval_class( the_class ) ) {
       _Watchdog_Insert(
         &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
@@ -169,7 +175,7 @@ void _Timer_Cancel( Per_CPU_Control *cpu, Timer_Control *the_timer )
     Timer_server_Control *timer_server;
     ISR_lock_Context      lock_context;
 
-    timer_server = _Timer_server;
+    timer_server = the_timer->server;
     _Assert( timer_server != NULL );
     _Timer_server_Acquire_critical( timer_server, &lock_context );
 
@@ -27,10 +27,16 @@
 #endif
 
 #include <rtems.h>
+#include <rtems/counter.h>
 #include <rtems/rtems/timerimpl.h>
 #include <rtems/rtems/tasksimpl.h>
 #include <rtems/score/onceimpl.h>
+#include <rtems/score/smpimpl.h>
 #include <rtems/score/todimpl.h>
+#include <rtems/score/wkspace.h>
+
+#include <limits.h>
+#include <string.h>
 
 static Timer_server_Control _Timer_server_Default;
 
@@ -58,9 +64,9 @@ void _Timer_server_Routine_adaptor( Watchdog_Control *the_watchdog )
   Timer_server_Control *ts;
   bool                  wakeup;
 
-  ts = _Timer_server;
-  _Assert( ts != NULL );
   the_timer = RTEMS_CONTAINER_OF( the_watchdog, Timer_Control, Ticker );
+  ts = the_timer->server;
+  _Assert( ts != NULL );
 
   _Timer_server_Acquire( ts, &lock_context );
 
@@ -68,6 +74,7 @@ void _Timer_server_Routine_adaptor( Watchdog_Control *the_watchdog )
   _Watchdog_Set_state( &the_timer->Ticker, WATCHDOG_PENDING );
   cpu = _Watchdog_Get_CPU( &the_timer->Ticker );
   the_timer->stop_time = _Timer_Get_CPU_ticks( cpu );
+  the_timer->expire_instant = _CPU_Counter_read();
   wakeup = _Chain_Is_empty( &ts->Pending );
   _Chain_Append_unprotected( &ts->Pending, &the_timer->Ticker.Node.Chain );
 
@@ -108,6 +115,9 @@ static rtems_task _Timer_server_Body(
       rtems_timer_service_routine_entry  routine;
       Objects_Id                         id;
       void                              *user_data;
+      CPU_Counter_ticks                  begin;
+      CPU_Counter_ticks                  latency;
+      CPU_Counter_ticks                  runtime;
 
       the_watchdog = (Watchdog_Control *) _Chain_Get_unprotected( &ts->Pending );
       if ( the_watchdog == NULL ) {
@@ -120,6 +130,8 @@ static rtems_task _Timer_server_Body(
       routine = the_timer->routine;
       id = the_timer->Object.id;
       user_data = the_timer->user_data;
+      begin = _CPU_Counter_read();
+      latency = _CPU_Counter_difference( begin, the_timer->expire_instant );
 
       _Timer_server_Release( ts, &lock_context );
 
@@ -127,8 +139,20 @@ static rtems_task _Timer_server_Body(
 #if defined(RTEMS_SCORE_THREAD_ENABLE_RESOURCE_COUNT)
       _Assert( !_Thread_Owns_resources( executing ) );
 #endif
+      runtime = _CPU_Counter_difference( _CPU_Counter_read(), begin );
 
       _Timer_server_Acquire( ts, &lock_context );
+
+      ++ts->Statistics.count;
+      ts->Statistics.total_latency += latency;
+
+      if ( latency > ts->Statistics.max_latency ) {
+        ts->Statistics.max_latency = latency;
+      }
+
+      if ( runtime > ts->Statistics.max_runtime ) {
+        ts->Statistics.max_runtime = runtime;
+      }
     }
 
     _Timer_server_Release( ts, &lock_context );
@@ -142,26 +166,15 @@ static rtems_task _Timer_server_Body(
   }
 }
 
-static rtems_status_code _Timer_server_Initiate(
-  rtems_task_priority priority,
-  size_t              stack_size,
-  rtems_attribute     attribute_set
+static rtems_status_code _Timer_server_Create(
+  Timer_server_Control *ts,
+  rtems_task_priority   priority,
+  size_t                stack_size,
+  rtems_attribute       attribute_set
 )
 {
-  rtems_status_code     status;
-  rtems_id              id;
-  Timer_server_Control *ts;
-
-  /*
-   *  Just to make sure this is only called once.
-   */
-  if ( _Timer_server != NULL ) {
-    return RTEMS_INCORRECT_STATE;
-  }
-
-  if ( priority == RTEMS_TIMER_SERVER_DEFAULT_PRIORITY ) {
-    priority = PRIORITY_PSEUDO_ISR;
-  }
+  rtems_status_code status;
+  rtems_id          id;
 
   /*
    *  Create the Timer Server with the name the name of "TIME".  The attribute
@@ -200,11 +213,53 @@ static rtems_status_code _Timer_server_Initiate(
    *  Timer Server so we do not have to have a critical section.
    */
 
-  ts = &_Timer_server_Default;
   _ISR_lock_Initialize( &ts->Lock, "Timer Server" );
   _Chain_Initialize_empty( &ts->Pending );
+  memset( &ts->Statistics, 0, sizeof( ts->Statistics ) );
   ts->server_id = id;
 
+  return RTEMS_SUCCESSFUL;
+}
+
+static void _Timer_server_Start( Timer_server_Control *ts )
+{
+  rtems_status_code status;
+
+  status = rtems_task_start(
+    ts->server_id,
+    _Timer_server_Body,
+    (rtems_task_argument) ts
+  );
+  _Assert( status == RTEMS_SUCCESSFUL );
+  (void) status;
+}
+
+static rtems_status_code _Timer_server_Initiate(
+  rtems_task_priority priority,
+  size_t              stack_size,
+  rtems_attribute     attribute_set
+)
+{
+  rtems_status_code     status;
+  Timer_server_Control *ts;
+
+  /*
+   *  Just to make sure this is only called once.
+   */
+  if ( _Timer_server != NULL ) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  if ( priority == RTEMS_TIMER_SERVER_DEFAULT_PRIORITY ) {
+    priority = PRIORITY_PSEUDO_ISR;
+  }
+
+  ts = &_Timer_server_Default;
+  status = _Timer_server_Create( ts, priority, stack_size, attribute_set );
+  if ( status != RTEMS_SUCCESSFUL ) {
+    return status;
+  }
+
   /*
    * The default timer server is now available.
    */
@@ -213,14 +268,179 @@ static rtems_status_code _Timer_server_Initiate(
   /*
    *  Start the timer server
    */
-  status = rtems_task_start(
-    id,
-    _Timer_server_Body,
-    (rtems_task_argument) ts
-  );
+  _Timer_server_Start( ts );
+
+  return RTEMS_SUCCESSFUL;
+}
+
+static bool _Timer_server_Is_in_set(
+  uint32_t         cpu_index,
+  size_t           cpusetsize,
+  const cpu_set_t *cpuset
+)
+{
+  return cpu_index < cpusetsize * CHAR_BIT
+    && CPU_ISSET_S( (int) cpu_index, cpusetsize, cpuset )
+    && _Per_CPU_Is_processor_online( _Per_CPU_Get_by_index( cpu_index ) );
+}
+
+static uint64_t _Timer_server_Ticks_to_ns( uint64_t ticks )
+{
+  /*
+   *  Convert in parts to avoid an overflow of the counter ticks type for the
+   *  accumulated latency.
+   */
+  return ( ticks >> 16 ) * rtems_counter_ticks_to_nanoseconds( 1U << 16 )
+    + rtems_counter_ticks_to_nanoseconds( (rtems_counter_ticks) ticks & 0xffff );
+}
+
+static rtems_status_code _Timer_server_Bind(
+  Timer_server_Control *ts,
+  uint32_t              cpu_index,
+  rtems_task_priority   priority
+)
+{
+  rtems_status_code status;
+  rtems_id          scheduler_id;
+  rtems_id          current_scheduler_id;
+  cpu_set_t         cpuset;
+
+  status = rtems_scheduler_ident_by_processor( cpu_index, &scheduler_id );
+  if ( status != RTEMS_SUCCESSFUL ) {
+    return status;
+  }
+
+  status = rtems_task_get_scheduler( ts->server_id, &current_scheduler_id );
   _Assert( status == RTEMS_SUCCESSFUL );
 
-  return status;
+  if ( scheduler_id != current_scheduler_id ) {
+    status = rtems_task_set_scheduler( ts->server_id, scheduler_id, priority );
+    if ( status != RTEMS_SUCCESSFUL ) {
+      return status;
+    }
+  }
+
+  /*
+   *  A scheduler without support for thread processor affinities runs the
+   *  server on any processor it owns, so the server is bound to the scheduler
+   *  instance in this case.
+   */
+  CPU_ZERO( &cpuset );
+  CPU_SET( (int) cpu_index, &cpuset );
+  (void) rtems_task_set_affinity( ts->server_id, sizeof( cpuset ), &cpuset );
+
+  return RTEMS_SUCCESSFUL;
+}
+
+static rtems_status_code _Timer_server_Initiate_set(
+  rtems_task_priority  priority,
+  size_t               stack_size,
+  rtems_attribute      attribute_set,
+  size_t               cpusetsize,
+  const cpu_set_t     *cpuset
+)
+{
+  rtems_status_code      status;
+  uint32_t               cpu_max;
+  uint32_t               cpu_index;
+  uint32_t               count;
+  uint32_t               created;
+  Timer_server_Control  *servers;
+  Timer_server_Control **processors;
+
+  if ( _Timer_server != NULL ) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  if ( cpuset == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  cpu_max = _SMP_Get_processor_maximum();
+  count = 0;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    if ( _Timer_server_Is_in_set( cpu_index, cpusetsize, cpuset ) ) {
+      ++count;
+    }
+  }
+
+  if ( count == 0 ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  if ( priority == RTEMS_TIMER_SERVER_DEFAULT_PRIORITY ) {
+    priority = PRIORITY_PSEUDO_ISR;
+  }
+
+  servers = _Workspace_Allocate( count * sizeof( *servers ) );
+  processors = _Workspace_Allocate( cpu_max * sizeof( *processors ) );
+
+  if ( servers == NULL || processors == NULL ) {
+    _Workspace_Free( servers );
+    _Workspace_Free( processors );
+    return RTEMS_NO_MEMORY;
+  }
+
+  created = 0;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    Timer_server_Control *ts;
+
+    if ( !_Timer_server_Is_in_set( cpu_index, cpusetsize, cpuset ) ) {
+      continue;
+    }
+
+    ts = &servers[ created ];
+    status = _Timer_server_Create( ts, priority, stack_size, attribute_set );
+    if ( status != RTEMS_SUCCESSFUL ) {
+      break;
+    }
+
+    ++created;
+
+    status = _Timer_server_Bind( ts, cpu_index, priority );
+    if ( status != RTEMS_SUCCESSFUL ) {
+      break;
+    }
+
+    processors[ cpu_index ] = ts;
+  }
+
+  if ( status != RTEMS_SUCCESSFUL ) {
+    while ( created > 0 ) {
+      --created;
+      (void) rtems_task_delete( servers[ created ].server_id );
+      _ISR_lock_Destroy( &servers[ created ].Lock );
+    }
+
+    _Workspace_Free( servers );
+    _Workspace_Free( processors );
+    return status;
+  }
+
+  /*
+   *  Timers fired by processors without a timer server are serviced by the
+   *  server of the first processor in the set.
+   */
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    if ( !_Timer_server_Is_in_set( cpu_index, cpusetsize, cpuset ) ) {
+      processors[ cpu_index ] = &servers[ 0 ];
+    }
+  }
+
+  _Timer_server_Processors = processors;
+
+  /*
+   * The timer servers are now available.
+   */
+  _Timer_server = &servers[ 0 ];
+
+  for ( created = 0 ; created < count ; ++created ) {
+    _Timer_server_Start( &servers[ created ] );
+  }
+
+  return RTEMS_SUCCESSFUL;
 }
 
 rtems_status_code rtems_timer_initiate_server(
@@ -238,3 +458,62 @@ rtems_status_code rtems_timer_initiate_server(
 
   return status;
 }
+
+rtems_status_code rtems_timer_initiate_server_set(
+  rtems_task_priority  priority,
+  size_t               stack_size,
+  rtems_attribute      attribute_set,
+  size_t               cpusetsize,
+  const cpu_set_t     *cpuset
+)
+{
+  rtems_status_code status;
+  Thread_Life_state thread_life_state;
+
+  thread_life_state = _Once_Lock();
+  status = _Timer_server_Initiate_set(
+    priority,
+    stack_size,
+    attribute_set,
+    cpusetsize,
+    cpuset
+  );
+  _Once_Unlock( thread_life_state );
+
+  return status;
+}
+
+rtems_status_code rtems_timer_server_get_statistics(
+  uint32_t                       cpu_index,
+  rtems_timer_server_statistics *statistics
+)
+{
+  Timer_server_Control          *ts;
+  rtems_timer_server_statistics  snapshot;
+  ISR_lock_Context               lock_context;
+
+  if ( statistics == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( cpu_index >= _SMP_Get_processor_maximum() ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  if ( _Timer_server == NULL ) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  ts = _Timer_server_Get( _Per_CPU_Get_by_index( cpu_index ) );
+
+  _Timer_server_Acquire( ts, &lock_context );
+  snapshot = ts->Statistics;
+  _Timer_server_Release( ts, &lock_context );
+
+  statistics->count = snapshot.count;
+  statistics->total_latency = _Timer_server_Ticks_to_ns( snapshot.total_latency );
+  statistics->max_latency = _Timer_server_Ticks_to_ns( snapshot.max_latency );
+  statistics->max_runtime = _Timer_server_Ticks_to_ns( snapshot.max_runtime );
+
+  return RTEMS_SUCCESSFUL;
+}
@@ -20,6 +20,8 @@
 #include <rtems/counter.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/smplock.h>
+#include <rtems/score/threadqimpl.h>
+#include <rtems/rtems/semimpl.h>
 #include <rtems.h>
 
 #include <string.h>
@@ -138,6 +140,104 @@ static void smp_lock_stats_iterate(
 #endif
 }
 
+#ifdef RTEMS_PROFILING
+static void object_stats_convert(
+  rtems_profiling_object *object_data,
+  const Thread_queue_Stats *snapshot
+)
+{
+  object_data->max_wait_time =
+    rtems_counter_ticks_to_nanoseconds(snapshot->max_wait_time);
+  object_data->max_hold_time =
+    rtems_counter_ticks_to_nanoseconds(snapshot->max_hold_time);
+  object_data->acquire_count = snapshot->acquire_count;
+  object_data->contention_count = snapshot->contention_count;
+  object_data->total_wait_time =
+    rtems_counter_ticks_to_nanoseconds(snapshot->total_wait_time);
+  object_data->total_hold_time =
+    rtems_counter_ticks_to_nanoseconds(snapshot->total_hold_time);
+}
+
+static Semaphore_Control *get_next_semaphore(Objects_Id *id)
+{
+  return (Semaphore_Control *)
+    _Objects_Get_next(*id, &_Semaphore_Information, id);
+}
+#endif
+
+static void object_stats_iterate(
+  rtems_profiling_visitor visitor,
+  void *visitor_arg,
+  rtems_profiling_data *data
+)
+{
+#ifdef RTEMS_PROFILING
+  rtems_profiling_object *object_data = &data->object;
+  Objects_Id id = OBJECTS_ID_INITIAL_INDEX;
+  Semaphore_Control *the_semaphore;
+  Thread_queue_Stats snapshot;
+  const void *object;
+  char name[64];
+  size_t i;
+
+  memset(data, 0, sizeof(*data));
+  data->header.type = RTEMS_PROFILING_OBJECT;
+
+  /* The statistics of Classic semaphores are protected by the semaphore */
+  while ((the_semaphore = get_next_semaphore(&id)) != NULL) {
+    Thread_queue_Control *wait_queue = &the_semaphore->Core_control.Wait_queue;
+    Thread_queue_Context queue_context;
+
+    _Thread_queue_Context_initialize(&queue_context);
+    _Thread_queue_Acquire(wait_queue, &queue_context);
+    snapshot = wait_queue->Stats;
+    _Thread_queue_Release(wait_queue, &queue_context);
+
+    object_data->id = the_semaphore->Object.id;
+    object_data->object = the_semaphore;
+    _Objects_Allocator_unlock();
+
+    if (snapshot.acquire_count == 0) {
+      continue;
+    }
+
+    if (
+      rtems_object_get_name(object_data->id, sizeof(name), &name[0]) != NULL
+    ) {
+      object_data->name = name;
+    } else {
+      object_data->name = NULL;
+    }
+
+    object_stats_convert(object_data, &snapshot);
+    (*visitor)(visitor_arg, data);
+  }
+
+  object_data->id = 0;
+  object_data->name = NULL;
+
+  for (i = 0; i < THREAD_QUEUE_STATS_COUNT; ++i) {
+    if (!_Thread_queue_Stats_get_self_contained(i, &object, &snapshot)) {
+      continue;
+    }
+
+    object_data->object = object;
+    object_stats_convert(object_data, &snapshot);
+    (*visitor)(visitor_arg, data);
+  }
+
+  memset(data, 0, sizeof(*data));
+  data->header.type = RTEMS_PROFILING_OBJECT_OVERFLOW;
+  data->object_overflow.table_size = THREAD_QUEUE_STATS_COUNT;
+  data->object_overflow.overflow_count = _Thread_queue_Stats_get_overflows();
+  (*visitor)(visitor_arg, data);
+#else
+  (void) visitor;
+  (void) visitor_arg;
+  (void) data;
+#endif
+}
+
 void rtems_profiling_iterate(
   rtems_profiling_visitor visitor,
   void *visitor_arg
@@ -147,4 +247,5 @@ void rtems_profiling_iterate(
 
   per_cpu_stats_iterate(visitor, visitor_arg, &data);
   smp_lock_stats_iterate(visitor, visitor_arg, &data);
+  object_stats_iterate(visitor, visitor_arg, &data);
 }
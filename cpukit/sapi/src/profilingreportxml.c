@@ -253,6 +253,115 @@ static void report_smp_lock(context *ctx, const rtems_profiling_smp_lock *smp_lo
   update_retval(ctx, rv);
 }
 
+static void report_object(context *ctx, const rtems_profiling_object *object)
+{
+  int rv;
+
+  indent(ctx, 1);
+
+  if (object->name != NULL) {
+    rv = rtems_printf(
+      ctx->printer,
+      "<ObjectProfilingReport id=\"0x%08" PRIx32 "\" name=\"%s\">\n",
+      object->id,
+      object->name
+    );
+  } else {
+    rv = rtems_printf(
+      ctx->printer,
+      "<ObjectProfilingReport id=\"0x%08" PRIx32 "\" address=\"%p\">\n",
+      object->id,
+      object->object
+    );
+  }
+
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MaxWaitTime unit=\"ns\">%" PRIu32 "</MaxWaitTime>\n",
+    object->max_wait_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MaxHoldTime unit=\"ns\">%" PRIu32 "</MaxHoldTime>\n",
+    object->max_hold_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MeanWaitTime unit=\"ns\">%" PRIu64 "</MeanWaitTime>\n",
+    arithmetic_mean(
+      object->total_wait_time,
+      object->contention_count
+    )
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<TotalWaitTime unit=\"ns\">%" PRIu64 "</TotalWaitTime>\n",
+    object->total_wait_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<TotalHoldTime unit=\"ns\">%" PRIu64 "</TotalHoldTime>\n",
+    object->total_hold_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<AcquireCount>%" PRIu64 "</AcquireCount>\n",
+    object->acquire_count
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<ContentionCount>%" PRIu64 "</ContentionCount>\n",
+    object->contention_count
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "</ObjectProfilingReport>\n"
+  );
+  update_retval(ctx, rv);
+}
+
+static void report_object_overflow(
+  context *ctx,
+  const rtems_profiling_object_overflow *overflow
+)
+{
+  int rv;
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "<ObjectProfilingOverflow tableSize=\"%" PRIu32 "\">"
+      "%" PRIu64 "</ObjectProfilingOverflow>\n",
+    overflow->table_size,
+    overflow->overflow_count
+  );
+  update_retval(ctx, rv);
+}
+
 static void report(void *arg, const rtems_profiling_data *data)
 {
   context *ctx = arg;
@@ -264,6 +373,12 @@ static void report(void *arg, const rtems_profiling_data *data)
     case RTEMS_PROFILING_SMP_LOCK:
       report_smp_lock(ctx, &data->smp_lock);
       break;
+    case RTEMS_PROFILING_OBJECT:
+      report_object(ctx, &data->object);
+      break;
+    case RTEMS_PROFILING_OBJECT_OVERFLOW:
+      report_object_overflow(ctx, &data->object_overflow);
+      break;
   }
 }
 
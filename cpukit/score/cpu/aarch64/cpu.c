@@ -40,6 +40,7 @@
 
 #include <rtems/score/assert.h>
 #include <rtems/score/cpu.h>
+#include <rtems/score/percpu.h>
 #include <rtems/score/thread.h>
 #include <rtems/score/tls.h>
 
@@ -191,6 +192,181 @@ void _CPU_ISR_install_vector(
   }
 }
 
+#define AARCH64_ID_AA64DFR0_PMUVER( _reg ) ( ( ( _reg ) >> 8 ) & 0xf )
+
+#define AARCH64_PMCR_E 0x1
+
+#define AARCH64_PMCR_P 0x2
+
+#define AARCH64_PMCR_C 0x4
+
+#define AARCH64_PMCR_N( _reg ) ( ( ( _reg ) >> 11 ) & 0x1f )
+
+#define AARCH64_PMCNTEN_C 0x80000000
+
+#define AARCH64_PMU_EVENT_L1D_CACHE_REFILL 0x03
+
+#define AARCH64_PMU_EVENT_INST_RETIRED 0x08
+
+static bool aarch64_pmu_cycles;
+
+static bool aarch64_pmu_events;
+
+bool _CPU_Performance_counters_enable( void )
+{
+  uint64_t dfr0;
+  uint64_t pmcr;
+  uint64_t enable;
+  uint64_t version;
+
+  __asm__ volatile (
+    "mrs %[dfr0], ID_AA64DFR0_EL1\n"
+    : [dfr0] "=&r" (dfr0)
+  );
+
+  /* Without a PMUv3 the CPU counter is used for the cycles */
+  version = AARCH64_ID_AA64DFR0_PMUVER( dfr0 );
+  if ( version == 0 || version == 0xf ) {
+    return false;
+  }
+
+  __asm__ volatile (
+    "mrs %[pmcr], PMCR_EL0\n"
+    : [pmcr] "=&r" (pmcr)
+  );
+
+  enable = AARCH64_PMCNTEN_C;
+
+  /* Use event counters 0 and 1 if the implementation has them */
+  if ( AARCH64_PMCR_N( pmcr ) >= 2 ) {
+    __asm__ volatile (
+      "msr PMEVTYPER0_EL0, %[inst]\n"
+      "msr PMEVTYPER1_EL0, %[refill]\n"
+      : : [inst] "r" ( (uint64_t) AARCH64_PMU_EVENT_INST_RETIRED ),
+          [refill] "r" ( (uint64_t) AARCH64_PMU_EVENT_L1D_CACHE_REFILL )
+    );
+    enable |= 0x3;
+    aarch64_pmu_events = true;
+  }
+
+  pmcr |= AARCH64_PMCR_E | AARCH64_PMCR_P | AARCH64_PMCR_C;
+  __asm__ volatile (
+    "msr PMCCFILTR_EL0, xzr\n"
+    "msr PMCNTENSET_EL0, %[enable]\n"
+    "msr PMCR_EL0, %[pmcr]\n"
+    "isb\n"
+    : : [enable] "r" (enable), [pmcr] "r" (pmcr)
+  );
+
+  aarch64_pmu_cycles = true;
+  return aarch64_pmu_events;
+}
+
+void _CPU_Performance_counters_read(
+  uint32_t *cycles,
+  uint32_t *instructions,
+  uint32_t *cache_misses
+)
+{
+  uint64_t value;
+
+  if ( aarch64_pmu_cycles ) {
+    __asm__ volatile (
+      "mrs %[value], PMCCNTR_EL0\n"
+      : [value] "=&r" (value)
+    );
+    *cycles = (uint32_t) value;
+  } else {
+    *cycles = _CPU_Counter_read();
+  }
+
+  if ( aarch64_pmu_events ) {
+    __asm__ volatile (
+      "mrs %[value], PMEVCNTR0_EL0\n"
+      : [value] "=&r" (value)
+    );
+    *instructions = (uint32_t) value;
+    __asm__ volatile (
+      "mrs %[value], PMEVCNTR1_EL0\n"
+      : [value] "=&r" (value)
+    );
+    *cache_misses = (uint32_t) value;
+  } else {
+    *instructions = 0;
+    *cache_misses = 0;
+  }
+}
+
+/* Index of the saved ELR in the interrupt context, see push_interrupt_context */
+#define AARCH64_INTERRUPT_CONTEXT_ELR_INDEX 2
+
+void _CPU_Get_interrupted_context( uintptr_t *pc, uintptr_t *fp )
+{
+  const Per_CPU_Control *cpu_self;
+  const uint64_t        *context;
+  uint64_t               daif;
+  uint64_t               thread_sp;
+#ifndef AARCH64_MULTILIB_ARCH_V8_ILP32
+  uintptr_t              low;
+  uintptr_t              high;
+  uintptr_t              frame;
+#endif
+
+  cpu_self = _Per_CPU_Get();
+
+  if ( cpu_self->isr_nest_level == 0 ) {
+    *pc = 0;
+    *fp = 0;
+    return;
+  }
+
+  /*
+   * The outermost interrupt pushed the interrupt context to the thread stack
+   * (SP_EL1) before it switched to the interrupt stack (SP_EL0).
+   */
+  __asm__ volatile (
+    "mrs %[daif], DAIF\n"
+    "msr DAIFSet, #0x2\n"
+    "msr spsel, #1\n"
+    "mov %[thread_sp], sp\n"
+    "msr spsel, #0\n"
+    "msr DAIF, %[daif]\n"
+    : [daif] "=&r" (daif), [thread_sp] "=&r" (thread_sp)
+  );
+
+  context = (const uint64_t *) (uintptr_t) thread_sp;
+  *pc = (uintptr_t) context[ AARCH64_INTERRUPT_CONTEXT_ELR_INDEX ];
+
+#ifdef AARCH64_MULTILIB_ARCH_V8_ILP32
+  *fp = 0;
+#else
+  /*
+   * The interrupt entry does not save the frame pointer since it is a
+   * non-volatile register.  The first frame record of the interrupt handlers
+   * outside the interrupt stack is the frame record of the interrupted
+   * context.
+   */
+  low = (uintptr_t) cpu_self->interrupt_stack_low;
+  high = (uintptr_t) cpu_self->interrupt_stack_high;
+  frame = (uintptr_t) __builtin_frame_address( 0 );
+
+  while ( frame >= low && frame < high ) {
+    uintptr_t previous;
+
+    previous = ( (const uintptr_t *) frame )[ 0 ];
+
+    if ( previous <= frame ) {
+      frame = 0;
+      break;
+    }
+
+    frame = previous;
+  }
+
+  *fp = frame;
+#endif
+}
+
 void _CPU_Initialize( void )
 {
   /* Do nothing */
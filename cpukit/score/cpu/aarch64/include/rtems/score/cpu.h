@@ -402,6 +402,20 @@ static inline CPU_Counter_ticks _CPU_Counter_difference(
   return second - first;
 }
 
+#define CPU_PROVIDES_PERFORMANCE_COUNTERS TRUE
+
+bool _CPU_Performance_counters_enable( void );
+
+void _CPU_Performance_counters_read(
+  uint32_t *cycles,
+  uint32_t *instructions,
+  uint32_t *cache_misses
+);
+
+#define CPU_PROVIDES_INTERRUPTED_CONTEXT TRUE
+
+void _CPU_Get_interrupted_context( uintptr_t *pc, uintptr_t *fp );
+
 void *_CPU_Thread_Idle_body( uintptr_t ignored );
 
 typedef enum {
@@ -1254,6 +1254,67 @@ static inline CPU_Counter_ticks _CPU_Counter_difference(
   return second - first;
 }
 
+/**
+ * @brief Defined to TRUE if the port provides processor performance counters.
+ *
+ * In this case the port must provide _CPU_Performance_counters_enable() and
+ * _CPU_Performance_counters_read().  Otherwise, the CPU usage counters only
+ * count the CPU counter ticks.  A port may leave this undefined.
+ */
+#define CPU_PROVIDES_PERFORMANCE_COUNTERS FALSE
+
+/**
+ * @brief Enables the performance counters of the current processor.
+ *
+ * This function is invoked on each processor with interrupts disabled.
+ *
+ * @retval true The instructions and the cache misses are counted.
+ * @retval false Only the cycles are counted.
+ */
+bool _CPU_Performance_counters_enable( void );
+
+/**
+ * @brief Reads the performance counters of the current processor.
+ *
+ * The counters are free-running 32-bit counters, the caller uses modulo
+ * arithmetic to get the difference of two values.  Counters not available on
+ * this processor shall read as zero.
+ *
+ * @param[out] cycles The processor cycles.  In case the processor has no
+ *   cycle counter, then this is the CPU counter value.
+ * @param[out] instructions The instructions retired.
+ * @param[out] cache_misses The data cache misses.
+ */
+void _CPU_Performance_counters_read(
+  uint32_t *cycles,
+  uint32_t *instructions,
+  uint32_t *cache_misses
+);
+
+/**
+ * @brief Defined to TRUE if the port provides
+ * _CPU_Get_interrupted_context().
+ *
+ * The sampling profiler of the event recording uses this function.  A port
+ * may leave this undefined.
+ */
+#define CPU_PROVIDES_INTERRUPTED_CONTEXT FALSE
+
+/**
+ * @brief Gets the program counter and frame pointer of the thread context
+ * interrupted by the outermost interrupt on the current processor.
+ *
+ * This function is invoked in interrupt context.
+ *
+ * @param[out] pc The program counter of the interrupted context.  It is set
+ *   to zero, if it cannot be determined.
+ * @param[out] fp The frame pointer of the interrupted context.  It shall
+ *   point to a frame record which consists of the previous frame pointer
+ *   followed by the return address.  It is set to zero, if it cannot be
+ *   determined.
+ */
+void _CPU_Get_interrupted_context( uintptr_t *pc, uintptr_t *fp );
+
 #ifdef RTEMS_SMP
   /**
    * @brief Performs CPU specific SMP initialization in the context of the boot
@@ -143,6 +143,9 @@ void _Thread_queue_Initialize(
 #if defined(RTEMS_SMP)
   _SMP_lock_Stats_initialize( &the_thread_queue->Lock_stats, "Thread Queue" );
 #endif
+#if defined(RTEMS_PROFILING)
+  memset( &the_thread_queue->Stats, 0, sizeof( the_thread_queue->Stats ) );
+#endif
 }
 
 void _Thread_queue_Object_initialize( Thread_queue_Control *the_thread_queue )
@@ -389,6 +389,11 @@ void _Thread_queue_Enqueue(
 
   _Assert( queue_context->enqueue_callout != NULL );
 
+#if defined(RTEMS_PROFILING)
+  queue_context->enqueued = true;
+  queue_context->enqueue_instant = _CPU_Counter_read();
+#endif
+
 #if defined(RTEMS_MULTIPROCESSING)
   if ( _Thread_MP_Is_receive( the_thread ) && the_thread->receive_packet ) {
     the_thread = _Thread_MP_Allocate_proxy( queue_context->thread_state );
@@ -464,6 +469,11 @@ Status_Control _Thread_queue_Enqueue_sticky(
 
   _Assert( queue_context->enqueue_callout != NULL );
 
+#if defined(RTEMS_PROFILING)
+  queue_context->enqueued = true;
+  queue_context->enqueue_instant = _CPU_Counter_read();
+#endif
+
   _Thread_Wait_claim( the_thread, queue );
 
   if ( !_Thread_queue_Path_acquire_critical( queue, the_thread, queue_context ) ) {
@@ -0,0 +1,316 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreThreadQ
+ *
+ * @brief Thread Queue Contention Statistics
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/threadqimpl.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/percpu.h>
+
+#include <string.h>
+
+#if defined(RTEMS_PROFILING)
+
+void _Thread_queue_Stats_record_acquire(
+  Thread_queue_Stats         *stats,
+  const Thread_queue_Context *queue_context,
+  bool                        hold
+)
+{
+  CPU_Counter_ticks now;
+
+  now = _CPU_Counter_read();
+  ++stats->acquire_count;
+
+  if ( queue_context->enqueued ) {
+    CPU_Counter_ticks wait_time;
+
+    wait_time = _CPU_Counter_difference( now, queue_context->enqueue_instant );
+    ++stats->contention_count;
+    stats->total_wait_time += wait_time;
+
+    if ( stats->max_wait_time < wait_time ) {
+      stats->max_wait_time = wait_time;
+    }
+  }
+
+  if ( hold ) {
+    stats->held = true;
+    stats->hold_instant = now;
+  }
+}
+
+void _Thread_queue_Stats_record_release( Thread_queue_Stats *stats )
+{
+  CPU_Counter_ticks hold_time;
+
+  if ( !stats->held ) {
+    return;
+  }
+
+  hold_time = _CPU_Counter_difference(
+    _CPU_Counter_read(),
+    stats->hold_instant
+  );
+  stats->held = false;
+  stats->total_hold_time += hold_time;
+
+  if ( stats->max_hold_time < hold_time ) {
+    stats->max_hold_time = hold_time;
+  }
+}
+
+/*
+ * The statistics of self-contained objects are kept in a table with open
+ * addressing and a bounded linear probe sequence.  An entry is claimed by an
+ * object through a compare and swap operation, so there is no global lock.
+ * The entry of an object is only changed by the owner of the thread queue
+ * lock of this object.  A removed entry is marked as removed and may be
+ * claimed again by another object, so the probe sequences stay valid.  The
+ * generation of an entry is odd during an update.  This allows consistent
+ * snapshots of the entries without the lock of the object.
+ */
+
+#define THREAD_QUEUE_STATS_PROBES 8
+
+#define THREAD_QUEUE_STATS_REMOVED ( (uintptr_t) 1 )
+
+typedef struct {
+  Atomic_Uintptr     object;
+  Atomic_Uint        generation;
+  Thread_queue_Stats Stats;
+} Thread_queue_Stats_entry;
+
+static Thread_queue_Stats_entry
+_Thread_queue_Stats_table[ THREAD_QUEUE_STATS_COUNT ];
+
+static Atomic_Ulong _Thread_queue_Stats_overflows =
+  ATOMIC_INITIALIZER_ULONG( 0 );
+
+static size_t _Thread_queue_Stats_hash( const void *object )
+{
+  uintptr_t key;
+
+  key = (uintptr_t) object;
+  key ^= key >> 16;
+  key *= 0x45d9f3bU;
+  key ^= key >> 16;
+
+  return key % THREAD_QUEUE_STATS_COUNT;
+}
+
+static Thread_queue_Stats_entry *_Thread_queue_Stats_get_entry(
+  size_t index,
+  size_t i
+)
+{
+  return &_Thread_queue_Stats_table[ ( index + i ) % THREAD_QUEUE_STATS_COUNT ];
+}
+
+static Thread_queue_Stats_entry *_Thread_queue_Stats_find(
+  const void *object,
+  bool        insert
+)
+{
+  size_t index;
+  size_t i;
+
+  index = _Thread_queue_Stats_hash( object );
+
+  for ( i = 0; i < THREAD_QUEUE_STATS_PROBES; ++i ) {
+    Thread_queue_Stats_entry *entry;
+    uintptr_t                 value;
+
+    entry = _Thread_queue_Stats_get_entry( index, i );
+    value = _Atomic_Load_uintptr( &entry->object, ATOMIC_ORDER_ACQUIRE );
+
+    if ( value == (uintptr_t) object ) {
+      return entry;
+    }
+
+    /* Entries are never given back to the unused state */
+    if ( value == 0 ) {
+      break;
+    }
+  }
+
+  if ( !insert ) {
+    return NULL;
+  }
+
+  for ( i = 0; i < THREAD_QUEUE_STATS_PROBES; ++i ) {
+    Thread_queue_Stats_entry *entry;
+    uintptr_t                 value;
+
+    entry = _Thread_queue_Stats_get_entry( index, i );
+    value = _Atomic_Load_uintptr( &entry->object, ATOMIC_ORDER_RELAXED );
+
+    while ( value == 0 || value == THREAD_QUEUE_STATS_REMOVED ) {
+      if (
+        _Atomic_Compare_exchange_uintptr(
+          &entry->object,
+          &value,
+          (uintptr_t) object,
+          ATOMIC_ORDER_ACQUIRE,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        return entry;
+      }
+    }
+  }
+
+  _Atomic_Fetch_add_ulong(
+    &_Thread_queue_Stats_overflows,
+    1,
+    ATOMIC_ORDER_RELAXED
+  );
+  return NULL;
+}
+
+static void _Thread_queue_Stats_begin_update( Thread_queue_Stats_entry *entry )
+{
+  unsigned int generation;
+
+  generation = _Atomic_Load_uint( &entry->generation, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint(
+    &entry->generation,
+    generation + 1,
+    ATOMIC_ORDER_RELAXED
+  );
+  _Atomic_Fence( ATOMIC_ORDER_RELEASE );
+}
+
+static void _Thread_queue_Stats_end_update( Thread_queue_Stats_entry *entry )
+{
+  unsigned int generation;
+
+  generation = _Atomic_Load_uint( &entry->generation, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint(
+    &entry->generation,
+    generation + 1,
+    ATOMIC_ORDER_RELEASE
+  );
+}
+
+void _Thread_queue_Stats_record_acquire_self_contained(
+  Thread_queue_Queue         *queue,
+  const void                 *object,
+  const Thread_queue_Context *queue_context,
+  bool                        hold
+)
+{
+  ISR_lock_Context          lock_context;
+  Thread_queue_Stats_entry *entry;
+
+  _ISR_lock_ISR_disable( &lock_context );
+  _Thread_queue_Queue_acquire_critical(
+    queue,
+    &_Thread_Executing->Potpourri_stats,
+    &lock_context
+  );
+
+  entry = _Thread_queue_Stats_find( object, true );
+
+  if ( entry != NULL ) {
+    _Thread_queue_Stats_begin_update( entry );
+    _Thread_queue_Stats_record_acquire( &entry->Stats, queue_context, hold );
+    _Thread_queue_Stats_end_update( entry );
+  }
+
+  _Thread_queue_Queue_release( queue, &lock_context );
+}
+
+void _Thread_queue_Stats_record_release_self_contained( const void *object )
+{
+  Thread_queue_Stats_entry *entry;
+
+  entry = _Thread_queue_Stats_find( object, false );
+
+  if ( entry != NULL ) {
+    _Thread_queue_Stats_begin_update( entry );
+    _Thread_queue_Stats_record_release( &entry->Stats );
+    _Thread_queue_Stats_end_update( entry );
+  }
+}
+
+void _Thread_queue_Stats_record_remove_self_contained( const void *object )
+{
+  Thread_queue_Stats_entry *entry;
+
+  entry = _Thread_queue_Stats_find( object, false );
+
+  if ( entry != NULL ) {
+    _Thread_queue_Stats_begin_update( entry );
+    memset( &entry->Stats, 0, sizeof( entry->Stats ) );
+    _Thread_queue_Stats_end_update( entry );
+
+    /*
+     * The release order makes the cleared statistics visible to the next
+     * object which claims this entry.
+     */
+    _Atomic_Store_uintptr(
+      &entry->object,
+      THREAD_QUEUE_STATS_REMOVED,
+      ATOMIC_ORDER_RELEASE
+    );
+  }
+}
+
+bool _Thread_queue_Stats_get_self_contained(
+  size_t              index,
+  const void        **object,
+  Thread_queue_Stats *snapshot
+)
+{
+  Thread_queue_Stats_entry *entry;
+  unsigned int              generation;
+  uintptr_t                 value;
+
+  if ( index >= THREAD_QUEUE_STATS_COUNT ) {
+    return false;
+  }
+
+  entry = &_Thread_queue_Stats_table[ index ];
+
+  do {
+    generation = _Atomic_Load_uint( &entry->generation, ATOMIC_ORDER_ACQUIRE );
+    value = _Atomic_Load_uintptr( &entry->object, ATOMIC_ORDER_RELAXED );
+    *snapshot = entry->Stats;
+    _Atomic_Fence( ATOMIC_ORDER_ACQUIRE );
+  } while (
+    ( generation % 2 ) != 0
+      || _Atomic_Load_uint( &entry->generation, ATOMIC_ORDER_RELAXED )
+        != generation
+  );
+
+  *object = (const void *) value;
+  return value != 0
+    && value != THREAD_QUEUE_STATS_REMOVED
+    && snapshot->acquire_count > 0;
+}
+
+uint64_t _Thread_queue_Stats_get_overflows( void )
+{
+  return _Atomic_Load_ulong(
+    &_Thread_queue_Stats_overflows,
+    ATOMIC_ORDER_RELAXED
+  );
+}
+
+#endif /* RTEMS_PROFILING */
@@ -51,6 +51,189 @@ void _Watchdog_Do_tickle(
   } while ( first != NULL );
 }
 
+void ( *_Watchdog_High_resolution_handler )( uint64_t nanoseconds );
+
+static uint64_t _Watchdog_Nanoseconds_from_expire( uint64_t expire )
+{
+  uint64_t ns;
+
+  ns = ( expire >> WATCHDOG_BITS_FOR_1E9_NANOSECONDS )
+    * WATCHDOG_NANOSECONDS_PER_SECOND;
+  ns += (uint32_t) expire
+    & ( ( UINT32_C( 1 ) << WATCHDOG_BITS_FOR_1E9_NANOSECONDS ) - 1 );
+
+  return ns;
+}
+
+static uint64_t _Watchdog_Nanoseconds_from_timespec(
+  const struct timespec *ts
+)
+{
+  return (uint64_t) ts->tv_sec * WATCHDOG_NANOSECONDS_PER_SECOND
+    + (uint64_t) ts->tv_nsec;
+}
+
+static uint32_t _Watchdog_Ticks_until_time(
+  const Watchdog_Header *header,
+  const struct timespec *now,
+  uint32_t               maximum
+)
+{
+  const Watchdog_Control *first;
+  uint64_t                expire_ns;
+  uint64_t                now_ns;
+  uint64_t                ticks;
+
+  first = _Watchdog_Header_first( header );
+
+  if ( first == NULL ) {
+    return maximum;
+  }
+
+  expire_ns = _Watchdog_Nanoseconds_from_expire( first->expire );
+  now_ns = _Watchdog_Nanoseconds_from_timespec( now );
+
+  if ( expire_ns <= now_ns ) {
+    return 1;
+  }
+
+  /*
+   * The watchdog is serviced by the first tick at which the time of the
+   * timecounter windup reaches the expiration time.
+   */
+  ticks = ( expire_ns - now_ns + _Watchdog_Nanoseconds_per_tick - 1 )
+    / _Watchdog_Nanoseconds_per_tick;
+
+  return ticks < maximum ? (uint32_t) ticks : maximum;
+}
+
+uint32_t _Watchdog_Ticks_until_expiry(
+  Per_CPU_Control *cpu,
+  uint32_t         maximum
+)
+{
+  ISR_lock_Context  lock_context;
+  Watchdog_Header  *header;
+  Watchdog_Control *first;
+  struct timespec   now;
+  uint32_t          ticks;
+
+  _Assert( maximum > 0 );
+  ticks = maximum;
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+  first = _Watchdog_Header_first( header );
+
+  if ( first != NULL ) {
+    uint64_t delta;
+
+    if ( first->expire > cpu->Watchdog.ticks ) {
+      delta = first->expire - cpu->Watchdog.ticks;
+    } else {
+      delta = 1;
+    }
+
+    if ( delta < ticks ) {
+      ticks = (uint32_t) delta;
+    }
+  }
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
+  _Timecounter_Getnanouptime( &now );
+  ticks = _Watchdog_Ticks_until_time( header, &now, ticks );
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ];
+  _Timecounter_Getnanotime( &now );
+  ticks = _Watchdog_Ticks_until_time( header, &now, ticks );
+
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+
+  return ticks;
+}
+
+void _Watchdog_Skip_ticks( Per_CPU_Control *cpu, uint32_t skipped )
+{
+  ISR_lock_Context lock_context;
+
+  if ( _Per_CPU_Is_boot_processor( cpu ) ) {
+    _Watchdog_Ticks_since_boot += skipped;
+  }
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  _Assert( cpu->Watchdog.ticks < UINT64_MAX - skipped );
+  cpu->Watchdog.ticks += skipped;
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
+
+void _Watchdog_High_resolution_program( Per_CPU_Control *cpu )
+{
+  void                  ( *handler )( uint64_t );
+  const Watchdog_Control *first;
+  struct timespec         now;
+  uint64_t                expire_ns;
+  uint64_t                now_ns;
+
+  handler = _Watchdog_High_resolution_handler;
+  first = _Watchdog_Header_first(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ]
+  );
+
+  if ( handler == NULL || first == NULL ) {
+    return;
+  }
+
+  _Assert( cpu == _Per_CPU_Get() );
+
+  /*
+   * The expiration time is compared with the current uptime and not with the
+   * uptime of the last timecounter windup used by the clock tick.
+   */
+  _Timecounter_Nanouptime( &now );
+  expire_ns = _Watchdog_Nanoseconds_from_expire( first->expire );
+  now_ns = _Watchdog_Nanoseconds_from_timespec( &now );
+
+  ( *handler )( expire_ns > now_ns ? expire_ns - now_ns : 0 );
+}
+
+void _Watchdog_High_resolution_update( Per_CPU_Control *cpu )
+{
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  _Watchdog_High_resolution_program( cpu );
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
+
+void _Watchdog_High_resolution_tick( Per_CPU_Control *cpu )
+{
+  ISR_lock_Context  lock_context;
+  Watchdog_Header  *header;
+  Watchdog_Control *first;
+  struct timespec   now;
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
+  first = _Watchdog_Header_first( header );
+
+  if ( first != NULL ) {
+    _Timecounter_Nanouptime( &now );
+    _Watchdog_Tickle(
+      header,
+      first,
+      _Watchdog_Ticks_from_timespec( &now ),
+      &cpu->Watchdog.Lock,
+      &lock_context
+    );
+  }
+
+  _Watchdog_High_resolution_program( cpu );
+
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
+
 void _Watchdog_Tick( Per_CPU_Control *cpu )
 {
   ISR_lock_Context  lock_context;
@@ -95,6 +278,7 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
       &cpu->Watchdog.Lock,
       &lock_context
     );
+    _Watchdog_High_resolution_program( cpu );
   }
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ];
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include <rtems/libio.h>
+#include <rtems/dosfs.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "FSDOSFSEXTENT 1";
+
+#define MOUNT_DIR "/mnt"
+
+#define FILE_FRAGMENTED MOUNT_DIR "/fragmented"
+
+#define FILE_FILLER MOUNT_DIR "/filler"
+
+#define CLUSTER_SIZE 512
+
+#define FILE_SIZE (96 * CLUSTER_SIZE)
+
+#define READ_COUNT 256
+
+static uint32_t random_state = 1;
+
+static uint8_t buf[4 * CLUSTER_SIZE];
+
+static uint32_t random_next(void)
+{
+  random_state = random_state * 1103515245 + 12345;
+  return random_state >> 8;
+}
+
+/*
+ * The pattern depends on the position of the cluster within the file, so a
+ * cluster mapped to the wrong disk cluster is detected.
+ */
+static uint8_t pattern(off_t off)
+{
+  return (uint8_t) (off ^ (off >> 8) ^ (off >> 16));
+}
+
+static void write_pattern(int fd, off_t off, size_t size)
+{
+  off_t pos;
+  ssize_t n;
+  size_t i;
+
+  rtems_test_assert(size <= sizeof(buf));
+
+  for (i = 0; i < size; ++i) {
+    buf[i] = pattern(off + (off_t) i);
+  }
+
+  pos = lseek(fd, off, SEEK_SET);
+  rtems_test_assert(pos == off);
+
+  n = write(fd, buf, size);
+  rtems_test_assert(n == (ssize_t) size);
+}
+
+static void append_filler(int fd, size_t size)
+{
+  off_t pos;
+  ssize_t n;
+
+  rtems_test_assert(size <= sizeof(buf));
+  memset(buf, 0xff, size);
+
+  pos = lseek(fd, 0, SEEK_END);
+  rtems_test_assert(pos >= 0);
+
+  n = write(fd, buf, size);
+  rtems_test_assert(n == (ssize_t) size);
+}
+
+/*
+ * Append to the fragmented file and grow the filler file in between, so that
+ * the cluster chain of the fragmented file consists of runs of different
+ * length.
+ */
+static void write_fragmented(int fd, int filler_fd, off_t begin, off_t end)
+{
+  off_t off;
+
+  off = begin;
+
+  while (off < end) {
+    size_t size;
+
+    size = (1 + random_next() % 2) * CLUSTER_SIZE - (size_t) (off % CLUSTER_SIZE);
+
+    if (off + (off_t) size > end) {
+      size = (size_t) (end - off);
+    }
+
+    write_pattern(fd, off, size);
+    off += (off_t) size;
+
+    append_filler(filler_fd, (1 + random_next() % 3) * CLUSTER_SIZE);
+  }
+}
+
+static void check_range(int fd, off_t file_size, off_t off, size_t size)
+{
+  off_t pos;
+  ssize_t n;
+  ssize_t expected;
+  ssize_t i;
+
+  rtems_test_assert(size <= sizeof(buf));
+
+  pos = lseek(fd, off, SEEK_SET);
+  rtems_test_assert(pos == off);
+
+  memset(buf, 0xaa, size);
+  n = read(fd, buf, size);
+
+  if (off >= file_size) {
+    expected = 0;
+  } else if (off + (off_t) size > file_size) {
+    expected = (ssize_t) (file_size - off);
+  } else {
+    expected = (ssize_t) size;
+  }
+
+  rtems_test_assert(n == expected);
+
+  for (i = 0; i < n; ++i) {
+    rtems_test_assert(buf[i] == pattern(off + i));
+  }
+}
+
+static void check_zero(int fd, off_t off, size_t size)
+{
+  off_t pos;
+  ssize_t n;
+  size_t i;
+
+  rtems_test_assert(size <= sizeof(buf));
+
+  pos = lseek(fd, off, SEEK_SET);
+  rtems_test_assert(pos == off);
+
+  memset(buf, 0xaa, size);
+  n = read(fd, buf, size);
+  rtems_test_assert(n == (ssize_t) size);
+
+  for (i = 0; i < size; ++i) {
+    rtems_test_assert(buf[i] == 0);
+  }
+}
+
+static void check_file_size(int fd, off_t file_size)
+{
+  struct stat st;
+  int rv;
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == file_size);
+}
+
+/*
+ * Read backwards cluster by cluster, this used to walk the cluster chain
+ * from the first cluster for each read, and then at random offsets.
+ */
+static void check_file(int fd, off_t file_size)
+{
+  off_t off;
+  int i;
+
+  check_file_size(fd, file_size);
+
+  off = file_size - (file_size % CLUSTER_SIZE);
+
+  while (off >= 0) {
+    check_range(fd, file_size, off, CLUSTER_SIZE);
+    off -= CLUSTER_SIZE;
+  }
+
+  for (i = 0; i < READ_COUNT; ++i) {
+    size_t size;
+
+    off = (off_t) (random_next() % (uint32_t) (file_size + CLUSTER_SIZE));
+    size = 1 + random_next() % sizeof(buf);
+    check_range(fd, file_size, off, size);
+  }
+}
+
+static int reopen(int fd)
+{
+  int rv;
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  fd = open(FILE_FRAGMENTED, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  return fd;
+}
+
+static void test(const char *rda)
+{
+  static const msdos_format_request_param_t rqdata = {
+    .sectors_per_cluster = CLUSTER_SIZE / 512,
+    .quick_format = true
+  };
+
+  off_t file_size;
+  off_t truncated_size;
+  int fd;
+  int filler_fd;
+  int rv;
+
+  rv = msdos_format(rda, &rqdata);
+  rtems_test_assert(rv == 0);
+
+  rv = mount_and_make_target_path(
+    rda,
+    MOUNT_DIR,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  fd = open(FILE_FRAGMENTED, O_RDWR | O_CREAT, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(fd >= 0);
+
+  filler_fd = open(FILE_FILLER, O_RDWR | O_CREAT, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(filler_fd >= 0);
+
+  /* The extents are populated while the file is written */
+  file_size = FILE_SIZE;
+  write_fragmented(fd, filler_fd, 0, file_size);
+  check_file(fd, file_size);
+
+  /* A new descriptor starts with no extents, so the first reads miss */
+  fd = reopen(fd);
+  check_range(fd, file_size, file_size - 1, 1);
+  check_file(fd, file_size);
+
+  /* Truncate within a cluster and extend with new fragmented clusters */
+  truncated_size = file_size / 3 + 100;
+  rv = ftruncate(fd, truncated_size);
+  rtems_test_assert(rv == 0);
+  check_file(fd, truncated_size);
+
+  write_fragmented(fd, filler_fd, truncated_size, file_size);
+  check_file(fd, file_size);
+
+  fd = reopen(fd);
+  check_file(fd, file_size);
+
+  /* Extend with zeros through ftruncate() */
+  rv = ftruncate(fd, file_size + 5 * CLUSTER_SIZE);
+  rtems_test_assert(rv == 0);
+  check_file_size(fd, file_size + 5 * CLUSTER_SIZE);
+  check_zero(fd, file_size, 3 * CLUSTER_SIZE);
+  check_zero(fd, file_size + 3 * CLUSTER_SIZE, 2 * CLUSTER_SIZE);
+  check_range(fd, file_size, file_size / 2, sizeof(buf));
+
+  rv = ftruncate(fd, file_size);
+  rtems_test_assert(rv == 0);
+  check_file(fd, file_size);
+
+  /* Truncate to zero, the first cluster changes on the next extend */
+  rv = ftruncate(fd, 0);
+  rtems_test_assert(rv == 0);
+  check_file(fd, 0);
+
+  append_filler(filler_fd, CLUSTER_SIZE);
+  write_fragmented(fd, filler_fd, 0, file_size);
+  check_file(fd, file_size);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(filler_fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test("/dev/rda");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = 512, .block_num = 1024 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
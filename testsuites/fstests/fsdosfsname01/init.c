@@ -59,6 +59,9 @@ const char rtems_test_name[] = "FSDOSFSNAME 1";
 #define MAX_NAME_LENGTH ( 255 + 1 )
 #define MAX_NAME_LENGTH_INVALID ( 255 + 2 )
 #define MAX_DUPLICATES_PER_NAME 3
+#define NAME_INDEX_DIRECTORIES 2
+#define NUMBER_OF_INDEXED_DIRECTORIES 4
+#define NUMBER_OF_INDEXED_FILES 6
 static const char UTF8_BOM[] = {0xEF, 0xBB, 0xBF};
 #define UTF8_BOM_SIZE 3 /* Size of the UTF-8 byte-order-mark */
 
@@ -986,6 +989,7 @@ static void test_compatibility( void )
   struct dirent            *dp;
 
 
+  memset( &mount_opts, 0, sizeof( mount_opts ) );
   mount_opts.converter = rtems_dosfs_create_utf8_converter( "CP850" );
   rtems_test_assert( mount_opts.converter != NULL );
 
@@ -1183,6 +1187,200 @@ static void test_getcwd( void )
   rtems_libio_use_global_env();
 }
 
+static void name_index_path(
+  char        *path,
+  size_t       size,
+  unsigned int dir,
+  const char  *file
+)
+{
+  if ( file != NULL ) {
+    snprintf( path, size, "%s/index dir %u/%s", MOUNT_DIR, dir, file );
+  } else {
+    snprintf( path, size, "%s/index dir %u", MOUNT_DIR, dir );
+  }
+}
+
+static void name_index_file( char *name, size_t size, unsigned int file )
+{
+  snprintf( name, size, "index file %u with a long name", file );
+}
+
+static void assert_name_exists( const char *path, bool is_dir )
+{
+  struct stat st;
+  int         rc;
+
+  rc = stat( path, &st );
+  rtems_test_assert( rc == 0 );
+
+  if ( is_dir ) {
+    rtems_test_assert( S_ISDIR( st.st_mode ) );
+  } else {
+    rtems_test_assert( S_ISREG( st.st_mode ) );
+  }
+}
+
+static void assert_name_does_not_exist( const char *path )
+{
+  struct stat st;
+  int         rc;
+
+  errno = 0;
+  rc = stat( path, &st );
+  rtems_test_assert( rc == -1 );
+  rtems_test_assert( errno == ENOENT );
+}
+
+static void create_file( const char *path )
+{
+  int fd;
+  int rc;
+
+  fd = open( path, O_RDWR | O_CREAT | O_EXCL,
+             S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH );
+  rtems_test_assert( fd >= 0 );
+
+  rc = close( fd );
+  rtems_test_assert( rc == 0 );
+}
+
+/*
+ * Look up all files of all directories except the ones removed by
+ * test_name_index() and some absent names.  Since more directories are used
+ * than the name index holds, each lookup in the next directory evicts the
+ * least recently used index and rebuilds the index of this directory.
+ */
+static void test_name_index_lookups( bool renamed )
+{
+  char         name[MAX_NAME_LENGTH];
+  char         path[MAX_NAME_LENGTH * 2];
+  unsigned int dir;
+  unsigned int file;
+
+  for ( dir = 0; dir < NUMBER_OF_INDEXED_DIRECTORIES; ++dir ) {
+    for ( file = 0; file < NUMBER_OF_INDEXED_FILES; ++file ) {
+      name_index_file( name, sizeof( name ), file );
+      name_index_path( path, sizeof( path ), dir, name );
+
+      if ( renamed && dir <= 1 && file == dir ) {
+        assert_name_does_not_exist( path );
+      } else {
+        assert_name_exists( path, false );
+      }
+    }
+
+    name_index_path( path, sizeof( path ), dir, "index file with a long name" );
+    assert_name_does_not_exist( path );
+
+    name_index_path( path, sizeof( path ), dir, "INDEX" );
+    assert_name_does_not_exist( path );
+  }
+}
+
+/*
+ * Use more directories than the directory name index holds and check that
+ * lookups return the right result after the least recently used indices are
+ * evicted and after names are renamed and unlinked.
+ */
+static void test_name_index( void )
+{
+  char         name[MAX_NAME_LENGTH];
+  char         path[MAX_NAME_LENGTH * 2];
+  char         path_2[MAX_NAME_LENGTH * 2];
+  unsigned int dir;
+  unsigned int file;
+  int          rc;
+  int          fd;
+
+  for ( dir = 0; dir < NUMBER_OF_INDEXED_DIRECTORIES; ++dir ) {
+    name_index_path( path, sizeof( path ), dir, NULL );
+    rc = mkdir( path, S_IRWXU | S_IRWXG | S_IRWXO );
+    rtems_test_assert( rc == 0 );
+
+    for ( file = 0; file < NUMBER_OF_INDEXED_FILES; ++file ) {
+      name_index_file( name, sizeof( name ), file );
+      name_index_path( path, sizeof( path ), dir, name );
+      create_file( path );
+    }
+  }
+
+  test_name_index_lookups( false );
+  test_name_index_lookups( false );
+
+  /* Rename within a directory */
+  name_index_file( name, sizeof( name ), 0 );
+  name_index_path( path, sizeof( path ), 0, name );
+  name_index_path( path_2, sizeof( path_2 ), 0, "renamed file with a long name" );
+  rc = rename( path, path_2 );
+  rtems_test_assert( rc == 0 );
+  assert_name_does_not_exist( path );
+  assert_name_exists( path_2, false );
+
+  /* Rename to another directory */
+  name_index_file( name, sizeof( name ), 1 );
+  name_index_path( path, sizeof( path ), 1, name );
+  name_index_path( path_2, sizeof( path_2 ), 2, "moved file with a long name" );
+  rc = rename( path, path_2 );
+  rtems_test_assert( rc == 0 );
+  assert_name_does_not_exist( path );
+  assert_name_exists( path_2, false );
+
+  /* Rename a directory, the files must be found through the new name */
+  name_index_path( path, sizeof( path ), 3, NULL );
+  snprintf( path_2, sizeof( path_2 ), "%s/%s", MOUNT_DIR, "renamed dir" );
+  rc = rename( path, path_2 );
+  rtems_test_assert( rc == 0 );
+  assert_name_does_not_exist( path );
+  assert_name_exists( path_2, true );
+
+  name_index_file( name, sizeof( name ), 2 );
+  snprintf( path, sizeof( path ), "%s/%s/%s", MOUNT_DIR, "renamed dir", name );
+  assert_name_exists( path, false );
+
+  name_index_path( path, sizeof( path ), 3, NULL );
+  rc = rename( path_2, path );
+  rtems_test_assert( rc == 0 );
+  assert_name_does_not_exist( path_2 );
+  assert_name_exists( path, true );
+
+  test_name_index_lookups( true );
+
+  /* Unlink and create a name again */
+  for ( dir = 0; dir < NUMBER_OF_INDEXED_DIRECTORIES; ++dir ) {
+    name_index_file( name, sizeof( name ), 2 );
+    name_index_path( path, sizeof( path ), dir, name );
+    rc = unlink( path );
+    rtems_test_assert( rc == 0 );
+    assert_name_does_not_exist( path );
+
+    errno = 0;
+    rc = unlink( path );
+    rtems_test_assert( rc == -1 );
+    rtems_test_assert( errno == ENOENT );
+  }
+
+  for ( dir = 0; dir < NUMBER_OF_INDEXED_DIRECTORIES; ++dir ) {
+    name_index_file( name, sizeof( name ), 2 );
+    name_index_path( path, sizeof( path ), dir, name );
+    assert_name_does_not_exist( path );
+    create_file( path );
+
+    errno = 0;
+    fd = open( path, O_RDWR | O_CREAT | O_EXCL,
+               S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH );
+    rtems_test_assert( fd == -1 );
+    rtems_test_assert( errno == EEXIST );
+  }
+
+  test_name_index_lookups( true );
+
+  name_index_path( path, sizeof( path ), 0, "renamed file with a long name" );
+  assert_name_exists( path, false );
+  name_index_path( path, sizeof( path ), 2, "moved file with a long name" );
+  assert_name_exists( path, false );
+}
+
 static void test_special_cases( void )
 {
   test_end_of_string_matches();
@@ -1207,6 +1405,13 @@ static void test( void )
 
   snprintf( start_dir, sizeof( start_dir ), "%s/%s", MOUNT_DIR, "strt" );
 
+  /*
+   * Run the tests with multibyte string compatible conversion methods with a
+   * directory name index for less directories than used by the tests
+   */
+  memset( mount_opts, 0, sizeof( mount_opts ) );
+  mount_opts[0].name_index_directories = NAME_INDEX_DIRECTORIES;
+
   /*
    * Tests with code page 850 compatible directory and file names
    * and the code page 850 backwards compatible default mode mode of the
@@ -1301,6 +1506,12 @@ static void test( void )
 
   mount_device_with_iconv( start_dir, &mount_opts[0] );
 
+  test_name_index();
+
+  unmount_and_close_device();
+
+  mount_device_with_iconv( start_dir, &mount_opts[0] );
+
   test_creating_directories(
     &start_dir[0],
     &DIRECTORY_NAMES[0][0],
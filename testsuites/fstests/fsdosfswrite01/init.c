@@ -31,7 +31,9 @@ const char rtems_test_name[] = "FSDOSFSWRITE 1";
 #define FAT16_DEFAULT_SECTORS_PER_CLUSTER 32 /* Default number of sectors per cluster for FAT16 */
 #define SECTORS_PER_CLUSTER 2
 
-static void format_and_mount( const char *dev_name, const char *mount_dir )
+static void format_and_mount( const char *dev_name,
+  const char                               *mount_dir,
+  const rtems_dosfs_mount_options          *mount_options )
 {
   static const msdos_format_request_param_t rqdata = {
     .sectors_per_cluster = SECTORS_PER_CLUSTER,
@@ -48,7 +50,7 @@ static void format_and_mount( const char *dev_name, const char *mount_dir )
               mount_dir,
               RTEMS_FILESYSTEM_TYPE_DOSFS,
               RTEMS_FILESYSTEM_READ_WRITE,
-              NULL );
+              mount_options );
   rtems_test_assert( rv == 0 );
 }
 
@@ -167,7 +169,7 @@ static void test_normal_file_write(
 
   memset( cluster_buf, 0xFE, cluster_size );
 
-  format_and_mount( dev_name, mount_dir );
+  format_and_mount( dev_name, mount_dir, NULL );
 
   fd = create_file( file_name );
   rtems_test_assert( fd >= 0 );
@@ -226,7 +228,7 @@ static void test_fat12_root_directory_write( const char *dev_name,
   int                             rv;
 
 
-  format_and_mount( dev_name, mount_dir );
+  format_and_mount( dev_name, mount_dir, NULL );
 
   reset_block_stats( dev_name, mount_dir );
 
@@ -242,6 +244,102 @@ static void test_fat12_root_directory_write( const char *dev_name,
   rtems_test_assert( rv == 0 );
 }
 
+static void test_direct_file_io(
+  const char *dev_name,
+  const char *mount_dir,
+  const char *file_name )
+{
+  static uint8_t     file_buf[8 * SECTOR_SIZE * SECTORS_PER_CLUSTER]
+    RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
+  static uint8_t     read_buf[sizeof( file_buf )]
+    RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
+  uint32_t           cluster_size = SECTOR_SIZE * SECTORS_PER_CLUSTER;
+  rtems_dosfs_mount_options mount_options;
+  rtems_blkdev_stats stats;
+  int                rv;
+  int                fd;
+  ssize_t            num_bytes;
+  size_t             i;
+
+
+  for ( i = 0; i < sizeof( file_buf ); ++i ) {
+    file_buf[i] = (uint8_t) ( i / 3 );
+  }
+
+  memset( &mount_options, 0, sizeof( mount_options ) );
+  mount_options.direct_io_threshold = 4 * cluster_size;
+
+  format_and_mount( dev_name, mount_dir, &mount_options );
+
+  fd = create_file( file_name );
+  rtems_test_assert( fd >= 0 );
+
+  /* A partial cluster goes through the cache */
+  num_bytes = write( fd, file_buf, 1 );
+  rtems_test_assert( num_bytes == 1 );
+
+  /*
+   * The complete clusters of this write bypass the cache, the user buffer is
+   * aligned at the start of the second cluster
+   */
+  num_bytes = write( fd, &file_buf[1], sizeof( file_buf ) - 1 );
+  rtems_test_assert( (ssize_t) sizeof( file_buf ) - 1 == num_bytes );
+
+  rv = close( fd );
+  rtems_test_assert( 0 == rv );
+
+  reset_block_stats( dev_name, mount_dir );
+
+  fd = open( file_name, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  num_bytes = read( fd, read_buf, sizeof( read_buf ) );
+  rtems_test_assert( (ssize_t) sizeof( read_buf ) == num_bytes );
+  rtems_test_assert( memcmp( file_buf, read_buf, sizeof( file_buf ) ) == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( 0 == rv );
+
+  fd = open( dev_name, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  rv = ioctl( fd, RTEMS_BLKIO_GETDEVSTATS, &stats );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( 0 == rv );
+
+  /* The data clusters are read without a cache access */
+  rtems_test_assert( stats.read_blocks >= 8 );
+  rtems_test_assert( stats.read_hits + stats.read_misses < 8 );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( 0 == rv );
+
+  /* The data must be the same without direct I/O */
+  rv = mount( dev_name,
+              mount_dir,
+              RTEMS_FILESYSTEM_TYPE_DOSFS,
+              RTEMS_FILESYSTEM_READ_WRITE,
+              NULL );
+  rtems_test_assert( rv == 0 );
+
+  memset( read_buf, 0, sizeof( read_buf ) );
+
+  fd = open( file_name, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  num_bytes = read( fd, read_buf, sizeof( read_buf ) );
+  rtems_test_assert( (ssize_t) sizeof( read_buf ) == num_bytes );
+  rtems_test_assert( memcmp( file_buf, read_buf, sizeof( file_buf ) ) == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( 0 == rv );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( 0 == rv );
+}
+
 static void test( void )
 {
   static const char dev_name[]  = "/dev/sda";
@@ -268,6 +366,8 @@ static void test( void )
 
   test_normal_file_write( dev_name, mount_dir, file_name );
 
+  test_direct_file_io( dev_name, mount_dir, file_name );
+
   rv = unlink( dev_name );
   rtems_test_assert( rv == 0 );
 }
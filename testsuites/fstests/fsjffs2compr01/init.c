@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2COMPR 1";
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FLASH_SIZE (32UL * BLOCK_SIZE)
+
+#define MOUNT_POINT "/jffs2"
+
+#define DATA_FILE MOUNT_POINT "/data"
+
+#define DATA_SIZE (64UL * 1024UL)
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static rtems_jffs2_compressor_zlib_control zlib_instance = {
+  .super = {
+    .compress = rtems_jffs2_compressor_zlib_compress,
+    .decompress = rtems_jffs2_compressor_zlib_decompress
+  }
+};
+
+static rtems_jffs2_compressor_lz4_control lz4_instance = {
+  .super = {
+    .compress = rtems_jffs2_compressor_lz4_compress,
+    .decompress = rtems_jffs2_compressor_lz4_decompress
+  }
+};
+
+static unsigned char data[DATA_SIZE];
+
+static unsigned char buffer[DATA_SIZE];
+
+static void make_data(void)
+{
+  static const char * const words[] = {
+    "sensor", "value", "status", "ok", "error", "timeout", "channel",
+    "voltage", "current", "temperature", "event", "flash"
+  };
+  uint32_t seed = 1;
+  size_t i = 0;
+
+  /* Generate log like text which compresses well */
+  while (i < sizeof(data)) {
+    const char *word;
+    size_t n;
+
+    seed = seed * 1103515245 + 12345;
+    word = words[(seed >> 16) % RTEMS_ARRAY_SIZE(words)];
+    n = strlen(word);
+
+    if (n > sizeof(data) - i) {
+      n = sizeof(data) - i;
+    }
+
+    memcpy(&data[i], word, n);
+    i += n;
+
+    if (i < sizeof(data)) {
+      data[i] = ((seed >> 8) & 0x7) == 0 ? '\n' : ' ';
+      ++i;
+    }
+  }
+}
+
+static void mount_jffs2(const rtems_jffs2_mount_data *mount_data)
+{
+  int rv;
+
+  rv = mount(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    mount_data
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void unmount_jffs2(void)
+{
+  int rv;
+
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+}
+
+static void get_info(rtems_jffs2_info *info)
+{
+  int fd;
+  int rv;
+
+  fd = open(MOUNT_POINT, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_INFO, info);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static uint64_t write_data(void)
+{
+  uint64_t begin;
+  int fd;
+  int rv;
+  ssize_t n;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  fd = open(DATA_FILE, O_WRONLY | O_TRUNC | O_CREAT, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, data, sizeof(data));
+  rtems_test_assert(n == (ssize_t) sizeof(data));
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return rtems_clock_get_uptime_nanoseconds() - begin;
+}
+
+static uint64_t read_data(void)
+{
+  uint64_t begin;
+  uint64_t end;
+  int fd;
+  int rv;
+  ssize_t n;
+
+  memset(buffer, 0, sizeof(buffer));
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  fd = open(DATA_FILE, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  n = read(fd, buffer, sizeof(buffer));
+  rtems_test_assert(n == (ssize_t) sizeof(buffer));
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  end = rtems_clock_get_uptime_nanoseconds();
+  rtems_test_assert(memcmp(buffer, data, sizeof(data)) == 0);
+
+  return end - begin;
+}
+
+static uint32_t run(
+  const char *name,
+  rtems_jffs2_compressor_control *compressor_control
+)
+{
+  const rtems_jffs2_mount_data mount_data = {
+    .flash_control = &flash_instance.super,
+    .compressor_control = compressor_control
+  };
+  rtems_jffs2_info info;
+  uint64_t write_time;
+  uint64_t read_time;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  mount_jffs2(&mount_data);
+  write_time = write_data();
+  get_info(&info);
+  unmount_jffs2();
+
+  /* Read after a remount, so that the data comes from the flash */
+  mount_jffs2(&mount_data);
+  read_time = read_data();
+  unmount_jffs2();
+
+  printf(
+    "%s: used size %" PRIu32 ", write %" PRIu64 "us, read %" PRIu64 "us\n",
+    name,
+    info.used_size,
+    write_time / 1000,
+    read_time / 1000
+  );
+
+  return info.used_size;
+}
+
+static void Init(rtems_task_argument arg)
+{
+  uint32_t uncompressed;
+  uint32_t zlib;
+  uint32_t lz4;
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = mkdir(MOUNT_POINT, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  make_data();
+
+  uncompressed = run("none", NULL);
+  zlib = run("zlib", &zlib_instance.super);
+  lz4 = run("lz4", &lz4_instance.super);
+
+  rtems_test_assert(zlib < lz4);
+  rtems_test_assert(lz4 < uncompressed);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2SUMMARY 1";
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FLASH_SIZE (32UL * BLOCK_SIZE)
+
+#define FILE_COUNT 48
+
+#define FILE_SIZE 4096
+
+#define MOUNT_POINT "/jffs2"
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  uint32_t bytes_read;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  self->bytes_read += size_of_buffer;
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static unsigned char file_buffer[FILE_SIZE];
+
+static void fill_file_buffer(int file)
+{
+  size_t i;
+
+  for (i = 0; i < FILE_SIZE; ++i) {
+    file_buffer[i] = (unsigned char) (file * 7 + i);
+  }
+}
+
+static void make_path(char *path, size_t size, int file)
+{
+  snprintf(path, size, MOUNT_POINT "/file-%02i", file);
+}
+
+static void mount_jffs2(bool enable_summary, bool writeable)
+{
+  rtems_jffs2_mount_data mount_data = {
+    .flash_control = &flash_instance.super,
+    .enable_summary = enable_summary
+  };
+  int rv;
+
+  rv = mount(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    writeable ? RTEMS_FILESYSTEM_READ_WRITE : RTEMS_FILESYSTEM_READ_ONLY,
+    &mount_data
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void unmount_jffs2(void)
+{
+  int rv;
+
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+}
+
+static void create_files(void)
+{
+  int file;
+
+  for (file = 0; file < FILE_COUNT; ++file) {
+    char path[32];
+    ssize_t n;
+    int fd;
+    int rv;
+
+    make_path(path, sizeof(path), file);
+    fill_file_buffer(file);
+
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+    rtems_test_assert(fd >= 0);
+
+    n = write(fd, file_buffer, FILE_SIZE);
+    rtems_test_assert(n == FILE_SIZE);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void check_files(void)
+{
+  int file;
+
+  for (file = 0; file < FILE_COUNT; ++file) {
+    unsigned char buf[FILE_SIZE];
+    char path[32];
+    ssize_t n;
+    int fd;
+    int rv;
+
+    make_path(path, sizeof(path), file);
+    fill_file_buffer(file);
+
+    fd = open(path, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    n = read(fd, buf, FILE_SIZE);
+    rtems_test_assert(n == FILE_SIZE);
+    rtems_test_assert(memcmp(buf, file_buffer, FILE_SIZE) == 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static uint32_t timed_mount(bool enable_summary, uint64_t *duration)
+{
+  uint64_t begin;
+
+  flash_instance.bytes_read = 0;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+  mount_jffs2(enable_summary, false);
+  *duration = rtems_clock_get_uptime_nanoseconds() - begin;
+
+  return flash_instance.bytes_read;
+}
+
+static void test_mount_with_summary(void)
+{
+  uint64_t duration_full_scan;
+  uint64_t duration_summary;
+  uint32_t read_full_scan;
+  uint32_t read_summary;
+  int rv;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  rv = mkdir(MOUNT_POINT, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  mount_jffs2(true, true);
+  create_files();
+  unmount_jffs2();
+
+  /* The read-only mounts leave the flash content as it is */
+  read_full_scan = timed_mount(false, &duration_full_scan);
+  check_files();
+  unmount_jffs2();
+
+  read_summary = timed_mount(true, &duration_summary);
+  check_files();
+  unmount_jffs2();
+
+  rtems_test_assert(read_summary < read_full_scan);
+
+  printf(
+    "full scan: %" PRIu32 " bytes read, %" PRIu64 "us\n"
+    "summary: %" PRIu32 " bytes read, %" PRIu64 "us\n",
+    read_full_scan,
+    duration_full_scan / 1000,
+    read_summary,
+    duration_summary / 1000
+  );
+
+  /* Files written without summary support stay readable with it enabled */
+  mount_jffs2(false, true);
+  rv = unlink(MOUNT_POINT "/file-00");
+  rtems_test_assert(rv == 0);
+  create_files();
+  unmount_jffs2();
+
+  mount_jffs2(true, false);
+  check_files();
+  unmount_jffs2();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_mount_with_summary();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
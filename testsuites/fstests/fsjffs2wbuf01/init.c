@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2WBUF 1";
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FLASH_SIZE (16UL * BLOCK_SIZE)
+
+#define MOUNT_POINT "/jffs2"
+
+#define LOG_FILE MOUNT_POINT "/log"
+
+#define DATA_FILE MOUNT_POINT "/data"
+
+#define RECORD_COUNT 512
+
+#define RECORD_SIZE 32
+
+#define DATA_SIZE 8192
+
+#define GC_TASK_PRIORITY 2
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  uint32_t write_count;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  ++self->write_count;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static unsigned char data[DATA_SIZE];
+
+static void mount_jffs2(const rtems_jffs2_mount_data *mount_data)
+{
+  int rv;
+
+  rv = mount(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    mount_data
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void unmount_jffs2(void)
+{
+  int rv;
+
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+}
+
+static void make_record(char *record, int i)
+{
+  snprintf(record, RECORD_SIZE + 1, "record %04i %019i\n", i, i * 13);
+}
+
+static void append_records(void)
+{
+  int fd;
+  int rv;
+  int i;
+
+  fd = open(LOG_FILE, O_WRONLY | O_APPEND | O_CREAT, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  for (i = 0; i < RECORD_COUNT; ++i) {
+    char record[RECORD_SIZE + 1];
+    struct stat st;
+    ssize_t n;
+
+    make_record(record, i);
+    n = write(fd, record, RECORD_SIZE);
+    rtems_test_assert(n == RECORD_SIZE);
+
+    rv = fstat(fd, &st);
+    rtems_test_assert(rv == 0);
+    rtems_test_assert(st.st_size == (i + 1) * RECORD_SIZE);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void check_records(void)
+{
+  int fd;
+  int rv;
+  int i;
+
+  fd = open(LOG_FILE, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  for (i = 0; i < RECORD_COUNT; ++i) {
+    char expected[RECORD_SIZE + 1];
+    char record[RECORD_SIZE];
+    ssize_t n;
+
+    make_record(expected, i);
+    n = read(fd, record, RECORD_SIZE);
+    rtems_test_assert(n == RECORD_SIZE);
+    rtems_test_assert(memcmp(record, expected, RECORD_SIZE) == 0);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static uint32_t log_records(const rtems_jffs2_mount_data *mount_data)
+{
+  uint32_t write_count;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  mount_jffs2(mount_data);
+  flash_instance.write_count = 0;
+  append_records();
+  write_count = flash_instance.write_count;
+  check_records();
+  unmount_jffs2();
+
+  mount_jffs2(mount_data);
+  check_records();
+  unmount_jffs2();
+
+  return write_count;
+}
+
+static void test_write_buffer(void)
+{
+  rtems_jffs2_mount_data mount_data = {
+    .flash_control = &flash_instance.super
+  };
+  uint32_t unbuffered;
+  uint32_t buffered;
+  int fd;
+  int rv;
+
+  unbuffered = log_records(&mount_data);
+
+  mount_data.write_buffer_size = 4096;
+  buffered = log_records(&mount_data);
+
+  rtems_test_assert(buffered < unbuffered);
+
+  printf(
+    "flash writes: unbuffered %" PRIu32 ", buffered %" PRIu32 "\n",
+    unbuffered,
+    buffered
+  );
+
+  /* A truncate writes the buffered data to flash before it changes the size */
+  mount_jffs2(&mount_data);
+
+  fd = open(LOG_FILE, O_WRONLY | O_APPEND);
+  rtems_test_assert(fd >= 0);
+
+  rv = write(fd, "x", 1);
+  rtems_test_assert(rv == 1);
+
+  rv = ftruncate(fd, RECORD_COUNT * RECORD_SIZE);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  check_records();
+  unmount_jffs2();
+}
+
+static void get_info(rtems_jffs2_info *info)
+{
+  int fd;
+  int rv;
+
+  fd = open(MOUNT_POINT, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_INFO, info);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void rewrite_data(void)
+{
+  int fd;
+  int rv;
+  ssize_t n;
+
+  fd = open(DATA_FILE, O_WRONLY | O_TRUNC | O_CREAT, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, data, sizeof(data));
+  rtems_test_assert(n == (ssize_t) sizeof(data));
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_gc_task(void)
+{
+  static const rtems_jffs2_mount_data mount_data = {
+    .flash_control = &flash_instance.super,
+    .gc_task_priority = GC_TASK_PRIORITY,
+    .gc_trigger_free_blocks = 12
+  };
+  rtems_jffs2_info before;
+  rtems_jffs2_info after;
+  rtems_status_code sc;
+  int i;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+  memset(&data[0], 0xa5, sizeof(data));
+
+  mount_jffs2(&mount_data);
+
+  /*
+   * The garbage collection task has a lower priority than the test task, so
+   * it runs only once the test task waits.
+   */
+  for (i = 0; i < 12; ++i) {
+    rewrite_data();
+  }
+
+  get_info(&before);
+  rtems_test_assert(before.dirty_size > 0);
+
+  sc = rtems_task_wake_after(rtems_clock_get_ticks_per_second());
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  get_info(&after);
+  rtems_test_assert(after.dirty_size < before.dirty_size);
+
+  printf(
+    "dirty size: before %" PRIu32 ", after garbage collection %" PRIu32 "\n",
+    before.dirty_size,
+    after.dirty_size
+  );
+
+  unmount_jffs2();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = mkdir(MOUNT_POINT, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  test_write_buffer();
+  test_gc_task();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS (2 * RTEMS_MINIMUM_STACK_SIZE)
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -446,6 +446,26 @@ rtems_rfs_bitmap_ut_test_bitmap (size_t size)
   rtems_test_assert( rc == 0 );
   rtems_test_assert( control.free == control.size - 1);
 
+  /* Allocate runs of bits, a run ends at a set bit or the end of the map */
+  printf (" 36. Allocate runs of bits.\n");
+  rc = rtems_rfs_bitmap_map_clear_all(&control);
+  rtems_test_assert( rc == 0 );
+  rc = rtems_rfs_bitmap_map_set(&control, 40);
+  rtems_test_assert( rc == 0 );
+  rc = rtems_rfs_bitmap_map_alloc_run(&control, 0, 100, &result, &bit, &clear);
+  rtems_test_assert( rc == 0 );
+  rtems_test_assert( result && bit == 0 && clear == 40 );
+  rc = rtems_rfs_bitmap_map_alloc_run(&control, 0, 10, &result, &bit, &clear);
+  rtems_test_assert( rc == 0 );
+  rtems_test_assert( result && bit == 41 && clear == 10 );
+  rc = rtems_rfs_bitmap_map_alloc_run(&control, 0, size, &result, &bit, &clear);
+  rtems_test_assert( rc == 0 );
+  rtems_test_assert( result && bit == 51 && clear == size - 51 );
+  rtems_test_assert( control.free == 0 );
+  rc = rtems_rfs_bitmap_map_alloc_run(&control, 0, 1, &result, &bit, &clear);
+  rtems_test_assert( rc == 0 );
+  rtems_test_assert( !result && clear == 0 );
+
   rtems_rfs_bitmap_close (&control);
   free (buffer.buffer);
 }
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/blkdev.h>
+#include <rtems/libio.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "FSRFSDIRECTIO 1";
+
+#define BLOCK_SIZE 512
+
+#define DIRECT_IO_THRESHOLD 1024
+
+#define TRANSFER_SIZE (16 * BLOCK_SIZE)
+
+#define FILE_SIZE (4 * TRANSFER_SIZE)
+
+static const rtems_rfs_format_config rfs_config = {
+  .block_size = BLOCK_SIZE
+};
+
+static const char rda [] = "/dev/rda";
+
+static const char mnt [] = "/mnt";
+
+static const char file [] = "/mnt/file";
+
+typedef struct {
+  int disk_fd;
+  uint8_t *aligned;
+  uint8_t *unaligned;
+  uint8_t generation;
+} test_context;
+
+static test_context test_instance;
+
+static uint8_t pattern(off_t off, uint8_t generation)
+{
+  return (uint8_t) (off ^ (off >> 9) ^ generation);
+}
+
+static void get_stats(test_context *ctx, rtems_blkdev_stats *stats)
+{
+  int rv;
+
+  rv = rtems_disk_fd_get_device_stats(ctx->disk_fd, stats);
+  rtems_test_assert(rv == 0);
+}
+
+static void write_range(
+  test_context *ctx,
+  int fd,
+  uint8_t *buf,
+  off_t off,
+  size_t size
+)
+{
+  off_t pos;
+  ssize_t n;
+  size_t i;
+
+  for (i = 0; i < size; ++i) {
+    buf[i] = pattern(off + (off_t) i, ctx->generation);
+  }
+
+  pos = lseek(fd, off, SEEK_SET);
+  rtems_test_assert(pos == off);
+
+  n = write(fd, buf, size);
+  rtems_test_assert(n == (ssize_t) size);
+}
+
+static void read_range(
+  test_context *ctx,
+  int fd,
+  uint8_t *buf,
+  off_t off,
+  size_t size
+)
+{
+  off_t pos;
+  ssize_t n;
+  size_t i;
+
+  memset(buf, 0xaa, size);
+
+  pos = lseek(fd, off, SEEK_SET);
+  rtems_test_assert(pos == off);
+
+  n = read(fd, buf, size);
+  rtems_test_assert(n == (ssize_t) size);
+
+  for (i = 0; i < size; ++i) {
+    rtems_test_assert(buf[i] == pattern(off + (off_t) i, ctx->generation));
+  }
+}
+
+static void check_file_size(int fd, off_t size)
+{
+  struct stat st;
+  int rv;
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == size);
+}
+
+/*
+ * Write the whole file with one kind of buffer and position and read it back
+ * with all kinds.  A direct read transfers the blocks without a cache lookup,
+ * a read through the cache looks up each block.
+ */
+static void test_round_trip(
+  test_context *ctx,
+  uint8_t *write_buf,
+  off_t write_skew
+)
+{
+  rtems_blkdev_stats before;
+  rtems_blkdev_stats after;
+  off_t off;
+  int fd;
+  int rv;
+
+  ++ctx->generation;
+
+  fd = open(file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  if (write_skew != 0) {
+    write_range(ctx, fd, write_buf, 0, (size_t) write_skew);
+  }
+
+  for (off = write_skew; off < FILE_SIZE; off += TRANSFER_SIZE) {
+    size_t size = TRANSFER_SIZE;
+
+    if (off + (off_t) size > FILE_SIZE) {
+      size = (size_t) (FILE_SIZE - off);
+    }
+
+    write_range(ctx, fd, write_buf, off, size);
+  }
+
+  check_file_size(fd, FILE_SIZE);
+
+  /* Aligned buffer and position */
+  get_stats(ctx, &before);
+  read_range(ctx, fd, ctx->aligned, TRANSFER_SIZE, TRANSFER_SIZE);
+  get_stats(ctx, &after);
+  rtems_test_assert(
+    after.read_blocks - before.read_blocks >= TRANSFER_SIZE / BLOCK_SIZE
+  );
+  rtems_test_assert(
+    (after.read_hits + after.read_misses)
+      - (before.read_hits + before.read_misses) < TRANSFER_SIZE / BLOCK_SIZE
+  );
+
+  /* Aligned buffer and position, partial last block */
+  read_range(ctx, fd, ctx->aligned, 0, TRANSFER_SIZE + BLOCK_SIZE / 2);
+
+  /* Aligned buffer, unaligned position */
+  read_range(ctx, fd, ctx->aligned, 3, TRANSFER_SIZE);
+
+  /* Unaligned buffer, aligned position */
+  get_stats(ctx, &before);
+  read_range(ctx, fd, ctx->unaligned, 2 * TRANSFER_SIZE, TRANSFER_SIZE);
+  get_stats(ctx, &after);
+  rtems_test_assert(
+    (after.read_hits + after.read_misses)
+      - (before.read_hits + before.read_misses) >= TRANSFER_SIZE / BLOCK_SIZE
+  );
+
+  /* Below the threshold */
+  read_range(ctx, fd, ctx->aligned, 0, BLOCK_SIZE);
+
+  /* To the end of file */
+  read_range(ctx, fd, ctx->aligned, FILE_SIZE - TRANSFER_SIZE, TRANSFER_SIZE);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  /* Reopen to read through a new file handle */
+  fd = open(file, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  for (off = 0; off < FILE_SIZE; off += TRANSFER_SIZE) {
+    read_range(ctx, fd, ctx->aligned, off, TRANSFER_SIZE);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+/*
+ * Overwrite the middle of the file directly and through the cache and check
+ * that the neighbouring data is not affected.
+ */
+static void test_overwrite(test_context *ctx)
+{
+  rtems_blkdev_stats before;
+  rtems_blkdev_stats after;
+  off_t off;
+  int fd;
+  int rv;
+
+  fd = open(file, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  /* Fill the cache with the blocks overwritten directly below */
+  read_range(ctx, fd, ctx->unaligned, TRANSFER_SIZE, TRANSFER_SIZE);
+
+  ++ctx->generation;
+
+  for (off = 0; off < FILE_SIZE; off += TRANSFER_SIZE) {
+    get_stats(ctx, &before);
+    write_range(ctx, fd, ctx->aligned, off, TRANSFER_SIZE);
+    get_stats(ctx, &after);
+    rtems_test_assert(
+      after.write_blocks - before.write_blocks >= TRANSFER_SIZE / BLOCK_SIZE
+    );
+  }
+
+  /* Cached blocks of a direct write must not be stale */
+  read_range(ctx, fd, ctx->unaligned, TRANSFER_SIZE, TRANSFER_SIZE);
+
+  ++ctx->generation;
+
+  for (off = 0; off < FILE_SIZE; off += TRANSFER_SIZE) {
+    write_range(ctx, fd, ctx->unaligned, off, TRANSFER_SIZE);
+  }
+
+  /* Modified cached blocks must be written before a direct read */
+  for (off = 0; off < FILE_SIZE; off += TRANSFER_SIZE) {
+    read_range(ctx, fd, ctx->aligned, off, TRANSFER_SIZE);
+  }
+
+  check_file_size(fd, FILE_SIZE);
+
+  /* Extend the file directly */
+  write_range(ctx, fd, ctx->aligned, FILE_SIZE, TRANSFER_SIZE);
+  check_file_size(fd, FILE_SIZE + TRANSFER_SIZE);
+  read_range(ctx, fd, ctx->unaligned, FILE_SIZE - BLOCK_SIZE, TRANSFER_SIZE);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(test_context *ctx)
+{
+  uint8_t *buf;
+  int rv;
+
+  buf = rtems_cache_aligned_malloc(TRANSFER_SIZE + 1);
+  rtems_test_assert(buf != NULL);
+
+  ctx->aligned = buf;
+  ctx->unaligned = buf + 1;
+
+  rv = mkdir(mnt, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  rv = rtems_rfs_format(rda, &rfs_config);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    rda,
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    "direct-io=" RTEMS_XSTRING(DIRECT_IO_THRESHOLD)
+  );
+  rtems_test_assert(rv == 0);
+
+  ctx->disk_fd = open(rda, O_RDWR);
+  rtems_test_assert(ctx->disk_fd >= 0);
+
+  test_round_trip(ctx, ctx->aligned, 0);
+  test_round_trip(ctx, ctx->aligned, BLOCK_SIZE / 2);
+  test_round_trip(ctx, ctx->unaligned, 0);
+  test_round_trip(ctx, ctx->unaligned, 7);
+  test_overwrite(ctx);
+
+  rv = close(ctx->disk_fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unmount(mnt);
+  rtems_test_assert(rv == 0);
+
+  free(buf);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = BLOCK_SIZE, .block_num = 1024 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
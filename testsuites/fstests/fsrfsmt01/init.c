@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/libio.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "FSRFSMT 1";
+
+#define WORKER_COUNT 4
+
+#define FILE_SIZE (128 * 1024)
+
+#define CHUNK_SIZE 1024
+
+#define ROUNDS 4
+
+static const rtems_rfs_format_config rfs_config;
+
+static const char rda [] = "/dev/rda";
+
+static const char mnt [] = "/mnt";
+
+typedef struct {
+  rtems_id init_task;
+  rtems_id workers [WORKER_COUNT];
+  uint8_t chunks [WORKER_COUNT][CHUNK_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static uint8_t pattern(size_t index, int round, size_t position)
+{
+  return (uint8_t) (index * 61 + round * 17 + position / CHUNK_SIZE + position);
+}
+
+static void fill_chunk(uint8_t *chunk, size_t index, int round, size_t offset)
+{
+  size_t i;
+
+  for (i = 0; i < CHUNK_SIZE; ++i) {
+    chunk [i] = pattern(index, round, offset + i);
+  }
+}
+
+static void check_chunk(
+  const uint8_t *chunk,
+  size_t index,
+  int round,
+  size_t offset
+)
+{
+  size_t i;
+
+  for (i = 0; i < CHUNK_SIZE; ++i) {
+    rtems_test_assert(chunk [i] == pattern(index, round, offset + i));
+  }
+}
+
+static void file_path(char *path, size_t size, size_t index)
+{
+  snprintf(path, size, "%s/file-%zu", mnt, index);
+}
+
+static void check_file(int fd, uint8_t *chunk, size_t index, int round)
+{
+  struct stat st;
+  size_t offset;
+  ssize_t n;
+  int rv;
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == FILE_SIZE);
+
+  rv = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(rv == 0);
+
+  for (offset = 0; offset < FILE_SIZE; offset += CHUNK_SIZE) {
+    n = read(fd, chunk, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+    check_chunk(chunk, index, round, offset);
+  }
+
+  n = read(fd, chunk, CHUNK_SIZE);
+  rtems_test_assert(n == 0);
+}
+
+static void worker_io(test_context *ctx, size_t index)
+{
+  char path [32];
+  uint8_t *chunk = &ctx->chunks [index][0];
+  int round;
+  int fd;
+  int rv;
+
+  file_path(path, sizeof(path), index);
+
+  for (round = 0; round < ROUNDS; ++round) {
+    size_t offset;
+    ssize_t n;
+
+    /*
+     * The truncation gives the blocks of the previous round back to the
+     * bitmaps while the other workers allocate blocks for their files.
+     */
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+    rtems_test_assert(fd >= 0);
+
+    for (offset = 0; offset < FILE_SIZE; offset += CHUNK_SIZE) {
+      fill_chunk(chunk, index, round, offset);
+      n = write(fd, chunk, CHUNK_SIZE);
+      rtems_test_assert(n == CHUNK_SIZE);
+    }
+
+    check_file(fd, chunk, index, round);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void check_worker_files(test_context *ctx, size_t count)
+{
+  size_t i;
+
+  /*
+   * The files of all workers must be intact after the workers are done.  A
+   * block shared by two files due to a race in the allocation or the buffer
+   * management would show up as a pattern of another worker or round.
+   */
+  for (i = 0; i < count; ++i) {
+    char path [32];
+    int fd;
+    int rv;
+
+    file_path(path, sizeof(path), i);
+    fd = open(path, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    check_file(fd, &ctx->chunks [i][0], i, ROUNDS - 1);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  size_t index = (size_t) arg;
+  rtems_status_code sc;
+
+  worker_io(ctx, index);
+
+  sc = rtems_event_send(ctx->init_task, RTEMS_EVENT_0 << index);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static uint64_t run_workers(test_context *ctx, size_t first, size_t count)
+{
+  rtems_status_code sc;
+  rtems_event_set events = 0;
+  uint64_t begin;
+  uint64_t end;
+  size_t i;
+
+  for (i = first; i < first + count; ++i) {
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE + CHUNK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->workers [i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    events |= RTEMS_EVENT_0 << i;
+  }
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = first; i < first + count; ++i) {
+    sc = rtems_task_start(ctx->workers [i], worker_task, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_event_receive(
+    events,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  end = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = first; i < first + count; ++i) {
+    sc = rtems_task_delete(ctx->workers [i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  return end - begin;
+}
+
+static void test_create_file_system(void)
+{
+  int rv;
+
+  rv = mkdir(mnt, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  rv = rtems_rfs_format(rda, &rfs_config);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    rda,
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void test_parallel_file_io(test_context *ctx)
+{
+  uint64_t serial = 0;
+  uint64_t parallel;
+  size_t i;
+  int rv;
+
+  /*
+   * Run the workers one after the other to get the reference time and then
+   * all of them together.  With the per-file locks of the file system the
+   * workers do not serialise on a file system lock in the second run.
+   */
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    serial += run_workers(ctx, i, 1);
+  }
+
+  check_worker_files(ctx, WORKER_COUNT);
+
+  parallel = run_workers(ctx, 0, WORKER_COUNT);
+
+  check_worker_files(ctx, WORKER_COUNT);
+
+  printf(
+    "processors: %" PRIu32 ", workers: %i\n"
+    "serial: %" PRIu64 "us, parallel: %" PRIu64 "us\n",
+    rtems_scheduler_get_processor_maximum(),
+    WORKER_COUNT,
+    serial / 1000,
+    parallel / 1000
+  );
+
+  rv = unmount(mnt);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  ctx->init_task = rtems_task_self();
+
+  test_create_file_system();
+  test_parallel_file_io(ctx);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = 512, .block_num = 4096 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS (WORKER_COUNT + 3)
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_PROCESSORS WORKER_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS (WORKER_COUNT + 1)
+
+#define CONFIGURE_EXTRA_TASK_STACKS (WORKER_COUNT * CHUNK_SIZE)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
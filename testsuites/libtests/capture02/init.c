@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/capture.h>
+#include <rtems/score/threadimpl.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "CAPTURE 2";
+
+#define BUFFER_SIZE 1024
+
+#define RECORD_SIZE (sizeof(rtems_capture_record) + sizeof(uint32_t))
+
+#define RECORD_COUNT (BUFFER_SIZE / RECORD_SIZE)
+
+typedef struct {
+  uint32_t next_value;
+  uint32_t expected_value;
+} test_context;
+
+static test_context test_instance;
+
+static bool add_record(test_context *ctx)
+{
+  rtems_capture_record_lock_context lock_context;
+  void *ptr;
+
+  ptr = rtems_capture_record_open(
+    _Thread_Get_executing(),
+    RTEMS_CAPTURE_TIMESTAMP,
+    sizeof(ctx->next_value),
+    &lock_context
+  );
+
+  if (ptr != NULL) {
+    rtems_capture_record_append(ptr, &ctx->next_value, sizeof(ctx->next_value));
+    ++ctx->next_value;
+  }
+
+  rtems_capture_record_close(&lock_context);
+  return ptr != NULL;
+}
+
+static size_t add_records(test_context *ctx, size_t count)
+{
+  size_t added = 0;
+
+  while (added < count && add_record(ctx)) {
+    ++added;
+  }
+
+  return added;
+}
+
+static size_t read_records(test_context *ctx, size_t release)
+{
+  rtems_status_code sc;
+  const void *recs;
+  const uint8_t *ptr;
+  size_t read;
+  size_t i;
+
+  sc = rtems_capture_read(0, &read, &recs);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ptr = recs;
+
+  for (i = 0; i < read; ++i) {
+    rtems_capture_record rec;
+    uint32_t value;
+
+    ptr = rtems_capture_record_extract(ptr, &rec, sizeof(rec));
+    ptr = rtems_capture_record_extract(ptr, &value, sizeof(value));
+
+    rtems_test_assert(rec.size == RECORD_SIZE);
+    rtems_test_assert((rec.events & RTEMS_CAPTURE_TIMESTAMP) != 0);
+    rtems_test_assert(rec.task_id == rtems_task_self());
+
+    if (i < release) {
+      rtems_test_assert(value == ctx->expected_value);
+      ++ctx->expected_value;
+    }
+  }
+
+  if (release > read) {
+    release = read;
+  }
+
+  sc = rtems_capture_release(0, (uint32_t) release);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return read;
+}
+
+static void test_full_and_wrapped(test_context *ctx)
+{
+  size_t half;
+
+  printf("fill and wrap the record buffer\n");
+
+  /* A full buffer rejects records without a wrap */
+  rtems_test_assert(add_records(ctx, SIZE_MAX) == RECORD_COUNT);
+  rtems_test_assert(read_records(ctx, RECORD_COUNT / 2) == RECORD_COUNT);
+
+  /*
+   * The new records wrap to the front of the buffer.  A gap to the tail is
+   * kept so that a full buffer is not mistaken for an empty buffer.
+   */
+  half = RECORD_COUNT / 2;
+  rtems_test_assert(add_records(ctx, SIZE_MAX) == half - 1);
+
+  /* The first read stops at the end of the records before the wrap */
+  rtems_test_assert(
+    read_records(ctx, SIZE_MAX) == RECORD_COUNT - RECORD_COUNT / 2
+  );
+  rtems_test_assert(read_records(ctx, SIZE_MAX) == half - 1);
+  rtems_test_assert(read_records(ctx, SIZE_MAX) == 0);
+  rtems_test_assert(ctx->expected_value == ctx->next_value);
+}
+
+static void test_flush(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t added;
+
+  printf("flush a wrapped record buffer\n");
+
+  /* The head is in the middle of the buffer, so the new records wrap */
+  added = add_records(ctx, SIZE_MAX);
+  rtems_test_assert(added == RECORD_COUNT - 1);
+
+  sc = rtems_capture_flush(false);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  ctx->expected_value = ctx->next_value;
+
+  rtems_test_assert(read_records(ctx, SIZE_MAX) == 0);
+
+  /*
+   * The released count of the flush matches the discarded records, so the
+   * records added afterwards are released by the reader.
+   */
+  rtems_test_assert(add_records(ctx, 2) == 2);
+  rtems_test_assert(read_records(ctx, SIZE_MAX) == 2);
+  rtems_test_assert(read_records(ctx, SIZE_MAX) == 0);
+
+  rtems_test_assert(add_records(ctx, 3) == 3);
+  rtems_test_assert(read_records(ctx, SIZE_MAX) == 3);
+  rtems_test_assert(read_records(ctx, SIZE_MAX) == 0);
+  rtems_test_assert(ctx->expected_value == ctx->next_value);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+
+  sc = rtems_capture_open(BUFFER_SIZE, NULL);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_full_and_wrapped(ctx);
+  test_flush(ctx);
+
+  sc = rtems_capture_close();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
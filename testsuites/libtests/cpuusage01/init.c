@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <rtems/cpuuse.h>
+
+const char rtems_test_name[] = "CPUUSAGE 1";
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+#define BUSY_NS 50000000
+
+static rtems_id worker_id;
+
+static void busy(void)
+{
+  uint64_t begin;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  while (rtems_clock_get_uptime_nanoseconds() - begin < BUSY_NS) {
+    /* Wait */
+  }
+}
+
+static rtems_task worker(rtems_task_argument arg)
+{
+  rtems_event_set events;
+
+  (void) arg;
+
+  while (true) {
+    busy();
+    rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+  }
+}
+
+static void test_create(void)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &worker_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(worker_id, worker, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_sampler(void)
+{
+  rtems_cpu_usage_summary summary;
+  rtems_cpu_usage_sample  samples[4];
+  rtems_status_code       sc;
+  uintptr_t               stack_size;
+  size_t                  n;
+  size_t                  i;
+
+  sc = rtems_cpu_usage_sampler_update(&summary);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+  rtems_test_assert(rtems_cpu_usage_sampler_top(samples, 4, false) == 0);
+
+  sc = rtems_cpu_usage_sampler_create();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_cpu_usage_sampler_create();
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  sc = rtems_cpu_usage_sampler_update(&summary);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(summary.threads == 2);
+
+  /*
+   * The worker preempts Init and is busy before it waits.
+   */
+  test_create();
+
+  sc = rtems_cpu_usage_sampler_update(&summary);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(summary.threads == 3);
+  rtems_test_assert(summary.active == 2);
+  rtems_test_assert(summary.current >= BUSY_NS);
+  rtems_test_assert(summary.current_idle == 0);
+  rtems_test_assert(summary.period >= summary.current);
+
+  n = rtems_cpu_usage_sampler_top(samples, 1, false);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(samples[0].id == worker_id);
+  rtems_test_assert(samples[0].current >= BUSY_NS);
+  rtems_test_assert(samples[0].real_priority == 1);
+  rtems_test_assert(samples[0].priority == 1);
+
+  n = rtems_cpu_usage_sampler_top(samples, 4, false);
+  rtems_test_assert(n == 2);
+  rtems_test_assert(samples[0].id == worker_id);
+  rtems_test_assert(samples[1].id == rtems_task_self());
+  rtems_test_assert(samples[0].current >= samples[1].current);
+
+  /*
+   * Only Init used the processor in this period.
+   */
+  sc = rtems_cpu_usage_sampler_update(&summary);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(summary.active == 1);
+
+  n = rtems_cpu_usage_sampler_top(samples, 4, false);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(samples[0].id == rtems_task_self());
+
+  n = rtems_cpu_usage_sampler_top(samples, 4, true);
+  rtems_test_assert(n == 3);
+  rtems_test_assert(samples[0].total >= samples[1].total);
+  rtems_test_assert(samples[1].total >= samples[2].total);
+
+  for (i = 0; i < n; ++i) {
+    if (samples[i].id == worker_id) {
+      rtems_test_assert(samples[i].total >= BUSY_NS);
+      rtems_test_assert(samples[i].current == 0);
+    }
+  }
+
+  stack_size = summary.stack_size;
+
+  sc = rtems_task_delete(worker_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_cpu_usage_sampler_update(&summary);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(summary.threads == 2);
+  rtems_test_assert(summary.stack_size < stack_size);
+
+  n = rtems_cpu_usage_sampler_top(samples, 4, true);
+  rtems_test_assert(n == 2);
+
+  for (i = 0; i < n; ++i) {
+    rtems_test_assert(samples[i].id != worker_id);
+  }
+
+  rtems_cpu_usage_sampler_delete();
+
+  sc = rtems_cpu_usage_sampler_update(&summary);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+}
+
+static rtems_task Init(rtems_task_argument argument)
+{
+  TEST_BEGIN();
+
+  test_sampler();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <rtems/cpuuse.h>
+
+const char rtems_test_name[] = "CPUUSAGE 2";
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+#define BUSY_NS 50000000
+
+/* The counters are sampled at least four times per second */
+#define LONG_BUSY_NS 600000000
+
+static rtems_id worker_id;
+
+static void busy(uint64_t ns)
+{
+  uint64_t begin;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  while (rtems_clock_get_uptime_nanoseconds() - begin < ns) {
+    /* Wait */
+  }
+}
+
+static rtems_task worker(rtems_task_argument arg)
+{
+  rtems_event_set events;
+
+  (void) arg;
+
+  while (true) {
+    busy(BUSY_NS);
+    rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+  }
+}
+
+static void test_errors(void)
+{
+  rtems_cpu_usage_counters counters;
+  rtems_status_code        sc;
+
+  sc = rtems_cpu_usage_get_counters(RTEMS_SELF, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_cpu_usage_get_counters(0, &counters);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_cpu_usage_get_processor_counters(0, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_cpu_usage_get_processor_counters(
+    rtems_scheduler_get_processor_maximum(),
+    &counters
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+}
+
+static void test_counters(void)
+{
+  rtems_cpu_usage_counters worker_counters;
+  rtems_cpu_usage_counters self_begin;
+  rtems_cpu_usage_counters self_end;
+  rtems_cpu_usage_counters cpu_counters;
+  rtems_status_code        sc;
+
+  rtems_test_assert(!rtems_cpu_usage_counters_are_enabled());
+
+  sc = rtems_cpu_usage_counters_enable();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(rtems_cpu_usage_counters_are_enabled());
+
+  sc = rtems_cpu_usage_counters_enable();
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &worker_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The worker preempts us, is busy for a while and then blocks */
+  sc = rtems_task_start(worker_id, worker, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_cpu_usage_get_counters(worker_id, &worker_counters);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(worker_counters.cycles > 0);
+
+  if (rtems_cpu_usage_counters_have_events()) {
+    rtems_test_assert(worker_counters.instructions > 0);
+  } else {
+    rtems_test_assert(worker_counters.instructions == 0);
+    rtems_test_assert(worker_counters.cache_misses == 0);
+  }
+
+  sc = rtems_cpu_usage_get_processor_counters(0, &cpu_counters);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(cpu_counters.cycles >= worker_counters.cycles);
+
+  rtems_cpu_usage_report();
+
+  rtems_cpu_usage_reset();
+
+  sc = rtems_cpu_usage_get_counters(worker_id, &worker_counters);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(worker_counters.cycles == 0);
+  rtems_test_assert(worker_counters.instructions == 0);
+  rtems_test_assert(worker_counters.cache_misses == 0);
+
+  sc = rtems_cpu_usage_get_processor_counters(0, &cpu_counters);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(cpu_counters.cycles == 0);
+
+  sc = rtems_event_send(worker_id, RTEMS_EVENT_0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_cpu_usage_get_counters(worker_id, &worker_counters);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(worker_counters.cycles > 0);
+
+  /*
+   * There is no thread switch while we are busy, so our counters increase
+   * only through the periodic sampling.
+   */
+  sc = rtems_cpu_usage_get_counters(RTEMS_SELF, &self_begin);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  busy(LONG_BUSY_NS);
+  sc = rtems_cpu_usage_get_counters(RTEMS_SELF, &self_end);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(self_end.cycles > self_begin.cycles);
+
+  rtems_cpu_usage_counters_disable();
+  rtems_test_assert(!rtems_cpu_usage_counters_are_enabled());
+
+  sc = rtems_task_delete(worker_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static rtems_task Init(rtems_task_argument argument)
+{
+  TEST_BEGIN();
+
+  test_errors();
+  test_counters();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_CPU_USAGE_COUNTERS
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
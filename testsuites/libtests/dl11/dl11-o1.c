@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include "dl11.h"
+
+static const char* const dl11_o1_names[] = {
+  "zero", "one", "two", "three", "four", "five", "six", "seven"
+};
+
+static int dl11_o1_add(int arg)
+{
+  return arg + 1;
+}
+
+static int dl11_o1_sub(int arg)
+{
+  return arg - 1;
+}
+
+static int (* const dl11_o1_ops[])(int arg) = {
+  dl11_o1_add,
+  dl11_o1_sub,
+  dl11_o1_add,
+  dl11_o1_add
+};
+
+int dl11_o1_func(int arg)
+{
+  return dl11_o1_ops[arg & 3](arg);
+}
+
+const char* dl11_o1_name(int index)
+{
+  return dl11_o1_names[index & 7];
+}
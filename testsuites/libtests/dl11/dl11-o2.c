@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include "dl11.h"
+
+#include <string.h>
+
+int dl11_o2_value = 20;
+
+int* dl11_o2_value_ref = &dl11_o2_value;
+
+int dl11_o2_func(int arg)
+{
+  const char* name = dl11_o1_name(arg);
+
+  return dl11_o1_func(arg) + *dl11_o2_value_ref + (int) strlen(name);
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include "dl11.h"
+
+#include <string.h>
+
+static int dl11_o3_data[16];
+
+int dl11_o3_func(int arg)
+{
+  int sum = 0;
+  int i;
+
+  memset(dl11_o3_data, 0, sizeof(dl11_o3_data));
+
+  for (i = 0; i < 16; ++i)
+    dl11_o3_data[i] = dl11_o1_func(arg + i);
+
+  for (i = 0; i < 16; ++i)
+    sum += dl11_o3_data[i];
+
+  return sum;
+}
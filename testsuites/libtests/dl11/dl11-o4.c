@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include "dl11.h"
+
+typedef int (*dl11_func)(int arg);
+
+static const dl11_func dl11_o4_funcs[] = {
+  dl11_o1_func,
+  dl11_o2_func,
+  dl11_o3_func
+};
+
+int dl11_o4_func(int arg)
+{
+  int sum = 0;
+  int i;
+
+  for (i = 0; i < 3; ++i)
+    sum += dl11_o4_funcs[i](arg);
+
+  return sum;
+}
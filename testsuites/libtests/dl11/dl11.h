@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if !defined(DL11_H)
+#define DL11_H
+
+/*
+ * A set of modules with code, data, strings and relocations to measure the
+ * time it takes to load them.
+ */
+
+int dl11_o1_func(int arg);
+int dl11_o2_func(int arg);
+int dl11_o3_func(int arg);
+int dl11_o4_func(int arg);
+
+const char* dl11_o1_name(int index);
+
+#endif
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <dirent.h>
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <rtems/rtl/rtl.h>
+#include <rtems/imfs.h>
+
+const char rtems_test_name[] = "libdl (RTL) 11";
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+#include "dl11-tar.h"
+
+#define TARFILE_START dl11_tar
+#define TARFILE_SIZE  dl11_tar_size
+
+#define MODULE_COUNT 4
+
+#define ITERATIONS 32
+
+typedef int (*dl11_func)(int arg);
+
+static const char* const modules[MODULE_COUNT] = {
+  "dl11-o1.o",
+  "dl11-o2.o",
+  "dl11-o3.o",
+  "dl11-o4.o"
+};
+
+static void copy_file(const char* from, const char* to)
+{
+  char    buf[256];
+  ssize_t n;
+  int     in;
+  int     out;
+  int     rv;
+
+  in = open(from, O_RDONLY);
+  rtems_test_assert(in >= 0);
+
+  out = open(to, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(out >= 0);
+
+  while ((n = read(in, buf, sizeof(buf))) > 0) {
+    rtems_test_assert(write(out, buf, (size_t) n) == n);
+  }
+
+  rtems_test_assert(n == 0);
+
+  rv = close(out);
+  rtems_test_assert(rv == 0);
+
+  rv = close(in);
+  rtems_test_assert(rv == 0);
+}
+
+static uint64_t load_modules(const char* dir)
+{
+  void*     handles[MODULE_COUNT];
+  char      path[64];
+  dl11_func func;
+  uint64_t  begin;
+  uint64_t  delta;
+  int       i;
+  int       rv;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < MODULE_COUNT; ++i) {
+    snprintf(path, sizeof(path), "%s/%s", dir, modules[i]);
+    handles[i] = dlopen(path, RTLD_NOW | RTLD_GLOBAL);
+    if (handles[i] == NULL) {
+      printf("dlopen failed: %s: %s\n", path, dlerror());
+      rtems_test_exit(1);
+    }
+  }
+
+  delta = rtems_clock_get_uptime_nanoseconds() - begin;
+
+  func = dlsym(RTLD_DEFAULT, "dl11_o4_func");
+  rtems_test_assert(func != NULL);
+  rtems_test_assert((*func)(5) == 240);
+
+  for (i = MODULE_COUNT - 1; i >= 0; --i) {
+    rv = dlclose(handles[i]);
+    rtems_test_assert(rv == 0);
+  }
+
+  return delta;
+}
+
+static void test_dlopen_latency(const char* desc, const char* dir)
+{
+  uint64_t total = 0;
+  uint64_t max = 0;
+  int      i;
+
+  /* Warm up the loader */
+  load_modules(dir);
+
+  for (i = 0; i < ITERATIONS; ++i) {
+    uint64_t delta = load_modules(dir);
+
+    total += delta;
+    if (delta > max)
+      max = delta;
+  }
+
+  printf(
+    "%s: dlopen() of %i modules: avg %" PRIu64 "us, max %" PRIu64 "us\n",
+    desc,
+    MODULE_COUNT,
+    total / ITERATIONS / 1000,
+    max / 1000
+  );
+}
+
+static int count_files(const char* dir)
+{
+  DIR*           d;
+  struct dirent* de;
+  int            count = 0;
+  int            rv;
+
+  d = opendir(dir);
+  rtems_test_assert(d != NULL);
+
+  while ((de = readdir(d)) != NULL) {
+    if (strcmp(de->d_name, ".") != 0 && strcmp(de->d_name, "..") != 0)
+      ++count;
+  }
+
+  rv = closedir(d);
+  rtems_test_assert(rv == 0);
+
+  return count;
+}
+
+static void Init(rtems_task_argument arg)
+{
+  char from[64];
+  char to[64];
+  int  te;
+  int  i;
+
+  TEST_BEGIN();
+
+  te = rtems_tarfs_load("/", (void *)TARFILE_START, (size_t)TARFILE_SIZE);
+  if (te != 0)
+  {
+    printf("untar failed: %d\n", te);
+    rtems_test_exit(1);
+    exit (1);
+  }
+
+  /*
+   * The untar'ed modules are linear files referencing the tar image. The
+   * copies in memory files have to be read through the object file cache.
+   */
+  te = mkdir("/mem", S_IRWXU);
+  rtems_test_assert(te == 0);
+
+  for (i = 0; i < MODULE_COUNT; ++i) {
+    snprintf(from, sizeof(from), "/%s", modules[i]);
+    snprintf(to, sizeof(to), "/mem/%s", modules[i]);
+    copy_file(from, to);
+  }
+
+  test_dlopen_latency("tar image", "");
+  test_dlopen_latency("memory file", "/mem");
+
+  /*
+   * The first load writes a relocation cache file for each module, the
+   * following loads use them.
+   */
+  te = mkdir("/rlc", S_IRWXU);
+  rtems_test_assert(te == 0);
+
+  rtems_test_assert(rtems_rtl_reloc_cache_set_path("/rlc"));
+  test_dlopen_latency("tar image, relocation cache", "");
+  rtems_test_assert(count_files("/rlc") == MODULE_COUNT);
+  rtems_test_assert(rtems_rtl_reloc_cache_set_path(NULL));
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (8U * 1024U)
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES   (RTEMS_DEFAULT_ATTRIBUTES | RTEMS_FLOATING_POINT)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
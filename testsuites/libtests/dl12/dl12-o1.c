@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include "dl12.h"
+
+int dl12_o1_func(int arg)
+{
+  return dl12_o2_func(arg) + dl12_o5_func(arg);
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if !defined(DL12_H)
+#define DL12_H
+
+/*
+ * The object files dl12-o2.o and dl12-o3.o are in libdl12_1.a, dl12-o4.o and
+ * dl12-o5.o are in libdl12_2.a.  The members of both archives reference each
+ * other.  The object files dl12-o6.o and dl12-o7.o are loaded directly.
+ */
+
+int dl12_o1_func(int arg);
+int dl12_o2_func(int arg);
+int dl12_o3_func(int arg);
+int dl12_o4_func(int arg);
+int dl12_o5_func(int arg);
+int dl12_o6_func(int arg);
+int dl12_o7_func(int arg);
+
+extern int dl12_o3_value;
+
+#endif
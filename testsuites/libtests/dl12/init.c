@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <dlfcn.h>
+#include <string.h>
+#include <stdint.h>
+
+#include <rtems/rtl/rtl.h>
+#include <rtems/rtl/rtl-unresolved.h>
+#include <rtems/imfs.h>
+
+#include "dl12.h"
+
+const char rtems_test_name[] = "libdl (RTL) 12";
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+#include "dl12-tar.h"
+
+#define TARFILE_START dl12_tar
+#define TARFILE_SIZE  dl12_tar_size
+
+typedef int (*dl12_func)(int arg);
+
+typedef struct
+{
+  rtems_rtl_unresolved* unresolved;
+  size_t                names;
+  size_t                relocs;
+  const char*           name;
+  size_t                name_refs;
+  size_t                name_relocs;
+} unresolved_state;
+
+static bool get_unresolved_iterator(rtems_rtl_unresolv_rec* rec, void* data)
+{
+  unresolved_state*         state = data;
+  rtems_rtl_unresolv_index* index = &state->unresolved->index;
+
+  if (rec->type == rtems_rtl_unresolved_symbol) {
+    /*
+     * Each name in the table has an identifier which references the name in
+     * the index.
+     */
+    rtems_test_assert(rec->rec.name.id != 0);
+    rtems_test_assert(rec->rec.name.id < index->size);
+    rtems_test_assert(index->names[rec->rec.name.id] == rec);
+    ++state->names;
+
+    if (state->name != NULL && strcmp(rec->rec.name.name, state->name) == 0)
+      state->name_refs = rec->rec.name.refs;
+  } else if (rec->type == rtems_rtl_unresolved_reloc) {
+    const rtems_rtl_unresolv_rec* name;
+
+    /*
+     * A relocation references the name by the identifier.
+     */
+    rtems_test_assert(rec->rec.reloc.name < index->size);
+    name = index->names[rec->rec.reloc.name];
+    rtems_test_assert(name != NULL);
+    ++state->relocs;
+
+    if (state->name != NULL && strcmp(name->rec.name.name, state->name) == 0)
+      ++state->name_relocs;
+  }
+
+  return false;
+}
+
+static void get_unresolved(unresolved_state* state, const char* name)
+{
+  rtems_rtl_unresolv_index* index;
+  size_t                    indexed = 0;
+  size_t                    id;
+
+  memset(state, 0, sizeof(*state));
+  state->name = name;
+
+  rtems_test_assert(rtems_rtl_lock() != NULL);
+
+  state->unresolved = rtems_rtl_unresolved_unprotected();
+  rtems_test_assert(state->unresolved != NULL);
+  index = &state->unresolved->index;
+
+  rtems_rtl_unresolved_iterate(get_unresolved_iterator, state);
+
+  /*
+   * The index holds the names in the table and nothing else.
+   */
+  for (id = 1; id < index->size; ++id) {
+    if (index->names[id] != NULL)
+      ++indexed;
+  }
+
+  rtems_test_assert(indexed == state->names);
+
+  rtems_rtl_unlock();
+}
+
+static void* load(const char* name, int expected_unresolved)
+{
+  void* handle;
+  int   unresolved;
+  int   rv;
+
+  handle = dlopen(name, RTLD_NOW | RTLD_GLOBAL);
+  if (handle == NULL) {
+    printf("dlopen failed: %s: %s\n", name, dlerror());
+    rtems_test_exit(1);
+  }
+
+  unresolved = -1;
+  rv = dlinfo(handle, RTLD_DI_UNRESOLVED, &unresolved);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(unresolved == expected_unresolved);
+
+  return handle;
+}
+
+static int call(void* handle, const char* name, int arg)
+{
+  dl12_func func;
+
+  func = dlsym(handle, name);
+  rtems_test_assert(func != NULL);
+
+  return (*func)(arg);
+}
+
+static void test_archive_cross_references(void)
+{
+  unresolved_state state;
+  void*            o1;
+
+  printf("load object file with references into archives\n");
+
+  get_unresolved(&state, NULL);
+  rtems_test_assert(state.names == 0);
+  rtems_test_assert(state.relocs == 0);
+
+  /*
+   * The object file references members of both archives which reference
+   * members of the other archive. All object files are loaded through the
+   * names of the index and all names are removed from the index once they are
+   * resolved.
+   */
+  o1 = load("/dl12-o1.o", 0);
+
+  rtems_test_assert(call(o1, "dl12_o1_func", 5) == 23);
+  rtems_test_assert(call(RTLD_DEFAULT, "dl12_o2_func", 5) == 16);
+  rtems_test_assert(call(RTLD_DEFAULT, "dl12_o3_func", 5) == 15);
+  rtems_test_assert(call(RTLD_DEFAULT, "dl12_o4_func", 5) == 8);
+  rtems_test_assert(call(RTLD_DEFAULT, "dl12_o5_func", 5) == 7);
+
+  get_unresolved(&state, NULL);
+  rtems_test_assert(state.unresolved->index.size > 0);
+  rtems_test_assert(state.names == 0);
+  rtems_test_assert(state.relocs == 0);
+}
+
+static void test_unresolved_until_loaded(void)
+{
+  unresolved_state state;
+  void*            o6;
+
+  printf("load object file with references resolved by a later load\n");
+
+  /*
+   * No archive provides the referenced function so the name stays in the
+   * index with a reference for each relocation.
+   */
+  o6 = load("/dl12-o6.o", 1);
+
+  get_unresolved(&state, "dl12_o7_func");
+  rtems_test_assert(state.names == 1);
+  rtems_test_assert(state.relocs > 0);
+  rtems_test_assert(state.name_relocs == state.relocs);
+  rtems_test_assert(state.name_refs == state.name_relocs);
+
+  /*
+   * Loading the object file with the function resolves the relocations and
+   * removes the name from the index.
+   */
+  load("/dl12-o7.o", 0);
+
+  get_unresolved(&state, "dl12_o7_func");
+  rtems_test_assert(state.names == 0);
+  rtems_test_assert(state.relocs == 0);
+
+  rtems_test_assert(call(o6, "dl12_o6_func", 5) == 77);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  int te;
+
+  TEST_BEGIN();
+
+  te = rtems_tarfs_load("/", (void *)TARFILE_START, (size_t)TARFILE_SIZE);
+  if (te != 0)
+  {
+    printf("untar failed: %d\n", te);
+    rtems_test_exit(1);
+    exit (1);
+  }
+
+  test_archive_cross_references();
+  test_unresolved_until_loaded();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (8U * 1024U)
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES   (RTEMS_DEFAULT_ATTRIBUTES | RTEMS_FLOATING_POINT)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
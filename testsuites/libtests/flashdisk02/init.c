@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/flashdisk.h>
+
+const char rtems_test_name[] = "FLASHDISK 2";
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+#define FLASHDISK_CONFIG_COUNT 2
+
+#define FLASHDISK_DEVICE_COUNT 1
+
+#define FLASHDISK_SEGMENT_COUNT 32U
+
+#define FLASHDISK_SEGMENT_SIZE (8 * 1024)
+
+#define FLASHDISK_BLOCK_SIZE 512U
+
+#define FLASHDISK_BLOCKS_PER_SEGMENT \
+  (FLASHDISK_SEGMENT_SIZE / FLASHDISK_BLOCK_SIZE - 1)
+
+#define FLASHDISK_UNAVAIL_BLOCKS (2 * FLASHDISK_BLOCKS_PER_SEGMENT)
+
+#define FLASHDISK_BLOCK_COUNT \
+  (FLASHDISK_SEGMENT_COUNT * FLASHDISK_BLOCKS_PER_SEGMENT \
+    - FLASHDISK_UNAVAIL_BLOCKS)
+
+#define FLASHDISK_SIZE \
+  (FLASHDISK_SEGMENT_COUNT * FLASHDISK_SEGMENT_SIZE)
+
+#define WRITE_COUNT 4000
+
+#define WRITES_PER_IDLE 8
+
+#define COMPACT_TASK_PRIORITY 20
+
+static uint8_t flashdisk_data [FLASHDISK_CONFIG_COUNT * FLASHDISK_SIZE];
+
+static uint32_t
+flashdisk_erases [FLASHDISK_CONFIG_COUNT * FLASHDISK_SEGMENT_COUNT];
+
+static uint32_t generations [FLASHDISK_BLOCK_COUNT];
+
+static uint8_t block_buffer [FLASHDISK_BLOCK_SIZE];
+
+static uint8_t expected_buffer [FLASHDISK_BLOCK_SIZE];
+
+static rtems_status_code request_status;
+
+static void request_done(rtems_blkdev_request *req, rtems_status_code status)
+{
+  request_status = status;
+}
+
+static rtems_status_code transfer(
+  rtems_disk_device *dd,
+  rtems_blkdev_request_op op,
+  rtems_blkdev_bnum block,
+  void *buffer
+)
+{
+  struct {
+    rtems_blkdev_request req;
+    rtems_blkdev_sg_buffer buf;
+  } r;
+  int rv;
+
+  memset(&r, 0, sizeof(r));
+  r.req.req = op;
+  r.req.done = request_done;
+  r.req.bufnum = 1;
+  r.buf.block = block;
+  r.buf.length = FLASHDISK_BLOCK_SIZE;
+  r.buf.buffer = buffer;
+
+  request_status = RTEMS_NOT_DEFINED;
+
+  /* Call the driver directly to measure it without the block device cache */
+  rv = (*dd->ioctl)(dd, RTEMS_BLKIO_REQUEST, &r.req);
+  rtems_test_assert(rv == 0);
+
+  return request_status;
+}
+
+static void fill_block(uint8_t *buffer, uint32_t block)
+{
+  size_t i;
+
+  for (i = 0; i < FLASHDISK_BLOCK_SIZE; ++i) {
+    buffer[i] = (uint8_t) (block * 7 + generations[block] * 13 + i);
+  }
+}
+
+static void test_disk(const char *device, uint32_t minor, const char *name)
+{
+  rtems_disk_device *dd;
+  uint64_t max_time = 0;
+  uint64_t total_time = 0;
+  uint32_t min_erases = UINT32_MAX;
+  uint32_t max_erases = 0;
+  uint32_t seed = 1;
+  uint32_t i;
+  int fd;
+  int rv;
+
+  memset(&generations[0], 0, sizeof(generations));
+
+  fd = open(device, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  /*
+   * Nine of ten writes go to the first quarter of the blocks, so that some
+   * segments hold mostly stale pages and need compaction.
+   */
+  for (i = 0; i < WRITE_COUNT; ++i) {
+    rtems_status_code sc;
+    uint32_t block;
+    uint64_t begin;
+    uint64_t delta;
+
+    seed = seed * 1103515245 + 12345;
+
+    if (((seed >> 8) % 10) < 9) {
+      block = (seed >> 12) % (FLASHDISK_BLOCK_COUNT / 4);
+    } else {
+      block = (seed >> 12) % FLASHDISK_BLOCK_COUNT;
+    }
+
+    ++generations[block];
+    fill_block(block_buffer, block);
+
+    begin = rtems_clock_get_uptime_nanoseconds();
+    sc = transfer(dd, RTEMS_BLKDEV_REQ_WRITE, block, block_buffer);
+    delta = rtems_clock_get_uptime_nanoseconds() - begin;
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    total_time += delta;
+
+    if (delta > max_time) {
+      max_time = delta;
+    }
+
+    /* Give the background compaction task some idle time */
+    if ((i % WRITES_PER_IDLE) == WRITES_PER_IDLE - 1) {
+      sc = rtems_task_wake_after(1);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+
+  for (i = 0; i < FLASHDISK_BLOCK_COUNT; ++i) {
+    if (generations[i] != 0) {
+      rtems_status_code sc;
+
+      fill_block(expected_buffer, i);
+      sc = transfer(dd, RTEMS_BLKDEV_REQ_READ, i, block_buffer);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+      rtems_test_assert(
+        memcmp(block_buffer, expected_buffer, FLASHDISK_BLOCK_SIZE) == 0
+      );
+    }
+  }
+
+  for (i = 0; i < FLASHDISK_SEGMENT_COUNT; ++i) {
+    uint32_t erases = flashdisk_erases[minor * FLASHDISK_SEGMENT_COUNT + i];
+
+    if (erases < min_erases) {
+      min_erases = erases;
+    }
+
+    if (erases > max_erases) {
+      max_erases = erases;
+    }
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  printf(
+    "%s: write max %" PRIu64 "us, average %" PRIu64 "us, "
+      "segment erases min %" PRIu32 ", max %" PRIu32 "\n",
+    name,
+    max_time / 1000,
+    total_time / WRITE_COUNT / 1000,
+    min_erases,
+    max_erases
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_disk("/dev/fdda", 0, "foreground compaction");
+  test_disk("/dev/fddb", 1, "background compaction");
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+static void erase_device(void)
+{
+  memset(&flashdisk_data [0], 0xff, sizeof(flashdisk_data));
+}
+
+static rtems_device_driver flashdisk_initialize(
+  rtems_device_major_number major,
+  rtems_device_minor_number minor,
+  void *arg
+)
+{
+  erase_device();
+
+  return rtems_fdisk_initialize(major, minor, arg);
+}
+
+static uint32_t get_offset(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t segment,
+  uint32_t offset
+)
+{
+  return offset + sd->offset + (segment - sd->segment) * sd->size;
+}
+
+static uint8_t *get_data_pointer(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t segment,
+  uint32_t offset
+)
+{
+  return &flashdisk_data [get_offset(sd, segment, offset)];
+}
+
+static int flashdisk_read(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  void *buffer,
+  uint32_t size
+)
+{
+  const uint8_t *data = get_data_pointer(sd, segment, offset);
+
+  memcpy(buffer, data, size);
+
+  return 0;
+}
+
+static int flashdisk_write(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  const void *buffer,
+  uint32_t size
+)
+{
+  uint8_t *data = get_data_pointer(sd, segment, offset);
+  const uint8_t *src = buffer;
+  uint32_t i;
+
+  /* Like NOR flash, a write can only clear bits */
+  for (i = 0; i < size; ++i) {
+    data[i] &= src[i];
+  }
+
+  return 0;
+}
+
+static int flashdisk_blank(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  uint32_t size
+)
+{
+  int eno = 0;
+  const uint8_t *current = get_data_pointer(sd, segment, offset);
+  const uint8_t *end = current + size;
+
+  while (eno == 0 && current != end) {
+    if (*current != 0xff) {
+      eno = EIO;
+    }
+    ++current;
+  }
+
+  return eno;
+}
+
+static int flashdisk_verify(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  const void *buffer,
+  uint32_t size
+)
+{
+  int eno = 0;
+  uint8_t *data = get_data_pointer(sd, segment, offset);
+
+  if (memcmp(data, buffer, size) != 0) {
+    eno = EIO;
+  }
+
+  return eno;
+}
+
+static int flashdisk_erase(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment
+)
+{
+  uint8_t *data = get_data_pointer(sd, segment, 0);
+
+  memset(data, 0xff, sd->size);
+  ++flashdisk_erases[get_offset(sd, segment, 0) / FLASHDISK_SEGMENT_SIZE];
+
+  return 0;
+}
+
+static int flashdisk_erase_device(
+  const rtems_fdisk_device_desc *sd,
+  uint32_t device
+)
+{
+  uint32_t segment;
+
+  for (segment = 0; segment < FLASHDISK_SEGMENT_COUNT; ++segment) {
+    flashdisk_erase(&sd->segments[0], device, segment);
+  }
+
+  return 0;
+}
+
+static const rtems_fdisk_segment_desc flashdisk_segment_desc[] = {
+  {
+    .count = FLASHDISK_SEGMENT_COUNT,
+    .segment = 0,
+    .offset = 0,
+    .size = FLASHDISK_SEGMENT_SIZE
+  }, {
+    .count = FLASHDISK_SEGMENT_COUNT,
+    .segment = 0,
+    .offset = FLASHDISK_SIZE,
+    .size = FLASHDISK_SEGMENT_SIZE
+  }
+};
+
+static const rtems_fdisk_driver_handlers flashdisk_ops = {
+  .read = flashdisk_read,
+  .write = flashdisk_write,
+  .blank = flashdisk_blank,
+  .verify = flashdisk_verify,
+  .erase = flashdisk_erase,
+  .erase_device = flashdisk_erase_device
+};
+
+static const rtems_fdisk_device_desc flashdisk_device[] = {
+  {
+    .segment_count = 1,
+    .segments = &flashdisk_segment_desc[0],
+    .flash_ops = &flashdisk_ops
+  }, {
+    .segment_count = 1,
+    .segments = &flashdisk_segment_desc[1],
+    .flash_ops = &flashdisk_ops
+  }
+};
+
+const rtems_flashdisk_config
+rtems_flashdisk_configuration [FLASHDISK_CONFIG_COUNT] = {
+  {
+    .block_size = FLASHDISK_BLOCK_SIZE,
+    .device_count = FLASHDISK_DEVICE_COUNT,
+    .devices = &flashdisk_device[0],
+    .flags = RTEMS_FDISK_CHECK_PAGES,
+    .unavail_blocks = FLASHDISK_UNAVAIL_BLOCKS,
+    .compact_segs = 4,
+    .avail_compact_segs = 3,
+    .info_level = 0
+  }, {
+    .block_size = FLASHDISK_BLOCK_SIZE,
+    .device_count = FLASHDISK_DEVICE_COUNT,
+    .devices = &flashdisk_device[1],
+    .flags = RTEMS_FDISK_CHECK_PAGES
+      | RTEMS_FDISK_BACKGROUND_ERASE
+      | RTEMS_FDISK_BACKGROUND_COMPACT,
+    .unavail_blocks = FLASHDISK_UNAVAIL_BLOCKS,
+    .compact_segs = 4,
+    .avail_compact_segs = 3,
+    .info_level = 0,
+    .compact_task_priority = COMPACT_TASK_PRIORITY
+  }
+};
+
+uint32_t rtems_flashdisk_configuration_size = FLASHDISK_CONFIG_COUNT;
+
+#define FLASHDISK_DRIVER { .initialization_entry = flashdisk_initialize }
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS FLASHDISK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS (2 * RTEMS_MINIMUM_STACK_SIZE)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 10
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
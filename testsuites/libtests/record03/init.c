@@ -0,0 +1,198 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/record.h>
+#include <rtems.h>
+
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "RECORD 3";
+
+typedef struct {
+  size_t            pc_count;
+  size_t            caller_count;
+  rtems_record_data callers[ RTEMS_RECORD_PROFILER_DEPTH_MAXIMUM ];
+} test_context;
+
+static test_context test_instance;
+
+static void drain_visitor(
+  const rtems_record_item *items,
+  size_t                   count,
+  void                    *arg
+)
+{
+  test_context *ctx;
+  size_t        i;
+
+  ctx = arg;
+
+  for ( i = 0; i < count; ++i ) {
+    rtems_record_event event;
+
+    event = RTEMS_RECORD_GET_EVENT( items[ i ].event );
+
+    if ( event == RTEMS_RECORD_SAMPLE_PC ) {
+      ++ctx->pc_count;
+    } else if ( event == RTEMS_RECORD_SAMPLE_CALLER ) {
+      if ( ctx->caller_count < RTEMS_ARRAY_SIZE( ctx->callers ) ) {
+        ctx->callers[ ctx->caller_count ] = items[ i ].data;
+      }
+
+      ++ctx->caller_count;
+    }
+  }
+}
+
+static void drain( test_context *ctx )
+{
+  memset( ctx, 0, sizeof( *ctx ) );
+  rtems_record_drain( drain_visitor, ctx );
+}
+
+static void test_sample_context( test_context *ctx )
+{
+  uintptr_t frames[ 6 ];
+
+  /* Build a frame pointer chain with three frame records on our stack */
+  frames[ 0 ] = (uintptr_t) &frames[ 2 ];
+  frames[ 1 ] = 0x1000;
+  frames[ 2 ] = (uintptr_t) &frames[ 4 ];
+  frames[ 3 ] = 0x2000;
+  frames[ 4 ] = 0;
+  frames[ 5 ] = 0x3000;
+
+  drain( ctx );
+
+  rtems_record_profiler_sample_context( 0, (uintptr_t) &frames[ 0 ] );
+  drain( ctx );
+  rtems_test_assert( ctx->pc_count == 0 );
+  rtems_test_assert( ctx->caller_count == 0 );
+
+  /* Set the depth */
+  rtems_record_profiler_start( 1, RTEMS_RECORD_PROFILER_DEPTH_MAXIMUM );
+  rtems_record_profiler_stop();
+  drain( ctx );
+
+  rtems_record_profiler_sample_context( 0x123, 0 );
+  drain( ctx );
+  rtems_test_assert( ctx->pc_count == 1 );
+  rtems_test_assert( ctx->caller_count == 0 );
+
+  rtems_record_profiler_sample_context( 0x123, (uintptr_t) &frames[ 0 ] );
+  drain( ctx );
+  rtems_test_assert( ctx->pc_count == 1 );
+  rtems_test_assert( ctx->caller_count == 3 );
+  rtems_test_assert( ctx->callers[ 0 ] == 0x1000 );
+  rtems_test_assert( ctx->callers[ 1 ] == 0x2000 );
+  rtems_test_assert( ctx->callers[ 2 ] == 0x3000 );
+
+  /* A frame pointer outside the thread stack is not followed */
+  rtems_record_profiler_sample_context( 0x123, sizeof( uintptr_t ) );
+  drain( ctx );
+  rtems_test_assert( ctx->pc_count == 1 );
+  rtems_test_assert( ctx->caller_count == 0 );
+
+  rtems_record_profiler_start( 1, 2 );
+  rtems_record_profiler_stop();
+  drain( ctx );
+
+  rtems_record_profiler_sample_context( 0x123, (uintptr_t) &frames[ 0 ] );
+  drain( ctx );
+  rtems_test_assert( ctx->pc_count == 1 );
+  rtems_test_assert( ctx->caller_count == 2 );
+}
+
+static void busy( rtems_interval ticks )
+{
+  rtems_interval begin;
+
+  begin = rtems_clock_get_ticks_since_boot();
+
+  while ( rtems_clock_get_ticks_since_boot() - begin < ticks ) {
+    /* Wait */
+  }
+}
+
+static void test_profiler( test_context *ctx )
+{
+  drain( ctx );
+
+  rtems_record_profiler_start( 1, RTEMS_RECORD_PROFILER_DEPTH_MAXIMUM );
+  busy( 10 );
+  rtems_record_profiler_stop();
+
+  drain( ctx );
+
+#if defined(CPU_PROVIDES_INTERRUPTED_CONTEXT) \
+  && CPU_PROVIDES_INTERRUPTED_CONTEXT == TRUE
+  rtems_test_assert( ctx->pc_count > 0 );
+#else
+  rtems_test_assert( ctx->pc_count == 0 );
+#endif
+
+  busy( 10 );
+  drain( ctx );
+  rtems_test_assert( ctx->pc_count == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  test_sample_context( ctx );
+  test_profiler( ctx );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS 512
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
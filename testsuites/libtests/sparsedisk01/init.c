@@ -343,6 +343,219 @@ static void test_with_whitebox( const char *device_name )
     );
 }
 
+/* Blocks with buffer of the sparse disk for the many blocks test */
+#define MANY_ALLOCATED_BLOCK_COUNT 256
+
+/* Blocks simulated by the sparse disk for the many blocks test */
+#define MANY_SIMULATED_BLOCK_COUNT 65536
+
+/* Block size of the sparse disk for the many blocks test */
+#define MANY_BLOCK_SIZE 512
+
+/* Blocks in one multi-block request of the many blocks test */
+#define MANY_REQUEST_BLOCK_COUNT 8
+
+static rtems_status_code request_status;
+
+static void request_done( rtems_blkdev_request *req, rtems_status_code sc )
+{
+  (void) req;
+  request_status = sc;
+}
+
+/*
+ * Transfer a contiguous range of blocks with one request directly to the
+ * sparse disk driver
+ */
+static rtems_status_code transfer_blocks(
+  rtems_disk_device      *dd,
+  rtems_blkdev_request_op op,
+  rtems_blkdev_bnum       block,
+  uint32_t                block_count,
+  uint8_t                *buff )
+{
+  struct {
+    rtems_blkdev_request   req;
+    rtems_blkdev_sg_buffer sg;
+  } r;
+  int rv;
+
+
+  memset( &r, 0, sizeof( r ) );
+  r.req.req     = op;
+  r.req.done    = request_done;
+  r.req.bufnum  = 1;
+  r.sg.block    = block;
+  r.sg.length   = block_count * MANY_BLOCK_SIZE;
+  r.sg.buffer   = buff;
+  request_status = RTEMS_NOT_DEFINED;
+
+  rv = ( *dd->ioctl )( dd, RTEMS_BLKIO_REQUEST, &r.req );
+  rtems_test_assert( 0 == rv );
+
+  return request_status;
+}
+
+static rtems_blkdev_bnum many_block( unsigned int i )
+{
+  /* Scatter the blocks over the disk in no particular order */
+  return ( i * 7919 ) % MANY_SIMULATED_BLOCK_COUNT;
+}
+
+static void fill_many_block( uint8_t *buff, rtems_blkdev_bnum block )
+{
+  unsigned int i;
+
+
+  for ( i = 0; i < MANY_BLOCK_SIZE; ++i )
+    buff[i] = (uint8_t) ( block + i + 1 );
+}
+
+/*
+ * Fill a sparse disk with scattered blocks and use multi-block requests
+ */
+static void test_many_blocks( const char *device_name, uint8_t fill_pattern )
+{
+  static uint8_t    buff[MANY_REQUEST_BLOCK_COUNT * MANY_BLOCK_SIZE];
+  static uint8_t    expected[MANY_REQUEST_BLOCK_COUNT * MANY_BLOCK_SIZE];
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  unsigned int      i;
+  int               file_descriptor;
+  int               rv;
+  rtems_blkdev_bnum first;
+
+
+  sc = rtems_sparse_disk_create_and_register(
+    device_name,
+    MANY_BLOCK_SIZE,
+    MANY_ALLOCATED_BLOCK_COUNT,
+    MANY_SIMULATED_BLOCK_COUNT,
+    fill_pattern
+    );
+  rtems_test_assert( RTEMS_SUCCESSFUL == sc );
+
+  file_descriptor = open( device_name, O_RDWR );
+  rtems_test_assert( 0 <= file_descriptor );
+
+  rv = rtems_disk_fd_get_disk_device( file_descriptor, &dd );
+  rtems_test_assert( 0 == rv );
+
+  /* Leave room for one multi-block request */
+  for ( i = 0;
+        i < MANY_ALLOCATED_BLOCK_COUNT - MANY_REQUEST_BLOCK_COUNT;
+        ++i ) {
+    fill_many_block( buff, many_block( i ) );
+    sc = transfer_blocks( dd, RTEMS_BLKDEV_REQ_WRITE, many_block( i ), 1, buff );
+    rtems_test_assert( RTEMS_SUCCESSFUL == sc );
+  }
+
+  for ( i = 0;
+        i < MANY_ALLOCATED_BLOCK_COUNT - MANY_REQUEST_BLOCK_COUNT;
+        ++i ) {
+    fill_many_block( expected, many_block( i ) );
+    sc = transfer_blocks( dd, RTEMS_BLKDEV_REQ_READ, many_block( i ), 1, buff );
+    rtems_test_assert( RTEMS_SUCCESSFUL == sc );
+    rtems_test_assert( 0 == memcmp( buff, expected, MANY_BLOCK_SIZE ) );
+  }
+
+  /* Blocks without buffer read as fill pattern */
+  sc = transfer_blocks( dd, RTEMS_BLKDEV_REQ_READ, 1, 1, buff );
+  rtems_test_assert( RTEMS_SUCCESSFUL == sc );
+  memset( expected, fill_pattern, MANY_BLOCK_SIZE );
+  rtems_test_assert( 0 == memcmp( buff, expected, MANY_BLOCK_SIZE ) );
+
+  /* Write and read a range of new blocks with one request each */
+  first = MANY_SIMULATED_BLOCK_COUNT - MANY_REQUEST_BLOCK_COUNT;
+
+  for ( i = 0; i < MANY_REQUEST_BLOCK_COUNT; ++i )
+    fill_many_block( &expected[i * MANY_BLOCK_SIZE], first + i );
+
+  sc = transfer_blocks(
+    dd,
+    RTEMS_BLKDEV_REQ_WRITE,
+    first,
+    MANY_REQUEST_BLOCK_COUNT,
+    expected
+    );
+  rtems_test_assert( RTEMS_SUCCESSFUL == sc );
+
+  memset( buff, 0, sizeof( buff ) );
+  sc = transfer_blocks(
+    dd,
+    RTEMS_BLKDEV_REQ_READ,
+    first,
+    MANY_REQUEST_BLOCK_COUNT,
+    buff
+    );
+  rtems_test_assert( RTEMS_SUCCESSFUL == sc );
+  rtems_test_assert( 0 == memcmp( buff, expected, sizeof( buff ) ) );
+
+  /* All blocks with buffer are in use */
+  fill_many_block( buff, 2 );
+  sc = transfer_blocks( dd, RTEMS_BLKDEV_REQ_WRITE, 2, 1, buff );
+  rtems_test_assert( RTEMS_IO_ERROR == sc );
+
+  /* Writing the fill pattern to a block without buffer needs no buffer */
+  memset( buff, fill_pattern, MANY_BLOCK_SIZE );
+  sc = transfer_blocks( dd, RTEMS_BLKDEV_REQ_WRITE, 2, 1, buff );
+  rtems_test_assert( RTEMS_SUCCESSFUL == sc );
+
+  rv = close( file_descriptor );
+  rtems_test_assert( 0 == rv );
+
+  rv = unlink( device_name );
+  rtems_test_assert( 0 == rv );
+}
+
+static void test_no_buffer( const char *device_name, uint8_t fill_pattern )
+{
+  static uint8_t    buff[MANY_BLOCK_SIZE];
+  static uint8_t    expected[MANY_BLOCK_SIZE];
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  int               file_descriptor;
+  int               rv;
+
+
+  sc = rtems_sparse_disk_create_and_register(
+    device_name,
+    MANY_BLOCK_SIZE,
+    0,
+    MANY_SIMULATED_BLOCK_COUNT,
+    fill_pattern
+    );
+  rtems_test_assert( RTEMS_SUCCESSFUL == sc );
+
+  file_descriptor = open( device_name, O_RDWR );
+  rtems_test_assert( 0 <= file_descriptor );
+
+  rv = rtems_disk_fd_get_disk_device( file_descriptor, &dd );
+  rtems_test_assert( 0 == rv );
+
+  /* All blocks read as fill pattern */
+  sc = transfer_blocks( dd, RTEMS_BLKDEV_REQ_READ, 3, 1, buff );
+  rtems_test_assert( RTEMS_SUCCESSFUL == sc );
+  memset( expected, fill_pattern, MANY_BLOCK_SIZE );
+  rtems_test_assert( 0 == memcmp( buff, expected, MANY_BLOCK_SIZE ) );
+
+  /* There is no block with buffer to write to */
+  fill_many_block( buff, 3 );
+  sc = transfer_blocks( dd, RTEMS_BLKDEV_REQ_WRITE, 3, 1, buff );
+  rtems_test_assert( RTEMS_IO_ERROR == sc );
+
+  /* Writing the fill pattern needs no buffer */
+  memset( buff, fill_pattern, MANY_BLOCK_SIZE );
+  sc = transfer_blocks( dd, RTEMS_BLKDEV_REQ_WRITE, 3, 1, buff );
+  rtems_test_assert( RTEMS_SUCCESSFUL == sc );
+
+  rv = close( file_descriptor );
+  rtems_test_assert( 0 == rv );
+
+  rv = unlink( device_name );
+  rtems_test_assert( 0 == rv );
+}
+
 /*
  * The test sequence
  */
@@ -405,6 +618,10 @@ void test( void )
   rv = unlink( device_name );
   rtems_test_assert( 0 == rv );
 
+  test_many_blocks( device_name, fill_pattern );
+
+  test_no_buffer( device_name, fill_pattern );
+
   /* Do testing with a statically allocated disk. This permits white box
    * testing */
   test_with_whitebox( device_name );
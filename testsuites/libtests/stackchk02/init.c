@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include <rtems/stackchk.h>
+
+const char rtems_test_name[] = "STACKCHK 2";
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+#define WORKER_STACK_SIZE (64 * 1024)
+
+#define WORKER_BUFFER_SIZE (8 * 1024)
+
+static void use_stack(void)
+{
+  volatile char buffer[WORKER_BUFFER_SIZE];
+  size_t        i;
+
+  for (i = 0; i < sizeof(buffer); ++i) {
+    buffer[i] = 0x5a;
+  }
+}
+
+static rtems_task worker(rtems_task_argument arg)
+{
+  rtems_event_set events;
+
+  (void) arg;
+
+  use_stack();
+
+  rtems_event_receive(
+    RTEMS_EVENT_0,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(0);
+}
+
+static void test_get_usage(void)
+{
+  rtems_status_code sc;
+  rtems_id          id;
+  size_t            used;
+  size_t            size;
+
+  sc = rtems_stack_checker_get_usage(RTEMS_SELF, NULL, &size);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_stack_checker_get_usage(RTEMS_SELF, &used, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_stack_checker_get_usage(0xffffffff, &used, &size);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_stack_checker_get_usage(RTEMS_SELF, &used, &size);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(used > 0);
+  rtems_test_assert(used < size);
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    1,
+    WORKER_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_stack_checker_get_usage(id, &used, &size);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(used == 0);
+  rtems_test_assert(size >= WORKER_STACK_SIZE / 2);
+
+  /*
+   * The worker preempts Init and waits after it used the buffer.
+   */
+  sc = rtems_task_start(id, worker, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_stack_checker_get_usage(id, &used, &size);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(used >= WORKER_BUFFER_SIZE);
+  rtems_test_assert(used < size);
+
+  rtems_test_assert(!rtems_stack_checker_is_blown());
+
+  sc = rtems_task_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static rtems_task Init(rtems_task_argument argument)
+{
+  TEST_BEGIN();
+
+  test_get_usage();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_EXTRA_TASK_STACKS WORKER_STACK_SIZE
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_STACK_CHECKER_ENABLED
+
+#define CONFIGURE_STACK_CHECKER_WATERMARK
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <zlib.h>
+
+#include <rtems/untar.h>
+
+const char rtems_test_name[] = "TAR 4";
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+#define DIR_COUNT 8
+
+#define FILE_COUNT 32
+
+#define FILE_SIZE (32 * 1024 + 100)
+
+#define BUFFER_SIZE (64 * 1024)
+
+#define BUFFER_COUNT 4
+
+static unsigned char *tar;
+
+static size_t tar_size;
+
+static unsigned char *tgz;
+
+static uLongf tgz_size;
+
+static unsigned char file_data[FILE_SIZE];
+
+static void file_fill(int file)
+{
+  size_t i;
+
+  /*
+   * Compressible data that differs for each file.
+   */
+  for (i = 0; i < FILE_SIZE; ++i) {
+    file_data[i] = (unsigned char) ((i / 64) + file);
+  }
+}
+
+static void tar_header(
+  unsigned char *header,
+  const char *name,
+  unsigned long size,
+  char type,
+  unsigned long mode
+)
+{
+  unsigned long sum = 0;
+  size_t i;
+
+  memset(header, 0, 512);
+  strlcpy((char *) &header[0], name, 100);
+  snprintf((char *) &header[100], 8, "%07lo", mode);
+  snprintf((char *) &header[108], 8, "%07o", 0);
+  snprintf((char *) &header[116], 8, "%07o", 0);
+  snprintf((char *) &header[124], 12, "%011lo", size);
+  snprintf((char *) &header[136], 12, "%011o", 0);
+  header[156] = type;
+  memcpy(&header[257], "ustar", 6);
+  memcpy(&header[263], "00", 2);
+
+  memset(&header[148], ' ', 8);
+  for (i = 0; i < 512; ++i) {
+    sum += header[i];
+  }
+  snprintf((char *) &header[148], 8, "%06lo", sum);
+}
+
+static void tar_create(void)
+{
+  unsigned char *p;
+  char name[100];
+  int rv;
+  int d;
+  int f;
+
+  tar_size = DIR_COUNT * 512 +
+    FILE_COUNT * (512 + ((FILE_SIZE + 511) & ~511)) + 2 * 512;
+  tar = calloc(1, tar_size);
+  rtems_test_assert(tar != NULL);
+
+  p = tar;
+
+  for (d = 0; d < DIR_COUNT; ++d) {
+    snprintf(name, sizeof(name), "bench/d%d/", d);
+    tar_header(p, name, 0, DIRTYPE, 0755);
+    p += 512;
+  }
+
+  for (f = 0; f < FILE_COUNT; ++f) {
+    snprintf(name, sizeof(name), "bench/d%d/f%d", f % DIR_COUNT, f);
+    tar_header(p, name, FILE_SIZE, REGTYPE, 0644);
+    p += 512;
+    file_fill(f);
+    memcpy(p, file_data, FILE_SIZE);
+    p += (FILE_SIZE + 511) & ~511;
+  }
+
+  tgz_size = compressBound(tar_size);
+  tgz = malloc(tgz_size);
+  rtems_test_assert(tgz != NULL);
+
+  rv = compress2(tgz, &tgz_size, tar, tar_size, Z_DEFAULT_COMPRESSION);
+  rtems_test_assert(rv == Z_OK);
+
+  printf(
+    "image: %d files, tar %zu bytes, compressed %lu bytes\n",
+    FILE_COUNT,
+    tar_size,
+    (unsigned long) tgz_size
+  );
+}
+
+static void check_files(const char *dir)
+{
+  unsigned char buf[512];
+  char path[100];
+  int f;
+
+  for (f = 0; f < FILE_COUNT; ++f) {
+    size_t offset = 0;
+    ssize_t n;
+    int fd;
+    int rv;
+
+    snprintf(path, sizeof(path), "%s/bench/d%d/f%d", dir, f % DIR_COUNT, f);
+    fd = open(path, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    file_fill(f);
+
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+      rtems_test_assert(offset + n <= FILE_SIZE);
+      rtems_test_assert(memcmp(buf, &file_data[offset], n) == 0);
+      offset += n;
+    }
+
+    rtems_test_assert(n == 0);
+    rtems_test_assert(offset == FILE_SIZE);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void test_begin(const char *dir)
+{
+  int rv;
+
+  rv = mkdir(dir, 0777);
+  rtems_test_assert(rv == 0);
+
+  rv = chdir(dir);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_end(const char *desc, const char *dir, uint64_t begin)
+{
+  uint64_t delta;
+  int rv;
+
+  delta = rtems_clock_get_uptime_nanoseconds() - begin;
+
+  rv = chdir("/");
+  rtems_test_assert(rv == 0);
+
+  check_files(dir);
+
+  printf("%s: %" PRIu64 "us\n", desc, delta / 1000);
+}
+
+static void test_untar_gz_chunks(void)
+{
+  Untar_GzChunkContext ctx;
+  void *buffer;
+  uint64_t begin;
+  int status;
+
+  buffer = malloc(BUFFER_SIZE);
+  rtems_test_assert(buffer != NULL);
+
+  test_begin("/chunks");
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  status = Untar_GzChunkContext_Init(&ctx, buffer, BUFFER_SIZE);
+  rtems_test_assert(status == UNTAR_SUCCESSFUL);
+
+  status = Untar_FromGzChunk_Print(&ctx, tgz, tgz_size, NULL);
+  rtems_test_assert(status == UNTAR_SUCCESSFUL);
+
+  test_end("gz chunks", "/chunks", begin);
+
+  free(buffer);
+}
+
+static void test_untar_gz_pipe(void)
+{
+  Untar_PipeContext ctx;
+  uint64_t begin;
+  int status;
+
+  test_begin("/pipe");
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  status = Untar_PipeContext_Init(
+    &ctx,
+    BUFFER_SIZE,
+    BUFFER_COUNT,
+    RTEMS_CURRENT_PRIORITY,
+    NULL
+  );
+  rtems_test_assert(status == UNTAR_SUCCESSFUL);
+
+  status = Untar_FromGzMemory_Pipe(&ctx, tgz, tgz_size);
+  rtems_test_assert(status == UNTAR_SUCCESSFUL);
+
+  test_end("gz pipe", "/pipe", begin);
+}
+
+static void test_untar_gz_pipe_error(void)
+{
+  Untar_PipeContext ctx;
+  int status;
+
+  test_begin("/error");
+
+  status = Untar_PipeContext_Init(
+    &ctx,
+    BUFFER_SIZE,
+    BUFFER_COUNT,
+    RTEMS_CURRENT_PRIORITY,
+    NULL
+  );
+  rtems_test_assert(status == UNTAR_SUCCESSFUL);
+
+  status = Untar_FromGzMemory_Pipe(&ctx, tgz, tgz_size / 2);
+  rtems_test_assert(status == UNTAR_GZ_INFLATE_FAILED);
+
+  status = chdir("/");
+  rtems_test_assert(status == 0);
+}
+
+static rtems_task Init(rtems_task_argument argument)
+{
+  TEST_BEGIN();
+
+  tar_create();
+
+  /*
+   * The uncompressed image is not needed once compressed.
+   */
+  free(tar);
+
+  test_untar_gz_chunks();
+  test_untar_gz_pipe();
+  test_untar_gz_pipe_error();
+
+  free(tgz);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK 512
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (16U * 1024U)
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <rtems/libio_.h>
+#include <rtems/test-info.h>
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPOPEN 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 2
+
+#define FILE_NAME "/file"
+
+typedef struct {
+  rtems_test_parallel_context base;
+  unsigned long local_counter[CPU_COUNT][TEST_COUNT][CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static void test_fini(
+  test_context *ctx,
+  const char *name,
+  size_t test,
+  size_t active_workers
+)
+{
+  unsigned long sum = 0;
+  unsigned long n = active_workers;
+  unsigned long i;
+
+  printf("  <%s activeWorker=\"%lu\">\n", name, n);
+
+  for (i = 0; i < n; ++i) {
+    unsigned long local_counter =
+      ctx->local_counter[active_workers - 1][test][i];
+
+    sum += local_counter;
+
+    printf(
+      "    <LocalCounter worker=\"%lu\">%lu</LocalCounter>\n",
+      i,
+      local_counter
+    );
+  }
+
+  printf(
+    "    <SumOfLocalCounter>%lu</SumOfLocalCounter>\n"
+    "  </%s>\n",
+    sum,
+    name
+  );
+
+  /* All file descriptors except the standard ones must be free again */
+  rtems_test_assert(rtems_libio_free_count() == rtems_libio_number_iops - 3);
+}
+
+static void test_0_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 0;
+  unsigned long counter = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    int fd;
+    int rv;
+
+    fd = open(FILE_NAME, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+
+    ++counter;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_0_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "OpenClose", 0, active_workers);
+}
+
+static void test_1_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 1;
+  unsigned long counter = 0;
+  int fd;
+  int rv;
+
+  fd = open(FILE_NAME, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    int fd2;
+
+    fd2 = dup(fd);
+    rtems_test_assert(fd2 >= 0);
+
+    rv = close(fd2);
+    rtems_test_assert(rv == 0);
+
+    ++counter;
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_1_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "DupClose", 1, active_workers);
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_0_body,
+    .fini = test_0_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_1_body,
+    .fini = test_1_fini,
+    .cascade = true
+  }
+};
+
+static void test_exhaustion(void)
+{
+  int fds[2 * CPU_COUNT];
+  size_t n;
+  size_t i;
+  int fd;
+  int rv;
+
+  n = rtems_libio_free_count();
+  rtems_test_assert(n <= RTEMS_ARRAY_SIZE(fds));
+
+  for (i = 0; i < n; ++i) {
+    fds[i] = open(FILE_NAME, O_RDONLY);
+    rtems_test_assert(fds[i] >= 0);
+  }
+
+  rtems_test_assert(rtems_libio_free_count() == 0);
+
+  errno = 0;
+  fd = open(FILE_NAME, O_RDONLY);
+  rtems_test_assert(fd == -1);
+  rtems_test_assert(errno == ENFILE);
+
+  /* The free file descriptors are reused in first in, first out order */
+  for (i = 0; i < n; ++i) {
+    rv = close(fds[i]);
+    rtems_test_assert(rv == 0);
+  }
+
+  fd = open(FILE_NAME, O_RDONLY);
+  rtems_test_assert(fd == fds[0]);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(rtems_libio_free_count() == n);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  const char *test = "SMPOpen01";
+  int fd;
+  int rv;
+
+  fd = open(FILE_NAME, O_RDWR | O_CREAT, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  test_exhaustion();
+
+  printf("<%s>\n", test);
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("</%s>\n", test);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+/* The standard file descriptors plus two for each worker */
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS (3 + 2 * CPU_COUNT)
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
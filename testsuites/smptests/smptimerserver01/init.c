@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPTIMERSERVER 1";
+
+#define CPU_COUNT 32
+
+#define EVENT_FIRED RTEMS_EVENT_0
+
+typedef struct {
+  rtems_id main_task;
+  rtems_id timers[CPU_COUNT];
+  uint32_t fired_by[CPU_COUNT];
+  uint32_t serviced_by[CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static void set_affinity(uint32_t cpu_index)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  CPU_ZERO(&cpuset);
+  CPU_SET((int) cpu_index, &cpuset);
+
+  sc = rtems_task_set_affinity(RTEMS_SELF, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(rtems_scheduler_get_processor() == cpu_index);
+}
+
+static void timer_routine(rtems_id timer, void *arg)
+{
+  test_context *ctx = &test_instance;
+  uint32_t cpu_index = (uint32_t) (uintptr_t) arg;
+  rtems_status_code sc;
+
+  rtems_test_assert(ctx->timers[cpu_index] == timer);
+  ctx->serviced_by[cpu_index] = rtems_scheduler_get_processor();
+
+  sc = rtems_event_send(ctx->main_task, EVENT_FIRED);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_initiate_errors(void)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  sc = rtems_timer_initiate_server_set(
+    RTEMS_TIMER_SERVER_DEFAULT_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    sizeof(cpuset),
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  CPU_ZERO(&cpuset);
+  sc = rtems_timer_initiate_server_set(
+    RTEMS_TIMER_SERVER_DEFAULT_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    sizeof(cpuset),
+    &cpuset
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+}
+
+static void test_initiate(uint32_t cpu_count)
+{
+  rtems_timer_server_statistics stats;
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+  uint32_t cpu_index;
+
+  sc = rtems_timer_server_get_statistics(0, &stats);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  CPU_ZERO(&cpuset);
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    CPU_SET((int) cpu_index, &cpuset);
+  }
+
+  sc = rtems_timer_initiate_server_set(
+    RTEMS_TIMER_SERVER_DEFAULT_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    sizeof(cpuset),
+    &cpuset
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_initiate_server_set(
+    RTEMS_TIMER_SERVER_DEFAULT_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    sizeof(cpuset),
+    &cpuset
+  );
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  sc = rtems_timer_initiate_server(
+    RTEMS_TIMER_SERVER_DEFAULT_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES
+  );
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  sc = rtems_timer_server_get_statistics(0, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_timer_server_get_statistics(
+    rtems_scheduler_get_processor_maximum(),
+    &stats
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    sc = rtems_timer_server_get_statistics(cpu_index, &stats);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(stats.count == 0);
+  }
+}
+
+static void test_fire(test_context *ctx, uint32_t cpu_count)
+{
+  rtems_status_code sc;
+  uint32_t cpu_index;
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    rtems_event_set events;
+
+    sc = rtems_timer_create(
+      rtems_build_name('T', 'M', 'R', ' '),
+      &ctx->timers[cpu_index]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    set_affinity(cpu_index);
+    ctx->fired_by[cpu_index] = rtems_scheduler_get_processor();
+
+    sc = rtems_timer_server_fire_after(
+      ctx->timers[cpu_index],
+      1,
+      timer_routine,
+      (void *) (uintptr_t) cpu_index
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_receive(
+      EVENT_FIRED,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    rtems_test_assert(ctx->serviced_by[cpu_index] == ctx->fired_by[cpu_index]);
+
+    sc = rtems_timer_delete(ctx->timers[cpu_index]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  set_affinity(0);
+}
+
+static void test_statistics(uint32_t cpu_count)
+{
+  uint32_t cpu_index;
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    rtems_timer_server_statistics stats;
+    rtems_status_code sc;
+
+    sc = rtems_timer_server_get_statistics(cpu_index, &stats);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(stats.count == 1);
+    rtems_test_assert(stats.total_latency == stats.max_latency);
+
+    printf(
+      "processor %" PRIu32 ": latency %" PRIu64 "ns, runtime %" PRIu64 "ns\n",
+      cpu_index,
+      stats.max_latency,
+      stats.max_runtime
+    );
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  uint32_t cpu_count;
+
+  TEST_BEGIN();
+
+  ctx->main_task = rtems_task_self();
+  cpu_count = rtems_scheduler_get_processor_maximum();
+
+  if (cpu_count > CPU_COUNT) {
+    cpu_count = CPU_COUNT;
+  }
+
+  test_initiate_errors();
+  test_initiate(cpu_count);
+  test_fire(ctx, cpu_count);
+  test_statistics(cpu_count);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + CPU_COUNT)
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
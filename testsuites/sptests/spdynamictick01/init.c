@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <rtems.h>
+#include <rtems/score/timecounter.h>
+#include <rtems/score/watchdogimpl.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPDYNAMICTICK 1";
+
+/*
+ * The ARM Generic Timer clock driver limits an idle period to 2^31 counter
+ * cycles, which is about 34 seconds with a counter frequency of 62.5MHz.  The
+ * long idle period exceeds this limit.
+ */
+#define LONG_IDLE_SECONDS 40
+
+typedef struct {
+  Watchdog_Control base;
+  volatile uint64_t fired_at;
+  volatile uint32_t fired;
+} test_watchdog;
+
+static void test_watchdog_routine(Watchdog_Control *base)
+{
+  test_watchdog *w = RTEMS_CONTAINER_OF(base, test_watchdog, base);
+
+  w->fired_at = _Per_CPU_Get()->Watchdog.ticks;
+  ++w->fired;
+}
+
+static void test_watchdog_initialize(test_watchdog *w, Per_CPU_Control *cpu)
+{
+  w->fired_at = 0;
+  w->fired = 0;
+  _Watchdog_Preinitialize(&w->base, cpu);
+  _Watchdog_Initialize(&w->base, test_watchdog_routine);
+}
+
+static void wait_for_fire(const test_watchdog *w)
+{
+  while (w->fired == 0) {
+    /* Wait for the next clock tick */
+  }
+}
+
+static uint64_t tick_nanoseconds(void)
+{
+  return rtems_configuration_get_nanoseconds_per_tick();
+}
+
+static uint64_t to_nanoseconds(const struct timespec *ts)
+{
+  return (uint64_t) ts->tv_sec * 1000000000 + (uint64_t) ts->tv_nsec;
+}
+
+static void from_nanoseconds(struct timespec *ts, uint64_t ns)
+{
+  ts->tv_sec = (time_t) (ns / 1000000000);
+  ts->tv_nsec = (long) (ns % 1000000000);
+}
+
+static void test_wake_after(rtems_interval ticks)
+{
+  rtems_status_code sc;
+  rtems_interval begin_ticks;
+  rtems_interval delta_ticks;
+  uint64_t begin_ns;
+  uint64_t delta_ns;
+
+  /* Start right after a clock tick so that no tick occurs before the sleep */
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  begin_ticks = rtems_clock_get_ticks_since_boot();
+  begin_ns = rtems_clock_get_uptime_nanoseconds();
+  sc = rtems_task_wake_after(ticks);
+  delta_ns = rtems_clock_get_uptime_nanoseconds() - begin_ns;
+  delta_ticks = rtems_clock_get_ticks_since_boot() - begin_ticks;
+
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf(
+    "wake after %" PRIu32 " ticks: %" PRIu32 " ticks, %" PRIu64 "us\n",
+    ticks,
+    delta_ticks,
+    delta_ns / 1000
+  );
+
+  /*
+   * The skipped ticks must be accounted for, so the timeout expires at the
+   * correct tick and the uptime matches the tick count.
+   */
+  rtems_test_assert(delta_ticks == ticks);
+  rtems_test_assert(delta_ns > (uint64_t) (ticks - 1) * tick_nanoseconds());
+  rtems_test_assert(delta_ns < (uint64_t) (ticks + 1) * tick_nanoseconds());
+}
+
+static void test_clock_nanosleep(rtems_interval ticks)
+{
+  struct timespec target;
+  uint64_t target_ns;
+  uint64_t now_ns;
+  int eno;
+
+  rtems_clock_get_uptime(&target);
+  target_ns = to_nanoseconds(&target);
+  target_ns += (uint64_t) ticks * tick_nanoseconds() + tick_nanoseconds() / 2;
+  from_nanoseconds(&target, target_ns);
+
+  eno = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, NULL);
+  now_ns = rtems_clock_get_uptime_nanoseconds();
+
+  rtems_test_assert(eno == 0);
+
+  printf(
+    "clock_nanosleep %" PRIu32 " ticks: late %" PRIu64 "us\n",
+    ticks,
+    (now_ns - target_ns) / 1000
+  );
+
+  rtems_test_assert(now_ns >= target_ns);
+  rtems_test_assert(now_ns - target_ns < 2 * tick_nanoseconds());
+}
+
+static void test_ticks_until_expiry(void)
+{
+  Per_CPU_Control *cpu;
+  test_watchdog w;
+  rtems_interrupt_level level;
+  uint64_t expire;
+
+  rtems_interrupt_local_disable(level);
+  cpu = _Per_CPU_Get();
+  test_watchdog_initialize(&w, cpu);
+
+  rtems_test_assert(
+    _Watchdog_Ticks_until_expiry(cpu, UINT32_MAX) == UINT32_MAX
+  );
+  rtems_test_assert(_Watchdog_Ticks_until_expiry(cpu, 1) == 1);
+
+  expire = _Watchdog_Per_CPU_insert_ticks(&w.base, cpu, 100);
+  rtems_test_assert(_Watchdog_Ticks_until_expiry(cpu, UINT32_MAX) == 100);
+  rtems_test_assert(_Watchdog_Ticks_until_expiry(cpu, 1000) == 100);
+
+  /* The clock driver passes its maximum idle period as the maximum */
+  rtems_test_assert(_Watchdog_Ticks_until_expiry(cpu, 10) == 10);
+  rtems_test_assert(_Watchdog_Ticks_until_expiry(cpu, 1) == 1);
+
+  /* Skip all ticks except the one which expires the watchdog */
+  _Watchdog_Skip_ticks(cpu, 98);
+  rtems_test_assert(_Watchdog_Ticks_until_expiry(cpu, UINT32_MAX) == 2);
+  _Watchdog_Skip_ticks(cpu, 1);
+  rtems_test_assert(_Watchdog_Ticks_until_expiry(cpu, UINT32_MAX) == 1);
+  rtems_test_assert(w.fired == 0);
+  rtems_interrupt_local_enable(level);
+
+  wait_for_fire(&w);
+  rtems_test_assert(w.fired == 1);
+  rtems_test_assert(w.fired_at == expire);
+
+  /* A watchdog skipped over is serviced by the next tick */
+  rtems_interrupt_local_disable(level);
+  test_watchdog_initialize(&w, cpu);
+  expire = _Watchdog_Per_CPU_insert_ticks(&w.base, cpu, 5);
+  _Watchdog_Skip_ticks(cpu, 10);
+  rtems_test_assert(_Watchdog_Ticks_until_expiry(cpu, UINT32_MAX) == 1);
+  rtems_interrupt_local_enable(level);
+
+  wait_for_fire(&w);
+  rtems_test_assert(w.fired == 1);
+  rtems_test_assert(w.fired_at > expire);
+}
+
+static void test_ticks_until_monotonic_expiry(void)
+{
+  Per_CPU_Control *cpu;
+  Watchdog_Header *header;
+  test_watchdog w;
+  rtems_interrupt_level level;
+  struct timespec now;
+  uint64_t expire_ns;
+
+  rtems_interrupt_local_disable(level);
+  cpu = _Per_CPU_Get();
+  header = &cpu->Watchdog.Header[PER_CPU_WATCHDOG_MONOTONIC];
+  test_watchdog_initialize(&w, cpu);
+
+  /* The time of the last timecounter windup does not change here */
+  _Timecounter_Getnanouptime(&now);
+  expire_ns = to_nanoseconds(&now) + 50 * tick_nanoseconds();
+  from_nanoseconds(&now, expire_ns);
+  _Watchdog_Per_CPU_insert(
+    &w.base,
+    cpu,
+    header,
+    _Watchdog_Ticks_from_timespec(&now)
+  );
+
+  rtems_test_assert(_Watchdog_Ticks_until_expiry(cpu, UINT32_MAX) == 50);
+  rtems_test_assert(_Watchdog_Ticks_until_expiry(cpu, 20) == 20);
+
+  _Watchdog_Per_CPU_remove(&w.base, cpu, header);
+  rtems_test_assert(w.fired == 0);
+  rtems_interrupt_local_enable(level);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_interval ticks_per_second;
+
+  TEST_BEGIN();
+
+  ticks_per_second = rtems_clock_get_ticks_per_second();
+
+  test_wake_after(1);
+  test_wake_after(2);
+  test_wake_after(50);
+  test_wake_after(3 * ticks_per_second);
+  test_wake_after(LONG_IDLE_SECONDS * ticks_per_second);
+  test_clock_nanosleep(2);
+  test_clock_nanosleep(3 * ticks_per_second);
+  test_ticks_until_expiry();
+  test_ticks_until_monotonic_expiry();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
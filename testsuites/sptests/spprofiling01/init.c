@@ -20,6 +20,7 @@
 #include <rtems/bspIo.h>
 #include <rtems.h>
 
+#include <pthread.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -113,6 +114,157 @@ static void test_iterate(void)
   rtems_interrupt_lock_destroy(&ctx->d);
 }
 
+typedef struct {
+  rtems_id mutex;
+  bool found;
+  const pthread_mutex_t *posix_mutex;
+  bool posix_found;
+  bool overflow_found;
+} object_context;
+
+static void object_visitor(void *arg, const rtems_profiling_data *data)
+{
+  object_context *ctx = arg;
+
+  if (data->header.type == RTEMS_PROFILING_OBJECT) {
+    const rtems_profiling_object *po = &data->object;
+
+    if (po->id == ctx->mutex) {
+      rtems_test_assert(!ctx->found);
+      rtems_test_assert(po->name != NULL);
+      rtems_test_assert(strcmp(po->name, "MTX") == 0);
+      rtems_test_assert(po->acquire_count == 3);
+      rtems_test_assert(po->contention_count == 1);
+      rtems_test_assert(po->max_wait_time <= po->total_wait_time);
+      rtems_test_assert(po->max_hold_time <= po->total_hold_time);
+      ctx->found = true;
+    }
+
+    if (po->object == ctx->posix_mutex) {
+      rtems_test_assert(!ctx->posix_found);
+      rtems_test_assert(po->id == 0);
+      rtems_test_assert(po->name == NULL);
+      rtems_test_assert(po->acquire_count == 2);
+      rtems_test_assert(po->contention_count == 0);
+      ctx->posix_found = true;
+    }
+  } else if (data->header.type == RTEMS_PROFILING_OBJECT_OVERFLOW) {
+    const rtems_profiling_object_overflow *pov = &data->object_overflow;
+
+    rtems_test_assert(!ctx->overflow_found);
+    rtems_test_assert(pov->table_size > 0);
+    rtems_test_assert(pov->overflow_count == 0);
+    ctx->overflow_found = true;
+  }
+}
+
+static void mutex_task(rtems_task_argument arg)
+{
+  object_context *ctx = (object_context *) arg;
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_obtain(ctx->mutex, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_release(ctx->mutex);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void test_objects(void)
+{
+  object_context ctx_instance;
+  object_context *ctx = &ctx_instance;
+  pthread_mutex_t posix_mutex;
+  rtems_status_code sc;
+  rtems_id task;
+  int eno;
+
+  memset(ctx, 0, sizeof(*ctx));
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('M', 'T', 'X', ' '),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | RTEMS_INHERIT_PRIORITY,
+    0,
+    &ctx->mutex
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    rtems_build_name('M', 'T', 'X', ' '),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &task
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The nested obtain counts as an acquire operation */
+  sc = rtems_semaphore_obtain(ctx->mutex, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_obtain(ctx->mutex, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The higher priority task blocks on the mutex */
+  sc = rtems_task_start(task, mutex_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_release(ctx->mutex);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_release(ctx->mutex);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  eno = pthread_mutex_init(&posix_mutex, NULL);
+  rtems_test_assert(eno == 0);
+  ctx->posix_mutex = &posix_mutex;
+
+  eno = pthread_mutex_lock(&posix_mutex);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutex_unlock(&posix_mutex);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutex_lock(&posix_mutex);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutex_unlock(&posix_mutex);
+  rtems_test_assert(eno == 0);
+
+  rtems_profiling_iterate(object_visitor, ctx);
+
+#ifdef RTEMS_PROFILING
+  rtems_test_assert(ctx->found);
+  rtems_test_assert(ctx->posix_found);
+  rtems_test_assert(ctx->overflow_found);
+#else
+  rtems_test_assert(!ctx->found);
+  rtems_test_assert(!ctx->posix_found);
+  rtems_test_assert(!ctx->overflow_found);
+#endif
+
+  /* The statistics of a destroyed self-contained object are removed */
+  eno = pthread_mutex_destroy(&posix_mutex);
+  rtems_test_assert(eno == 0);
+
+  ctx->found = false;
+  ctx->posix_found = false;
+  ctx->overflow_found = false;
+  rtems_profiling_iterate(object_visitor, ctx);
+  rtems_test_assert(!ctx->posix_found);
+
+  sc = rtems_task_delete(task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_delete(ctx->mutex);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
 static void test_report_xml(void)
 {
   rtems_status_code sc;
@@ -130,6 +282,7 @@ static void Init(rtems_task_argument arg)
   TEST_BEGIN();
 
   test_iterate();
+  test_objects();
   test_report_xml();
 
   TEST_END();
@@ -140,10 +293,14 @@ static void Init(rtems_task_argument arg)
 #define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
 #define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
 
-#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
 
 #define CONFIGURE_RTEMS_INIT_TASKS_TABLE
 
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
 #define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
 
 #define CONFIGURE_INIT
@@ -533,13 +533,13 @@ LAST(RTEMS_SYSINIT_IDLE_THREADS)
 
 FIRST(RTEMS_SYSINIT_LIBIO)
 {
-  assert(rtems_libio_iop_free_head == NULL);
+  assert(rtems_libio_free_count() == 0);
   next_step(LIBIO_PRE);
 }
 
 LAST(RTEMS_SYSINIT_LIBIO)
 {
-  assert(rtems_libio_iop_free_head == &rtems_libio_iops[0]);
+  assert(rtems_libio_free_count() == rtems_libio_number_iops);
   next_step(LIBIO_POST);
 }
 
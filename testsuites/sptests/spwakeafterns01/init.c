@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <rtems.h>
+#include <rtems/score/watchdogimpl.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPWAKEAFTERNS 1";
+
+#define ITERATIONS 16
+
+/*
+ * With a high resolution timer in the clock driver the monotonic watchdogs
+ * expire at their expiration time and not at the next clock tick, so a task
+ * sleeps less than one clock tick longer than the requested interval.
+ */
+static void check_delta(uint64_t delta, uint64_t ns)
+{
+  rtems_test_assert(delta >= ns);
+
+  if (_Watchdog_High_resolution_handler != NULL) {
+    rtems_test_assert(
+      delta - ns < (uint64_t) rtems_configuration_get_nanoseconds_per_tick()
+    );
+  }
+}
+
+static uint64_t test_wake_after_ns(uint64_t ns)
+{
+  uint64_t max = 0;
+  int i;
+
+  for (i = 0; i < ITERATIONS; ++i) {
+    rtems_status_code sc;
+    uint64_t begin;
+    uint64_t delta;
+
+    begin = rtems_clock_get_uptime_nanoseconds();
+    sc = rtems_task_wake_after_ns(ns);
+    delta = rtems_clock_get_uptime_nanoseconds() - begin;
+
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    check_delta(delta, ns);
+
+    if (delta > max) {
+      max = delta;
+    }
+  }
+
+  return max;
+}
+
+static uint64_t test_clock_nanosleep(uint64_t ns)
+{
+  uint64_t max = 0;
+  int i;
+
+  for (i = 0; i < ITERATIONS; ++i) {
+    struct timespec ts;
+    uint64_t begin;
+    uint64_t delta;
+    int eno;
+
+    ts.tv_sec = (time_t) (ns / 1000000000);
+    ts.tv_nsec = (long) (ns % 1000000000);
+
+    begin = rtems_clock_get_uptime_nanoseconds();
+    eno = clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, NULL);
+    delta = rtems_clock_get_uptime_nanoseconds() - begin;
+
+    rtems_test_assert(eno == 0);
+    check_delta(delta, ns);
+
+    if (delta > max) {
+      max = delta;
+    }
+  }
+
+  return max;
+}
+
+static void test_delay(uint64_t ns)
+{
+  uint64_t wake_after;
+  uint64_t nanosleep;
+
+  wake_after = test_wake_after_ns(ns);
+  nanosleep = test_clock_nanosleep(ns);
+
+  printf(
+    "delay %" PRIu64 "us: wake after max %" PRIu64
+      "us, clock_nanosleep max %" PRIu64 "us\n",
+    ns / 1000,
+    wake_after / 1000,
+    nanosleep / 1000
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  uint64_t ns_per_tick;
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+
+  sc = rtems_task_wake_after_ns(0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ns_per_tick = (uint64_t) rtems_configuration_get_nanoseconds_per_tick();
+
+  test_delay(50000);
+  test_delay(ns_per_tick / 2);
+  test_delay(3 * ns_per_tick + ns_per_tick / 3);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/test.h>
+
+#include <rtems.h>
+#include <rtems/bspIo.h>
+#include <rtems/test-info.h>
+
+#include <bsp.h>
+
+#define _RTEMS_TMTEST27
+#include <tm27.h>
+
+const char rtems_test_name[] = "TMLATENCY 1";
+
+#if defined(OPERATION_COUNT)
+#define SAMPLE_COUNT OPERATION_COUNT
+#else
+#define SAMPLE_COUNT 100
+#endif
+
+#define MAXIMUM_RETRIES 3
+
+#define WORKER_PRIORITY 1
+
+#if defined(RTEMS_SMP)
+#define PROCESSOR_COUNT 4
+#else
+#define PROCESSOR_COUNT 1
+#endif
+
+typedef enum {
+  WAKEUP_NONE,
+  WAKEUP_EVENT,
+  WAKEUP_SEMAPHORE,
+  WAKEUP_MESSAGE
+} wakeup_kind;
+
+typedef struct {
+  T_measure_runtime_context *measure;
+  rtems_id event_worker;
+  rtems_id semaphore_worker;
+  rtems_id message_worker;
+  rtems_id semaphore;
+  rtems_id message_queue;
+  wakeup_kind wakeup;
+  volatile T_ticks begin;
+  volatile T_ticks isr;
+  volatile T_ticks end;
+  volatile uint32_t isr_count;
+  volatile uint32_t end_count;
+} test_context;
+
+static test_context test_instance;
+
+static rtems_isr isr_handler(rtems_vector_number vector)
+{
+  test_context *ctx = &test_instance;
+  T_ticks now = T_tick();
+
+  (void) vector;
+
+  Clear_tm27_intr();
+  ctx->isr = now;
+
+  switch (ctx->wakeup) {
+    case WAKEUP_EVENT:
+      (void) rtems_event_transient_send(ctx->event_worker);
+      break;
+    case WAKEUP_SEMAPHORE:
+      (void) rtems_semaphore_release(ctx->semaphore);
+      break;
+    case WAKEUP_MESSAGE:
+      (void) rtems_message_queue_send(ctx->message_queue, &now, sizeof(now));
+      break;
+    default:
+      break;
+  }
+
+  ++ctx->isr_count;
+}
+
+static void worker_done(test_context *ctx)
+{
+  ctx->end = T_tick();
+  ++ctx->end_count;
+}
+
+static void event_worker(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    (void) rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    worker_done(ctx);
+  }
+}
+
+static void semaphore_worker(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    (void) rtems_semaphore_obtain(ctx->semaphore, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    worker_done(ctx);
+  }
+}
+
+static void message_worker(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    T_ticks msg;
+    size_t size;
+
+    (void) rtems_message_queue_receive(
+      ctx->message_queue,
+      &msg,
+      &size,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    worker_done(ctx);
+  }
+}
+
+static void wait_for_change(volatile uint32_t *counter, uint32_t previous)
+{
+  while (*counter == previous) {
+    /* Wait */
+  }
+}
+
+static void isr_body(void *arg)
+{
+  test_context *ctx = arg;
+  uint32_t isr_count = ctx->isr_count;
+
+  ctx->begin = T_tick();
+  Cause_tm27_intr();
+  wait_for_change(&ctx->isr_count, isr_count);
+}
+
+static void isr_to_task_body(void *arg)
+{
+  test_context *ctx = arg;
+  uint32_t end_count = ctx->end_count;
+
+  ctx->begin = T_tick();
+  Cause_tm27_intr();
+  wait_for_change(&ctx->end_count, end_count);
+}
+
+static void task_to_task_body(void *arg)
+{
+  test_context *ctx = arg;
+  uint32_t end_count = ctx->end_count;
+
+  ctx->begin = T_tick();
+  (void) rtems_event_transient_send(ctx->event_worker);
+  wait_for_change(&ctx->end_count, end_count);
+}
+
+static bool retry_on_clock_tick(
+  uint32_t tic,
+  uint32_t toc,
+  unsigned int retry
+)
+{
+  return tic == toc || retry >= MAXIMUM_RETRIES;
+}
+
+static bool isr_teardown(
+  void *arg,
+  T_ticks *delta,
+  uint32_t tic,
+  uint32_t toc,
+  unsigned int retry
+)
+{
+  test_context *ctx = arg;
+
+  *delta = ctx->isr - ctx->begin;
+  return retry_on_clock_tick(tic, toc, retry);
+}
+
+static bool task_teardown(
+  void *arg,
+  T_ticks *delta,
+  uint32_t tic,
+  uint32_t toc,
+  unsigned int retry
+)
+{
+  test_context *ctx = arg;
+
+  *delta = ctx->end - ctx->begin;
+  return retry_on_clock_tick(tic, toc, retry);
+}
+
+static void measure(
+  test_context *ctx,
+  const char *name,
+  wakeup_kind wakeup,
+  void (*body)(void *),
+  bool (*teardown)(void *, T_ticks *, uint32_t, uint32_t, unsigned int)
+)
+{
+  T_measure_runtime_request req = {
+    .name = name,
+    .flags = T_MEASURE_RUNTIME_ALLOW_CLOCK_ISR,
+    .body = body,
+    .teardown = teardown,
+    .arg = ctx
+  };
+
+  ctx->wakeup = wakeup;
+  T_measure_runtime(ctx->measure, &req);
+  ctx->wakeup = WAKEUP_NONE;
+}
+
+static bool has_tm27_support(test_context *ctx)
+{
+  rtems_interval start;
+  uint32_t isr_count;
+
+  /* The default tm27 support does not raise an interrupt */
+  ctx->wakeup = WAKEUP_NONE;
+  isr_count = ctx->isr_count;
+  start = rtems_clock_get_ticks_since_boot();
+  Cause_tm27_intr();
+
+  while (ctx->isr_count == isr_count) {
+    if (rtems_clock_get_ticks_since_boot() - start > 2) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static rtems_id start_worker(test_context *ctx, rtems_task_entry entry)
+{
+  rtems_status_code sc;
+  rtems_id id;
+#if defined(RTEMS_SMP)
+  cpu_set_t cpu;
+#endif
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    WORKER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  T_rsc_success(sc);
+
+#if defined(RTEMS_SMP)
+  /* Use the processor of the runner which is used to raise the interrupt */
+  CPU_ZERO(&cpu);
+  CPU_SET(0, &cpu);
+  sc = rtems_task_set_affinity(id, sizeof(cpu), &cpu);
+  T_rsc_success(sc);
+#endif
+
+  sc = rtems_task_start(id, entry, (rtems_task_argument) ctx);
+  T_rsc_success(sc);
+
+  return id;
+}
+
+static void delete_worker(rtems_id id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_delete(id);
+  T_rsc_success(sc);
+}
+
+/*
+ * Measure the interrupt entry latency and the latency from the interrupt to
+ * the execution of a task woken up by the interrupt service routine through
+ * an event, a semaphore, or a message.  The task to task latency gives the
+ * dispatch latency without an interrupt.  The runtime measurement provides
+ * the distribution of each latency with a valid, hot, and dirty cache, and
+ * with a cache-dirtying background load on the other processors.
+ */
+T_TEST_CASE(InterruptLatency)
+{
+  static const T_measure_runtime_config config = {
+    .sample_count = SAMPLE_COUNT
+  };
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  bool tm27_support;
+
+  ctx->measure = T_measure_runtime_create(&config);
+  T_assert_not_null(ctx->measure);
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('S', 'E', 'M', 'A'),
+    0,
+    RTEMS_SIMPLE_BINARY_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &ctx->semaphore
+  );
+  T_rsc_success(sc);
+
+  sc = rtems_message_queue_create(
+    rtems_build_name('M', 'S', 'G', 'Q'),
+    1,
+    sizeof(T_ticks),
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->message_queue
+  );
+  T_rsc_success(sc);
+
+  ctx->event_worker = start_worker(ctx, event_worker);
+  ctx->semaphore_worker = start_worker(ctx, semaphore_worker);
+  ctx->message_worker = start_worker(ctx, message_worker);
+
+  measure(ctx, "TaskToTaskEvent", WAKEUP_NONE, task_to_task_body,
+    task_teardown);
+
+  Install_tm27_vector(isr_handler);
+  tm27_support = has_tm27_support(ctx);
+
+  if (tm27_support) {
+    measure(ctx, "InterruptEntry", WAKEUP_NONE, isr_body, isr_teardown);
+    measure(ctx, "InterruptToTaskEvent", WAKEUP_EVENT, isr_to_task_body,
+      task_teardown);
+    measure(ctx, "InterruptToTaskSemaphore", WAKEUP_SEMAPHORE,
+      isr_to_task_body, task_teardown);
+    measure(ctx, "InterruptToTaskMessage", WAKEUP_MESSAGE, isr_to_task_body,
+      task_teardown);
+  } else {
+    T_log(T_NORMAL, "tm27 support not available, skip interrupt latency");
+  }
+
+  delete_worker(ctx->event_worker);
+  delete_worker(ctx->semaphore_worker);
+  delete_worker(ctx->message_worker);
+
+  sc = rtems_message_queue_delete(ctx->message_queue);
+  T_rsc_success(sc);
+
+  sc = rtems_semaphore_delete(ctx->semaphore);
+  T_rsc_success(sc);
+}
+
+static char buffer[512];
+
+static const T_action actions[] = {
+  T_report_hash_sha256
+};
+
+static const T_config test_config = {
+  .name = "TmLatency01",
+  .buf = buffer,
+  .buf_size = sizeof(buffer),
+  .putchar = rtems_put_char,
+  .verbosity = T_NORMAL,
+  .now = T_now_clock,
+  .action_count = T_ARRAY_SIZE(actions),
+  .actions = actions
+};
+
+static void Init(rtems_task_argument arg)
+{
+  int exit_code;
+
+  (void) arg;
+
+  rtems_test_begin(rtems_test_name, TEST_STATE);
+  T_register();
+  exit_code = T_main(&test_config);
+
+  if (exit_code == 0) {
+    rtems_test_end(rtems_test_name);
+  }
+
+  rtems_test_exit(exit_code);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+/* The runner, the workers, and one load task for each processor */
+#define CONFIGURE_MAXIMUM_TASKS (4 + PROCESSOR_COUNT)
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(1, sizeof(T_ticks))
+
+#define CONFIGURE_MAXIMUM_PROCESSORS PROCESSOR_COUNT
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>